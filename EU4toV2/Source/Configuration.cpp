@@ -25,6 +25,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "OSCompatibilityLayer.h"
 #include "ParadoxParserUTF8.h"
 #include "Object.h"
+#include "ParserProfiling.h"
 #include "Log.h"
 #include <vector>
 using namespace std;
@@ -110,6 +111,14 @@ Configuration::Configuration():
 		debug = true;
 	}
 
+	string logLevel = obj[0]->safeGetString("log_level", "debug");
+	if (!Log::setLevel(logLevel))
+	{
+		LOG(LogLevel::Warning) << "Unknown log_level " << logLevel << ", logging everything";
+	}
+
+	commonItems::enableParserProfiling(obj[0]->safeGetString("profile_parsing") == "yes");
+
 	V2Gametype			= obj[0]->safeGetString("V2gametype");
 	resetProvinces		= "no";//obj[0]->safeGetString("resetProvinces");
 	MaxLiteracy			= obj[0]->safeGetFloat("max_literacy");
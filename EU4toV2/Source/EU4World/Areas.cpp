@@ -31,7 +31,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 EU4::areas::areas(const std::string& filename):
 	theAreas()
 {
-	registerKeyword(std::regex("[\\w_]+"), [this](const std::string& areaName, std::istream& areasFile)
+	registerRegex("[\\w_]+", [this](const std::string& areaName, std::istream& areasFile)
 		{
 			area newArea(areasFile);
 			theAreas.insert(make_pair(areaName, newArea));
@@ -58,7 +58,7 @@ const std::set<int> EU4::areas::getProvincesInArea(const std::string& area) cons
 
 EU4::area::area(std::istream& theStream)
 {
-	registerKeyword(std::regex("color"), [this](const std::string& colorToken, std::istream& areaFile)
+	registerKeyword("color", [this](const std::string& colorToken, std::istream& areaFile)
 		{
 			commonItems::Color newColor(areaFile);
 			color = newColor;
@@ -47,20 +47,20 @@ namespace EU4
 
 	colonialRegion::colonialRegion(std::istream& theStream)
 	{
-		registerKeyword(std::regex("color"), [this](const std::string& unused, std::istream& theStream)
+		registerKeyword("color", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::Color unusedColor(theStream);
 		});
-		registerKeyword(std::regex("tax_income"), commonItems::ignoreObject);
-		registerKeyword(std::regex("native_size"), commonItems::ignoreObject);
-		registerKeyword(std::regex("native_ferocity"), commonItems::ignoreObject);
-		registerKeyword(std::regex("native_hostileness"), commonItems::ignoreObject);
-		registerKeyword(std::regex("trade_goods"), commonItems::ignoreObject);
-		registerKeyword(std::regex("culture"), commonItems::ignoreObject);
-		registerKeyword(std::regex("religion"), commonItems::ignoreObject);
-		registerKeyword(std::regex("names"), commonItems::ignoreObject);
-		registerKeyword(std::regex("extra_province_names"), commonItems::ignoreObject);
-		registerKeyword(std::regex("provinces"), [this](const std::string& unused, std::istream& theStream)
+		registerKeyword("tax_income", commonItems::ignoreObject);
+		registerKeyword("native_size", commonItems::ignoreObject);
+		registerKeyword("native_ferocity", commonItems::ignoreObject);
+		registerKeyword("native_hostileness", commonItems::ignoreObject);
+		registerKeyword("trade_goods", commonItems::ignoreObject);
+		registerKeyword("culture", commonItems::ignoreObject);
+		registerKeyword("religion", commonItems::ignoreObject);
+		registerKeyword("names", commonItems::ignoreObject);
+		registerKeyword("extra_province_names", commonItems::ignoreObject);
+		registerKeyword("provinces", [this](const std::string& unused, std::istream& theStream)
 			{
 				auto equals = getNextToken(theStream);
 				commonItems::intList theProvinces(theStream);
@@ -85,7 +85,7 @@ namespace EU4
 	{
 		LOG(LogLevel::Info) << "Parsing EU4 colonial regions";
 
-		registerKeyword(std::regex("colonial_\\w+"), [this](const std::string& regionName, std::istream& theStream)
+		registerRegex("colonial_\\w+", [this](const std::string& regionName, std::istream& theStream)
 			{
 				colonialRegion newRegion(theStream);
 				auto provinces = newRegion.getProvinces();
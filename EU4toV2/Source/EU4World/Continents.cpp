@@ -63,7 +63,7 @@ void EU4::continents::initContinentMap(const std::string& filename)
 {
 	continentMap.clear();
 
-	registerKeyword(std::regex("\\w+"), [this](const std::string& continentName, std::istream& theStream)
+	registerRegex("\\w+", [this](const std::string& continentName, std::istream& theStream)
 		{
 			auto equals = getNextToken(theStream);
 			commonItems::intList newContinent(theStream);
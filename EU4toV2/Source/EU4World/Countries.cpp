@@ -30,17 +30,17 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 EU4::countries::countries(istream& theStream):
 	theCountries()
 {
-	registerKeyword(std::regex("---"), commonItems::ignoreObject);
-	registerKeyword(std::regex("REB"), commonItems::ignoreObject);
-	registerKeyword(std::regex("PIR"), commonItems::ignoreObject);
-	registerKeyword(std::regex("NAT"), commonItems::ignoreObject);
-	registerKeyword(std::regex("[A-Z]{3}"), [this](const std::string& tag, std::istream& theStream)
+	registerRegex("---", commonItems::ignoreObject);
+	registerKeyword("REB", commonItems::ignoreObject);
+	registerKeyword("PIR", commonItems::ignoreObject);
+	registerKeyword("NAT", commonItems::ignoreObject);
+	registerRegex("[A-Z]{3}", [this](const std::string& tag, std::istream& theStream)
 		{
 			auto country = make_shared<EU4::Country>(tag, theStream);
 			theCountries.insert(make_pair(country->getTag(), country));
 		}
 	);
-	registerKeyword(std::regex("[A-Z][0-9]{2}"), [this](const std::string& tag, std::istream& theStream)
+	registerRegex("[A-Z][0-9]{2}", [this](const std::string& tag, std::istream& theStream)
 		{
 			auto country = make_shared<EU4::Country>(tag, theStream);
 			theCountries.insert(make_pair(country->getTag(), country));
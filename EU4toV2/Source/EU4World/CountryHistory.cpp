@@ -30,7 +30,7 @@ EU4::countryHistory::countryHistory(std::istream& theStream):
 {
 	auto ignore = getNextToken(theStream);
 
-	registerKeyword(std::regex("\\d+\\.\\d+\\.\\d+"), [this](const std::string& date, std::istream& theStream)
+	registerRegex("\\d+\\.\\d+\\.\\d+", [this](const std::string& date, std::istream& theStream)
 		{
 			countryHistoryDate theDate(theStream);
 			for (auto& item: theDate.getItems())
@@ -40,7 +40,7 @@ EU4::countryHistory::countryHistory(std::istream& theStream):
 		}
 	);
 
-	registerKeyword(std::regex("[A-Za-z0-9\\_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9\\_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
@@ -50,13 +50,13 @@ EU4::countryHistoryDate::countryHistoryDate(std::istream& theStream):
 	items()
 {
 
-	registerKeyword(std::regex("leader"), [this](const std::string& date, std::istream& theStream)
+	registerKeyword("leader", [this](const std::string& date, std::istream& theStream)
 		{
 		std::shared_ptr<historyLeader> newLeader = std::make_unique<historyLeader>(theStream);
 			items.emplace_back(newLeader);
 		}
 	);
-	registerKeyword(std::regex("[a-zA-Z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
@@ -59,12 +59,12 @@ class governmentSection: commonItems::parser
 
 governmentSection::governmentSection(std::istream& theStream)
 {
-	registerKeyword(std::regex("government"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("government", [this](const std::string& unused, std::istream& theStream)
 	{
 		government = governmentSection::readGovernment(theStream);
 
 	});
-	registerKeyword(std::regex("[a-zA-Z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
@@ -119,7 +119,7 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 	namesByLanguage(),
 	adjectivesByLanguage()
 {
-	registerKeyword(std::regex("name"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("name", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString theName(theStream);
 			name = theName.getString();
@@ -129,20 +129,20 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			}
 		}
 	);
-	registerKeyword(std::regex("custom_name"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("custom_name", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString theName(theStream);
 			randomName = V2Localisation::Convert(theName.getString());
 			customNation = true;
 		}
 	);
-	registerKeyword(std::regex("adjective"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("adjective", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString theAdjective(theStream);
 			adjective = theAdjective.getString();
 		}
 	);
-	registerKeyword(std::regex("map_color"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("map_color", [this](const std::string& unused, std::istream& theStream)
 		{
 			color = commonItems::Color(theStream);
 			// Countries whose colors are included in the object here tend to be generated countries,
@@ -151,7 +151,7 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			color.RandomlyFlunctuate(30);
 		}
 	);
-	registerKeyword(std::regex("colors"), [this](const std::string& colorsString, std::istream& theStream)
+	registerKeyword("colors", [this](const std::string& colorsString, std::istream& theStream)
 		{
 			auto colorObj = commonItems::convert8859Object(colorsString, theStream);
 			vector<shared_ptr<Object>> countryColorObjs = colorObj->getLeaves()[0]->getValue("country_color");
@@ -165,25 +165,25 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			}
 		}
 	);
-	registerKeyword(std::regex("capital"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("capital", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleInt theCapital(theStream);
 			capital = theCapital.getInt();
 		}
 	);
-	registerKeyword(std::regex("technology_group"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("technology_group", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString theTechGroup(theStream);
 			techGroup = theTechGroup.getString();
 		}
 	);
-	registerKeyword(std::regex("liberty_desire"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("liberty_desire", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleDouble theLibertyDesire(theStream);
 			libertyDesire = theLibertyDesire.getDouble();
 		}
 	);
-	registerKeyword(std::regex("institutions"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("institutions", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::intList theInstitutions(theStream);
 			for (auto institution: theInstitutions.getInts())
@@ -199,25 +199,25 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			}
 		}
 	);
-	registerKeyword(std::regex("isolationism"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("isolationism", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleInt isolationismValue(theStream);
 			isolationism = isolationismValue.getInt();
 		}
 	);
-	registerKeyword(std::regex("primary_culture"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("primary_culture", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString thePrimaryCulture(theStream);
 			primaryCulture = thePrimaryCulture.getString();
 		}
 	);
-	registerKeyword(std::regex("accepted_culture"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("accepted_culture", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString theAcceptedCulture(theStream);
 			acceptedCultures.push_back(theAcceptedCulture.getString());
 		}
 	);
-	registerKeyword(std::regex("government_rank"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("government_rank", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleInt theGovernmentRank(theStream);
 			if ((theGovernmentRank.getInt() > 2) && (Configuration::wasDLCActive("The Cossacks")))
@@ -226,7 +226,7 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			}
 		}
 	);
-	registerKeyword(std::regex("realm_development"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("realm_development", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleInt theDevelopment(theStream);
 			if ((theDevelopment.getInt() >= 1000) && (!Configuration::wasDLCActive("The Cossacks")))
@@ -235,7 +235,7 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			}
 		}
 	);
-	registerKeyword(std::regex("culture_group_union"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("culture_group_union", [this](const std::string& unused, std::istream& theStream)
 		{
 			if (Configuration::versionLessThan("1.7.0.0"))
 			{
@@ -249,25 +249,25 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			}
 		}
 	);
-	registerKeyword(std::regex("religion"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("religion", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString theReligion(theStream);
 			religion = theReligion.getString();
 		}
 	);
-	registerKeyword(std::regex("score"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("score", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleDouble theScore(theStream);
 			score = theScore.getDouble();
 		}
 	);
-	registerKeyword(std::regex("stability"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("stability", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleDouble theStability(theStream);
 			stability = theStability.getDouble();
 		}
 	);
-	registerKeyword(std::regex("technology"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("technology", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto topObj = commonItems::convert8859Object(unused, theStream);
 			auto techsObj = topObj->getLeaves();
@@ -281,7 +281,7 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			milTech = stof(techObj[0]->getLeaf());
 		}
 	);
-	registerKeyword(std::regex("flags"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("flags", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto flagsObj = commonItems::convert8859Object(unused, theStream);
 			for (auto flagObject: flagsObj->getLeaves()[0]->getLeaves())
@@ -290,7 +290,7 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			}
 		}
 	);
-	registerKeyword(std::regex("hidden_flags"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("hidden_flags", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto flagsObj = commonItems::convert8859Object(unused, theStream);
 			for (auto flagObject: flagsObj->getLeaves()[0]->getLeaves())
@@ -299,7 +299,7 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			}
 		}
 	);
-	registerKeyword(std::regex("modifier"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("modifier", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto modifierObj = commonItems::convert8859Object(unused, theStream);
 			vector<shared_ptr<Object>> subModifierObj = modifierObj->getLeaves()[0]->getValue("modifier");
@@ -309,7 +309,7 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			}
 		}
 	);
-	registerKeyword(std::regex("variables"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("variables", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto variablesObj = commonItems::convert8859Object(unused, theStream);
 			for (auto variableObject: variablesObj->getLeaves()[0]->getLeaves())
@@ -318,7 +318,7 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			}
 		}
 	);
-	registerKeyword(std::regex("government"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("government", [this](const std::string& unused, std::istream& theStream){
 		if (Configuration::versionLessThan("1.7.0.0"))
 		{
 			government = governmentSection::readGovernment(theStream);
@@ -329,7 +329,7 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			government = theSection.getGovernment();
 		}
 	});
-	registerKeyword(std::regex("active_relations"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("active_relations", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto relationLeaves = commonItems::convert8859Object(unused, theStream);
 			for (auto relationLeaf: relationLeaves->getLeaves()[0]->getLeaves())
@@ -340,21 +340,21 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			}
 		}
 	);
-	registerKeyword(std::regex("army"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("army", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto armyObj = commonItems::convert8859Object(unused, theStream);
 			EU4Army* army = new EU4Army(armyObj->getLeaves()[0]);
 			armies.push_back(army);
 		}
 	);
-	registerKeyword(std::regex("navy"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("navy", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto armyObj = commonItems::convert8859Object(unused, theStream);
 			EU4Army* navy = new EU4Army(armyObj->getLeaves()[0]);
 			armies.push_back(navy);
 		}
 	);
-	registerKeyword(std::regex("active_idea_groups"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("active_idea_groups", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto topObject = commonItems::convert8859Object(unused, theStream);
 			auto activeIdeasObjs = topObject->getLeaves();
@@ -364,31 +364,31 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			}
 		}
 	);
-	registerKeyword(std::regex("legitimacy"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("legitimacy", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleDouble theLegitimacy(theStream);
 			legitimacy = theLegitimacy.getDouble();
 		}
 	);
-	registerKeyword(std::regex("parent"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("parent", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString alsoUnused(theStream);
 			colony = true;
 		}
 	);
-	registerKeyword(std::regex("colonial_parent"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("colonial_parent", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString alsoUnused(theStream);
 			colony = true;
 		}
 	);
-	registerKeyword(std::regex("overlord"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("overlord", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString theOverlord(theStream);
 			overlord = theOverlord.getString();
 		}
 	);
-	registerKeyword(std::regex("country_colors"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("country_colors", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto customFlagObj = commonItems::convert8859Object(unused, theStream);
 			vector<shared_ptr<Object>> flag = customFlagObj->getValue("flag");
@@ -404,13 +404,13 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 			}
 		}
 	);
-	registerKeyword(std::regex("revolutionary_colors"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("revolutionary_colors", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto colorTokens = commonItems::intList(theStream).getInts();
 			revolutionaryTricolour = std::make_tuple(colorTokens[0], colorTokens[1], colorTokens[2]);
 		}
 	);
-	registerKeyword(std::regex("history"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("history", [this](const std::string& unused, std::istream& theStream)
 		{
 			EU4::countryHistory theCountryHistory(theStream);
 
@@ -430,7 +430,7 @@ EU4::Country::Country(const std::string& countryTag, std::istream& theStream):
 		}
 	);
 
-	registerKeyword(std::regex("[a-z0-9\\_]+"), commonItems::ignoreItem);
+	registerRegex("[a-z0-9\\_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 
@@ -560,12 +560,12 @@ void EU4::Country::readFromCommonCountry(const std::string& fileName, const std:
 
 	if (!color)
 	{
-		registerKeyword(std::regex("color"), [this](const std::string& unused, std::istream& theStream)
+		registerKeyword("color", [this](const std::string& unused, std::istream& theStream)
 			{
 				color = commonItems::Color(theStream);
 			}
 		);
-		registerKeyword(std::regex("[a-zA-Z0-9_]+"), commonItems::ignoreItem);
+		registerRegex("[a-zA-Z0-9_]+", commonItems::ignoreItem);
 
 		parseFile(fullFilename);
 	}
@@ -22,15 +22,15 @@ THE SOFTWARE. */
 
 #include "EU4Diplomacy.h"
 #include "Log.h"
-#include "Object.h"
+#include "ObjectTree.h"
 
 
 
-EU4Agreement::EU4Agreement(shared_ptr<Object> obj)
+EU4Agreement::EU4Agreement(const commonItems::objectNode* obj)
 {
 	type = obj->getKey();
 
-	std::vector<shared_ptr<Object>> objType = obj->getValue("subject_type");
+	std::vector<const commonItems::objectNode*> objType = obj->getValue("subject_type");
 	if (objType.size() > 0)
 	{
 		type = objType[0]->getLeaf();
@@ -50,7 +50,7 @@ EU4Agreement::EU4Agreement(shared_ptr<Object> obj)
 	}
 
 
-	std::vector<shared_ptr<Object>> objFirst = obj->getValue("first");
+	std::vector<const commonItems::objectNode*> objFirst = obj->getValue("first");
 	if (objFirst.size() > 0)
 	{
 		country1 = objFirst[0]->getLeaf();
@@ -60,7 +60,7 @@ EU4Agreement::EU4Agreement(shared_ptr<Object> obj)
 		LOG(LogLevel::Warning) << "Diplomatic agreement (" << type << ") has no first party";
 	}
 
-	std::vector<shared_ptr<Object>> objSecond = obj->getValue("second");
+	std::vector<const commonItems::objectNode*> objSecond = obj->getValue("second");
 	if (objSecond.size() > 0)
 	{
 		country2 = objSecond[0]->getLeaf();
@@ -70,7 +70,7 @@ EU4Agreement::EU4Agreement(shared_ptr<Object> obj)
 		LOG(LogLevel::Warning) << "Diplomatic agreement (" << type << ") has no second party";
 	}
 
-	std::vector<shared_ptr<Object>> objDate = obj->getValue("start_date");
+	std::vector<const commonItems::objectNode*> objDate = obj->getValue("start_date");
 	if (objDate.size() > 0)
 	{
 		startDate = date(objDate[0]->getLeaf());
@@ -84,73 +84,73 @@ EU4Diplomacy::EU4Diplomacy()
 }
 
 
-EU4Diplomacy::EU4Diplomacy(shared_ptr<Object> obj)
+EU4Diplomacy::EU4Diplomacy(const commonItems::objectNode* obj)
 {
-	std::vector<shared_ptr<Object>> objRMs = obj->getValue("royal_marriage");
-	for (std::vector<shared_ptr<Object>>::iterator itr = objRMs.begin(); itr != objRMs.end(); ++itr)
+	std::vector<const commonItems::objectNode*> objRMs = obj->getValue("royal_marriage");
+	for (std::vector<const commonItems::objectNode*>::iterator itr = objRMs.begin(); itr != objRMs.end(); ++itr)
 	{
 		EU4Agreement agr(*itr);		// the new agreement
 		agreements.push_back(agr);
 	}
 
-	std::vector<shared_ptr<Object>> objGaurantees = obj->getValue("guarantee");
-	for (std::vector<shared_ptr<Object>>::iterator itr = objGaurantees.begin(); itr != objGaurantees.end(); ++itr)
+	std::vector<const commonItems::objectNode*> objGaurantees = obj->getValue("guarantee");
+	for (std::vector<const commonItems::objectNode*>::iterator itr = objGaurantees.begin(); itr != objGaurantees.end(); ++itr)
 	{
 		EU4Agreement agr(*itr);		// the new agreement
 		agreements.push_back(agr);
 	}
 
-	std::vector<shared_ptr<Object>> objVassals = obj->getValue("vassal");
-	for (std::vector<shared_ptr<Object>>::iterator itr = objVassals.begin(); itr != objVassals.end(); ++itr)
+	std::vector<const commonItems::objectNode*> objVassals = obj->getValue("vassal");
+	for (std::vector<const commonItems::objectNode*>::iterator itr = objVassals.begin(); itr != objVassals.end(); ++itr)
 	{
 		EU4Agreement agr(*itr);		// the new agreement
 		agreements.push_back(agr);
 	}
 
-	std::vector<shared_ptr<Object>> objProtectorate = obj->getValue("protectorate");
-	for (std::vector<shared_ptr<Object>>::iterator itr = objProtectorate.begin(); itr != objProtectorate.end(); ++itr)
+	std::vector<const commonItems::objectNode*> objProtectorate = obj->getValue("protectorate");
+	for (std::vector<const commonItems::objectNode*>::iterator itr = objProtectorate.begin(); itr != objProtectorate.end(); ++itr)
 	{
 		EU4Agreement agr(*itr);		// the new agreement
 		agreements.push_back(agr);
 	}
 
-	std::vector<shared_ptr<Object>> objColonial = obj->getValue("is_colonial");
-	for (std::vector<shared_ptr<Object>>::iterator itr = objColonial.begin(); itr != objColonial.end(); ++itr)
+	std::vector<const commonItems::objectNode*> objColonial = obj->getValue("is_colonial");
+	for (std::vector<const commonItems::objectNode*>::iterator itr = objColonial.begin(); itr != objColonial.end(); ++itr)
 	{
 		EU4Agreement agr(*itr);		// the new agreement
 		agreements.push_back(agr);
 	}
 
-	std::vector<shared_ptr<Object>> objMarch = obj->getValue("is_march");
-	for (std::vector<shared_ptr<Object>>::iterator itr = objMarch.begin(); itr != objMarch.end(); ++itr)
+	std::vector<const commonItems::objectNode*> objMarch = obj->getValue("is_march");
+	for (std::vector<const commonItems::objectNode*>::iterator itr = objMarch.begin(); itr != objMarch.end(); ++itr)
 	{
 		EU4Agreement agr(*itr);		// the new agreement
 		agreements.push_back(agr);
 	}
 
-	std::vector<shared_ptr<Object>> objSpheres = obj->getValue("sphere");
-	for (std::vector<shared_ptr<Object>>::iterator itr = objSpheres.begin(); itr != objSpheres.end(); ++itr)
+	std::vector<const commonItems::objectNode*> objSpheres = obj->getValue("sphere");
+	for (std::vector<const commonItems::objectNode*>::iterator itr = objSpheres.begin(); itr != objSpheres.end(); ++itr)
 	{
 		EU4Agreement agr(*itr);		// the new agreement
 		agreements.push_back(agr);
 	}
 
-	std::vector<shared_ptr<Object>> objAlliances = obj->getValue("alliance");
-	for (std::vector<shared_ptr<Object>>::iterator itr = objAlliances.begin(); itr != objAlliances.end(); ++itr)
+	std::vector<const commonItems::objectNode*> objAlliances = obj->getValue("alliance");
+	for (std::vector<const commonItems::objectNode*>::iterator itr = objAlliances.begin(); itr != objAlliances.end(); ++itr)
 	{
 		EU4Agreement agr(*itr);		// the new agreement
 		agreements.push_back(agr);
 	}
 
-	std::vector<shared_ptr<Object>> objUnions = obj->getValue("union");
-	for (std::vector<shared_ptr<Object>>::iterator itr = objUnions.begin(); itr != objUnions.end(); ++itr)
+	std::vector<const commonItems::objectNode*> objUnions = obj->getValue("union");
+	for (std::vector<const commonItems::objectNode*>::iterator itr = objUnions.begin(); itr != objUnions.end(); ++itr)
 	{
 		EU4Agreement agr(*itr);		// the new agreement
 		agreements.push_back(agr);
 	}
 
-	std::vector<shared_ptr<Object>> objDependencies = obj->getValue("dependency");
-	for (std::vector<shared_ptr<Object>>::iterator itr = objDependencies.begin(); itr != objDependencies.end(); ++itr)
+	std::vector<const commonItems::objectNode*> objDependencies = obj->getValue("dependency");
+	for (std::vector<const commonItems::objectNode*>::iterator itr = objDependencies.begin(); itr != objDependencies.end(); ++itr)
 	{
 		EU4Agreement agr(*itr);		// the new agreement
 		agreements.push_back(agr);
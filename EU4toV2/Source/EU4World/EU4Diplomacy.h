@@ -32,13 +32,16 @@ using namespace std;
 
 
 
-class Object;
+namespace commonItems
+{
+	class objectNode;
+}
 
 
 
 struct EU4Agreement
 {
-	EU4Agreement(shared_ptr<Object> obj);
+	EU4Agreement(const commonItems::objectNode* obj);
 
 	string	type;			// the type of agreement
 	string	country1;	// the first country
@@ -51,7 +54,7 @@ class EU4Diplomacy
 {
 	public:
 		EU4Diplomacy();
-		EU4Diplomacy(shared_ptr<Object> obj);
+		EU4Diplomacy(const commonItems::objectNode* obj);
 		vector<EU4Agreement>	getAgreements() const { return agreements; };
 	private:
 		vector<EU4Agreement>	agreements;	// all the agreements
@@ -42,87 +42,87 @@ EU4::leader::leader(std::istream& theStream):
 	deathDate(),
 	id()
 {
-	registerKeyword(std::regex("name"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("name", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString nameString(theStream);
 			name = nameString.getString();
 		}
 	);
-	registerKeyword(std::regex("type"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("type", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString typeString(theStream);
 			type = typeString.getString();
 		}
 	);
-	registerKeyword(std::regex("female"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("female", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString unusedString(theStream);
 			female = true;
 		}
 	);
-	registerKeyword(std::regex("manuever"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("manuever", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleInt theValue(theStream);
 			manuever = theValue.getInt();
 		}
 	);
-	registerKeyword(std::regex("fire"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("fire", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleInt theValue(theStream);
 			fire = theValue.getInt();
 		}
 	);
-	registerKeyword(std::regex("shock"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("shock", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleInt theValue(theStream);
 			shock = theValue.getInt();
 		}
 	);
-	registerKeyword(std::regex("siege"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("siege", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleInt theValue(theStream);
 			siege = theValue.getInt();
 		}
 	);
-	registerKeyword(std::regex("country"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("country", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString countryString(theStream);
 			country = countryString.getString();
 		}
 	);
-	registerKeyword(std::regex("personality"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("personality", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString personalityString(theStream);
 			personality = personalityString.getString();
 		}
 	);
-	registerKeyword(std::regex("activation"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("activation", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString dateString(theStream);
 			date anActivationDate(dateString.getString());
 			activationDate = anActivationDate;
 		}
 	);
-	registerKeyword(std::regex("death_date"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("death_date", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleString dateString(theStream);
 			date aDeathDate(dateString.getString());
 			deathDate = aDeathDate;
 		}
 	);
-	registerKeyword(std::regex("id"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("id", [this](const std::string& unused, std::istream& theStream)
 		{
 			ID theID(theStream);
 			id = theID.getIDNum();
 		}
 	);
-	registerKeyword(std::regex("monarch_id"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("monarch_id", [this](const std::string& unused, std::istream& theStream)
 		{
 			ID theID(theStream);
 			monarchID = theID.getIDNum();
 		}
 	);
-	registerKeyword(std::regex("dynasty"), commonItems::ignoreString);
+	registerKeyword("dynasty", commonItems::ignoreString);
 
 	parseStream(theStream);
 }
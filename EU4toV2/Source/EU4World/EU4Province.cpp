@@ -24,14 +24,96 @@ THE SOFTWARE. */
 #include "EU4Country.h"
 #include "EU4Religion.h"
 #include "Log.h"
-#include "Object.h"
+#include "OSCompatibilityLayer.h"
+#include "ParserHelpers.h"
 #include "../Configuration.h"
 #include <algorithm>
 #include <fstream>
 
 
 
-EU4Province::EU4Province(shared_ptr<Object> obj)
+namespace
+{
+
+// One entry in a province's history, such as 1444.11.11 = { owner = SWE culture = swedish }
+struct historyEntry
+{
+	std::optional<std::string> owner;
+	std::optional<std::string> culture;
+	std::optional<std::string> religion;
+};
+
+
+void setIfUnset(std::optional<std::string>& value, std::istream& theStream)
+{
+	commonItems::singleString theString(theStream);
+	if (!value)
+	{
+		value = theString.getString();
+	}
+}
+
+
+// Entries that are not blocks, such as add_core = SWE, change none of the owner, culture or religion
+historyEntry readHistoryEntry(std::istream& theStream)
+{
+	historyEntry entry;
+
+	std::string storage;
+	commonItems::getNextLexemeView(theStream, storage); // equals
+	if (commonItems::getNextLexemeView(theStream, storage) != "{")
+	{
+		return entry;
+	}
+
+	commonItems::parseTokens(theStream, storage, [&entry, &theStream](std::string_view token)
+	{
+		if (token == "owner")
+		{
+			setIfUnset(entry.owner, theStream);
+		}
+		else if (token == "culture")
+		{
+			setIfUnset(entry.culture, theStream);
+		}
+		else if (token == "religion")
+		{
+			setIfUnset(entry.religion, theStream);
+		}
+		else if (token.empty() || (token == "=") || (token == "{") || (token == "}"))
+		{
+			return false;
+		}
+		else
+		{
+			commonItems::ignoreItem(std::string(token), theStream);
+		}
+		return true;
+	}, 1);
+
+	return entry;
+}
+
+
+// buildings that are stored as building = yes in older saves
+const char* const simpleBuildings[] = {
+	// unique buildings
+	"march", "glorious_monument", "royal_palace", "admiralty", "war_college", "embassy", "tax_assessor",
+	"grain_depot", "university", "fine_arts_academy",
+	// manufactories
+	"weapons", "wharf", "textile", "refinery", "plantations", "farm_estate", "tradecompany",
+	// base buildings
+	"fort1", "fort2", "fort3", "fort4", "fort5", "fort6", "dock", "drydock", "shipyard", "grand_shipyard",
+	"naval_arsenal", "naval_base", "temple", "courthouse", "spy_agency", "town_hall", "college", "cathedral",
+	"armory", "training_fields", "barracks", "regimental_camp", "arsenal", "conscription_center", "constable",
+	"workshop", "counting_house", "treasury_office", "mint", "stock_exchange", "customs_house", "marketplace",
+	"trade_depot", "canal", "road_network", "post_office"
+};
+
+}
+
+
+EU4Province::EU4Province(const string& numString, istream& theStream)
 {
 	provTaxIncome = 0;
 	provProdIncome = 0;
@@ -43,19 +125,24 @@ EU4Province::EU4Province(shared_ptr<Object> obj)
 
 	numV2Provs = 0;
 
-	num = 0 - atoi(obj->getKey().c_str());
+	num = 0 - atoi(numString.c_str());
+	baseTax = 0.0f;
+	baseProd = 0.0f;
+	manpower = 0.0f;
+	inHRE = false;
+	colony = false;
+	owner = NULL;
 
-	vector<shared_ptr<Object>> baseTaxObjs;			// the object holding the base tax
-	baseTaxObjs = obj->getValue("base_tax");
-	baseTax = (baseTaxObjs.size() > 0) ? atof(baseTaxObjs[0]->getLeaf().c_str()) : 0.0f;
+	coresBlocks = 0;
 
-	vector<shared_ptr<Object>> baseProdObjs;			// the object holding the base production
-	baseProdObjs = obj->getValue("base_production");
-	baseProd = (baseProdObjs.size() > 0) ? atof(baseProdObjs[0]->getLeaf().c_str()) : 0.0f;
+	getSchema().parseStream(*this, theStream);
 
-	vector<shared_ptr<Object>> baseManpowerObjs;		// the object holding the base manpower
-	baseManpowerObjs = obj->getValue("base_manpower");
-	manpower = (baseManpowerObjs.size() > 0) ? atof(baseManpowerObjs[0]->getLeaf().c_str()) : 0.0f;
+	// a single cores block holds every core, otherwise they're listed one by one
+	if (coresBlocks != 1)
+	{
+		cores = std::move(singleCores);
+	}
+	singleCores = vector<string>();
 
 	// for old versions of EU4 (< 1.12), copy tax to production if necessary
 	if (baseProd == 0.0f && baseTax > 0.0f)
@@ -63,239 +150,212 @@ EU4Province::EU4Province(shared_ptr<Object> obj)
 		baseProd = baseTax;
 	}
 
-	vector<shared_ptr<Object>> ownerObjs;				// the object holding the owner
-	ownerObjs = obj->getValue("owner");
-	(ownerObjs.size() == 0) ? ownerString = "" : ownerString = ownerObjs[0]->getLeaf();
-	owner = NULL;
+	sort(ownershipHistory.begin(), ownershipHistory.end());
+	sort(cultureHistory.begin(), cultureHistory.end());
+	sort(religionHistory.begin(), religionHistory.end());
 
-	cores.clear();
-	vector<shared_ptr<Object>> coreObjs;				// the object holding the cores
-	coreObjs = obj->getValue("cores");					
-	if (coreObjs.size() != 1)
-	{
-		coreObjs = obj->getValue("core");				// pre 1.23 cores
-		for (unsigned int i = 0; i < coreObjs.size(); i++)
-		{
-			cores.push_back(coreObjs[i]->getLeaf());
-		}
-	}
-	else
+	if (num == 1)
 	{
-		vector<string> coreStrs = coreObjs[0]->getTokens();// 1.23 onwards
-		for (auto coreStr : coreStrs)
-		{
-			cores.push_back(coreStr);
-		}
+		Configuration::setFirstEU4Date(ownershipHistory[0].first);
 	}
 
-
-
-	vector<shared_ptr<Object>> hreObj = obj->getValue("hre");
-	if ((hreObj.size() > 0) && (hreObj[0]->getLeaf() == "yes"))
+	if ((cultureHistory.size() == 0) && currentCulture)
 	{
-		inHRE = true;
+		const date newDate;	// the default date
+		cultureHistory.push_back(make_pair(newDate, *currentCulture));
 	}
-	else
+	if ((religionHistory.size() == 0) && currentReligion)
 	{
-		inHRE = false;
+		const date newDate;	// the default date
+		religionHistory.push_back(make_pair(newDate, *currentReligion));
 	}
 
-	colony = false;
+	buildPopRatios();
+}
 
-	ownershipHistory.clear();
-	lastPossessedDate.clear();
-	religionHistory.clear();
-	cultureHistory.clear();
-	vector<shared_ptr<Object>> historyObj = obj->getValue("history");				// the objects holding the history of this province
-	if (historyObj.size() > 0)
-	{
-		vector<shared_ptr<Object>> historyObjs = historyObj[0]->getLeaves();		// the object holding the current history point
-		string lastOwner;				// the last owner of the province
-		string thisCountry;			// the current owner of the province
-		for (unsigned int i = 0; i < historyObjs.size(); i++)
-		{
-			if (historyObjs[i]->getKey() == "owner")
+
+const commonItems::parserSchema<EU4Province>& EU4Province::getSchema()
+{
+	static const auto theSchema = []()
+	{
+		commonItems::parserSchema<EU4Province> schema;
+		schema.registerFirstKeyword("base_tax", [](EU4Province& province, const std::string& unused, std::istream& theStream)
 			{
-				thisCountry = historyObjs[i]->getLeaf();
-				lastOwner = thisCountry;
-				ownershipHistory.push_back(make_pair(date(), thisCountry));
-				continue;
+				commonItems::singleString baseTaxString(theStream);
+				province.baseTax = atof(baseTaxString.getString().c_str());
 			}
-			else if (historyObjs[i]->getKey() == "culture")
+		);
+		schema.registerFirstKeyword("base_production", [](EU4Province& province, const std::string& unused, std::istream& theStream)
 			{
-				cultureHistory.push_back(make_pair(date(), historyObjs[i]->getLeaf()));
-				continue;
+				commonItems::singleString baseProdString(theStream);
+				province.baseProd = atof(baseProdString.getString().c_str());
 			}
-			else if (historyObjs[i]->getKey() == "religion")
+		);
+		schema.registerFirstKeyword("base_manpower", [](EU4Province& province, const std::string& unused, std::istream& theStream)
 			{
-				religionHistory.push_back(make_pair(date(), historyObjs[i]->getLeaf()));
-				continue;
+				commonItems::singleString baseManpowerString(theStream);
+				auto baseManpower = atof(baseManpowerString.getString().c_str());
+				if (baseManpower != 0.0f)
+				{
+					province.manpower = baseManpower;
+				}
 			}
-
-			vector<shared_ptr<Object>> ownerObj = historyObjs[i]->getValue("owner");	// the object holding the current historical owner change
-			if (ownerObj.size() > 0)
+		);
+		// if we don't have base manpower (EU4 < 1.12), use manpower instead
+		schema.registerFirstKeyword("manpower", [](EU4Province& province, const std::string& unused, std::istream& theStream)
 			{
-				const date newDate(historyObjs[i]->getKey());	// the date this happened
-				thisCountry = ownerObj[0]->getLeaf();
-
-				map<string, date>::iterator itr = lastPossessedDate.find(lastOwner);
-				if (itr != lastPossessedDate.end())
-					itr->second = newDate;
-				else
-					lastPossessedDate.insert(make_pair(lastOwner, newDate));
-				lastOwner = thisCountry;
-
-				ownershipHistory.push_back(make_pair(newDate, thisCountry));
+				commonItems::singleString manpowerString(theStream);
+				if (province.manpower == 0.0f)
+				{
+					province.manpower = stod(manpowerString.getString());
+				}
+			}
+		);
+		schema.registerFirstKeyword("owner", [](EU4Province& province, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleString ownerString(theStream);
+				province.ownerString = ownerString.getString();
+			}
+		);
+		schema.registerKeyword("cores", [](EU4Province& province, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::stringList coreStrings(theStream);	// 1.23 onwards
+				if (++province.coresBlocks == 1)
+				{
+					province.cores = coreStrings.getStrings();
+				}
+			}
+		);
+		schema.registerKeyword("core", [](EU4Province& province, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleString coreString(theStream);	// pre 1.23 cores
+				province.singleCores.push_back(coreString.getString());
+			}
+		);
+		schema.registerFirstKeyword("hre", [](EU4Province& province, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleString hreString(theStream);
+				province.inHRE = (hreString.getString() == "yes");
+			}
+		);
+		schema.registerKeyword("history", [](EU4Province& province, const std::string& unused, std::istream& theStream)
+			{
+				province.readHistory(theStream);
 			}
-			vector<shared_ptr<Object>> culObj = historyObjs[i]->getValue("culture");	// the object holding the current historical culture change
-			if (culObj.size() > 0)
+		);
+		schema.registerKeyword("culture", [](EU4Province& province, const std::string& unused, std::istream& theStream)
 			{
-				const date newDate(historyObjs[i]->getKey());	// the date this happened
-				cultureHistory.push_back(make_pair(newDate, culObj[0]->getLeaf()));
+				setIfUnset(province.currentCulture, theStream);
 			}
-			vector<shared_ptr<Object>> religObj = historyObjs[i]->getValue("religion");	// the object holding the current historical religion change
-			if (religObj.size() > 0)
+		);
+		schema.registerKeyword("religion", [](EU4Province& province, const std::string& unused, std::istream& theStream)
 			{
-				const date newDate(historyObjs[i]->getKey());	// the date this happened
-				religionHistory.push_back(make_pair(newDate, religObj[0]->getLeaf()));
+				setIfUnset(province.currentReligion, theStream);
 			}
+		);
+		schema.registerFirstKeyword("trade_goods", [](EU4Province& province, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleString tradeGoodsString(theStream);
+				province.tradeGoods = tradeGoodsString.getString();
+			}
+		);
+		schema.registerFirstKeyword("name", [](EU4Province& province, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleString nameString(theStream);
+				province.provName = Utils::convert8859_15ToUTF8(nameString.getString());
+			}
+		);
+		schema.registerFirstKeyword("great_projects", [](EU4Province& province, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::stringList projectStrings(theStream);
+				for (const auto& project: projectStrings.getStrings())
+				{
+					province.buildings[project] = true;
+				}
+			}
+		);
+		for (auto building: simpleBuildings)
+		{
+			schema.registerFirstKeyword(building, [](EU4Province& province, const std::string& buildingName, std::istream& theStream)
+				{
+					commonItems::singleString buildingString(theStream);
+					if (buildingString.getString() == "yes")
+					{
+						province.buildings[buildingName] = true;
+					}
+				}
+			);
 		}
-	}
-	sort(ownershipHistory.begin(), ownershipHistory.end());
-	sort(cultureHistory.begin(), cultureHistory.end());
-	sort(religionHistory.begin(), religionHistory.end());
+		schema.registerRegex("[A-Za-z0-9\\_]+", commonItems::ignoreItem);
+		return schema;
+	}();
+
+	return theSchema;
+}
 
-	if (num == 1)
-	{
-		Configuration::setFirstEU4Date(ownershipHistory[0].first);
-	}
 
-	if (cultureHistory.size() == 0)
+void EU4Province::readHistory(istream& theStream)
+{
+	string lastOwner;				// the last owner of the province
+	string thisCountry;			// the current owner of the province
+
+	std::string storage;
+	commonItems::parseTokens(theStream, storage, [&](std::string_view token)
 	{
-		vector<shared_ptr<Object>> culObj = obj->getValue("culture");	// the object holding the current culture
-		if (culObj.size() > 0)
+		if (token.empty() || (token == "=") || (token == "{") || (token == "}"))
 		{
-			const date newDate;	// the default date
-			cultureHistory.push_back(make_pair(newDate, culObj[0]->getLeaf()));
+			return false;
 		}
-	}
-	if (religionHistory.size() == 0)
-	{
-		vector<shared_ptr<Object>> religObj = obj->getValue("religion");	// the object holding the current religion
-		if (religObj.size() > 0)
+
+		if (token == "owner")
 		{
-			const date newDate;	// the default date
-			religionHistory.push_back(make_pair(newDate, religObj[0]->getLeaf()));
+			commonItems::singleString ownerString(theStream);
+			thisCountry = ownerString.getString();
+			lastOwner = thisCountry;
+			ownershipHistory.push_back(make_pair(date(), thisCountry));
+			return true;
+		}
+		else if (token == "culture")
+		{
+			commonItems::singleString cultureString(theStream);
+			cultureHistory.push_back(make_pair(date(), cultureString.getString()));
+			return true;
+		}
+		else if (token == "religion")
+		{
+			commonItems::singleString religionString(theStream);
+			religionHistory.push_back(make_pair(date(), religionString.getString()));
+			return true;
 		}
-	}
-
-	popRatios.clear();
-	buildings.clear();
 
-	vector<shared_ptr<Object>> tradegoodsObj = obj->getValue("trade_goods");
-	if (tradegoodsObj.size() > 0) 
-	{
-		tradeGoods = tradegoodsObj[0]->getLeaf();
-	}
-	else
-	{
-		tradeGoods = "";
-	}
+		const std::string key(token);
+		auto entry = readHistoryEntry(theStream);
+		if (entry.owner)
+		{
+			const date newDate(key);	// the date this happened
+			thisCountry = *entry.owner;
 
-	vector<shared_ptr<Object>> provNameObj = obj->getValue("name");
-	if (provNameObj.size() > 0)
-	{
-		provName = provNameObj[0]->getLeaf();
-	}
-	else
-	{
-		provName = "";
-	}
+			map<string, date>::iterator itr = lastPossessedDate.find(lastOwner);
+			if (itr != lastPossessedDate.end())
+				itr->second = newDate;
+			else
+				lastPossessedDate.insert(make_pair(lastOwner, newDate));
+			lastOwner = thisCountry;
 
-	// if we didn't have base manpower (EU4 < 1.12), check for manpower instead
-	if (manpower == 0.0f)
-	{
-		vector<shared_ptr<Object>> manpowerObj = obj->getValue("manpower");
-		if (manpowerObj.size() > 0)
+			ownershipHistory.push_back(make_pair(newDate, thisCountry));
+		}
+		if (entry.culture)
 		{
-			string manpowerStr = manpowerObj[0]->getLeaf();
-			manpower = stod(manpowerStr);
+			const date newDate(key);	// the date this happened
+			cultureHistory.push_back(make_pair(newDate, *entry.culture));
 		}
-	}
-
-	// great projects
-	vector<shared_ptr<Object>> projectsObj = obj->getValue("great_projects");
-	if (projectsObj.size() > 0)
-	{
-		for (const auto& proj : projectsObj[0]->getTokens())
+		if (entry.religion)
 		{
-			buildings[proj] = true;
+			const date newDate(key);	// the date this happened
+			religionHistory.push_back(make_pair(newDate, *entry.religion));
 		}
-	}
-
-	//LOG(LogLevel::Info) << "Check unique Buildings...";
-	// unique buildings
-	checkBuilding(obj, "march");
-	checkBuilding(obj, "glorious_monument");
-	checkBuilding(obj, "royal_palace");
-	checkBuilding(obj, "admiralty");
-	checkBuilding(obj, "war_college");
-	checkBuilding(obj, "embassy");
-	checkBuilding(obj, "tax_assessor");
-	checkBuilding(obj, "grain_depot");
-	checkBuilding(obj, "university");
-	checkBuilding(obj, "fine_arts_academy");
-
-	//LOG(LogLevel::Info) << "Check manus...";
-	// Manufacturies
-	checkBuilding(obj, "weapons");
-	checkBuilding(obj, "wharf");
-	checkBuilding(obj, "textile");
-	checkBuilding(obj, "refinery");
-	checkBuilding(obj, "plantations");
-	checkBuilding(obj, "farm_estate");
-	checkBuilding(obj, "tradecompany");
-
-	//LOG(LogLevel::Info) << "Check buildings...";
-	// base buildings 
-	checkBuilding(obj, "fort1");
-	checkBuilding(obj, "fort2");
-	checkBuilding(obj, "fort3");
-	checkBuilding(obj, "fort4");
-	checkBuilding(obj, "fort5");
-	checkBuilding(obj, "fort6");
-	checkBuilding(obj, "dock");
-	checkBuilding(obj, "drydock");
-	checkBuilding(obj, "shipyard");
-	checkBuilding(obj, "grand_shipyard");
-	checkBuilding(obj, "naval_arsenal");
-	checkBuilding(obj, "naval_base");
-	checkBuilding(obj, "temple");
-	checkBuilding(obj, "courthouse");
-	checkBuilding(obj, "spy_agency");
-	checkBuilding(obj, "town_hall");
-	checkBuilding(obj, "college");
-	checkBuilding(obj, "cathedral");
-	checkBuilding(obj, "armory");
-	checkBuilding(obj, "training_fields");
-	checkBuilding(obj, "barracks");
-	checkBuilding(obj, "regimental_camp");
-	checkBuilding(obj, "arsenal");
-	checkBuilding(obj, "conscription_center");
-	checkBuilding(obj, "constable");
-	checkBuilding(obj, "workshop");
-	checkBuilding(obj, "counting_house");
-	checkBuilding(obj, "treasury_office");
-	checkBuilding(obj, "mint");
-	checkBuilding(obj, "stock_exchange");
-	checkBuilding(obj, "customs_house");
-	checkBuilding(obj, "marketplace");
-	checkBuilding(obj, "trade_depot");
-	checkBuilding(obj, "canal");
-	checkBuilding(obj, "road_network");
-	checkBuilding(obj, "post_office");
-
-	buildPopRatios();
+		return true;
+	});
 }
 
 
@@ -415,23 +475,15 @@ double EU4Province::getCulturePercent(string culture)
 }
 
 
-void EU4Province::checkBuilding(const shared_ptr<Object> provinceObj, string building)
-{
-	vector<shared_ptr<Object>> buildingObj;	// the object holding the building
-	buildingObj = provinceObj->getValue(building);
-	if ((buildingObj.size() > 0) && (buildingObj[0]->getLeaf() == "yes"))
-	{
-		buildings[building] = true;
-	}
-}
-
-
 void EU4Province::buildPopRatios()
 {
+	constexpr date earliestEndDate("1821.1.1");
+	constexpr date afterAllHistory("2000.1.1");
+
 	date endDate = Configuration::getLastEU4Date();
-	if (endDate < date("1821.1.1"))
+	if (endDate < earliestEndDate)
 	{
-		endDate = date("1821.1.1");
+		endDate = earliestEndDate;
 	}
 	date cutoffDate = endDate;
 	cutoffDate.subtractYears(200);
@@ -474,7 +526,7 @@ void EU4Province::buildPopRatios()
 	{
 		if (cItr == cultureHistory.end())
 		{
-			cDate = date("2000.1.1");
+			cDate = afterAllHistory;
 		}
 		else
 		{
@@ -482,7 +534,7 @@ void EU4Province::buildPopRatios()
 		}
 		if (rItr == religionHistory.end())
 		{
-			rDate = date("2000.1.1");
+			rDate = afterAllHistory;
 		}
 		else
 		{
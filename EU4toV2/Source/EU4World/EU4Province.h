@@ -26,6 +26,9 @@ THE SOFTWARE. */
 
 
 #include "Date.h"
+#include "newParser.h"
+#include <istream>
+#include <optional>
 #include <string>
 #include <vector>
 #include <map>
@@ -34,8 +37,6 @@ using namespace std;
 
 
 
-class Object;
-
 namespace EU4
 {
 	class Country;
@@ -56,7 +57,7 @@ struct EU4PopRatio
 class EU4Province
 {
 	public:
-		EU4Province(shared_ptr<Object> obj);
+		EU4Province(const string& numString, istream& theStream);
 
 		void						addCore(string tag);
 		void						removeCore(string tag);
@@ -95,7 +96,9 @@ class EU4Province
 		string					getTradeGoods() const { return tradeGoods; }
 
 	private:
-		void	checkBuilding(const shared_ptr<Object> provinceObj, string building);
+		static const commonItems::parserSchema<EU4Province>& getSchema();
+
+		void	readHistory(istream& theStream);
 		void	buildPopRatios();
 		void	decayPopRatios(date oldDate, date newDate, EU4PopRatio& currentPop);
 
@@ -112,12 +115,16 @@ class EU4Province
 		string								provName;
 		std::shared_ptr<EU4::Country> owner;
 		vector<string>						cores;					// strings of the tags of all cores
+		vector<string>						singleCores;			// core = TAG entries, only kept while parsing
+		int									coresBlocks;			// the number of cores = { ... } blocks, only used while parsing
 		bool									inHRE;					// whether or not this province is in the HRE
 		bool									colony;					// whether or not this is a colony
 		vector< pair<date, string> >	ownershipHistory;		// the history of who has owned this province
 		map<string, date>					lastPossessedDate;	// the last date the province was owned by different tags
 		vector< pair<date, string> >	religionHistory;		// the history of the religious changes of this province
 		vector< pair<date, string> >	cultureHistory;		// the history of the cultural changes of this province
+		optional<string>					currentCulture;		// the culture outside of the history, used if the history has none
+		optional<string>					currentReligion;		// the religion outside of the history, used if the history has none
 		vector<EU4PopRatio>				popRatios;				// the population ratios of this province
 		map<string, bool>					buildings;				// the buildings in this province
 
@@ -29,13 +29,13 @@ EU4::ID::ID(std::istream& theStream):
 	IDNum(),
 	type()
 {
-	registerKeyword(std::regex("id"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("id", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleInt theNum(theStream);
 			IDNum = theNum.getInt();
 		}
 	);
-	registerKeyword(std::regex("type"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("type", [this](const std::string& unused, std::istream& theStream)
 		{
 			commonItems::singleInt theNum(theStream);
 			type = theNum.getInt();
@@ -31,8 +31,8 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 EU4::region::region(std::istream& theStream)
 {
 	commonItems::parsingFunction areasFunction = std::bind(&EU4::region::importAreas, this, std::placeholders::_1, std::placeholders::_2);
-	registerKeyword(std::regex("areas"), areasFunction);
-	registerKeyword(std::regex("discover_if"), commonItems::ignoreObject);
+	registerKeyword("areas", areasFunction);
+	registerKeyword("discover_if", commonItems::ignoreObject);
 	parseStream(theStream);
 }
 
@@ -45,7 +45,7 @@ EU4::region::region(std::set<int> _provinces):
 
 void EU4::region::importAreas(const std::string& unused, std::istream& theStream)
 {
-	registerKeyword(std::regex("\\w+"), [this](const std::string& areaName, std::istream& areasFile)
+	registerRegex("\\w+", [this](const std::string& areaName, std::istream& areasFile)
 		{
 			areaNames.insert(areaName);
 		}
@@ -113,7 +113,7 @@ void EU4::Regions::initEU4RegionsFile(const EU4::areas& areas, const std::string
 {
 	regions.clear();
 
-	registerKeyword(std::regex("\\w+_region"), [this, areas](const std::string& areaName, std::istream& areasFile)
+	registerRegex("\\w+_region", [this, areas](const std::string& areaName, std::istream& areasFile)
 		{
 			EU4::region newRegion(areasFile);
 			newRegion.addProvinces(areas);
@@ -29,11 +29,14 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "OSCompatibilityLayer.h"
 #include "NewParserToOldParserConverters.h"
 #include "ParserHelpers.h"
+#include "ParserProfiling.h"
+#include "PhaseTimer.h"
 #include "../Configuration.h"
 #include "../Mappers/CultureMapper.h"
 #include "../Mappers/ProvinceMapper.h"
 #include "../Mappers/ReligionMapper.h"
 #include "Object.h"
+#include "ObjectTree.h"
 #include "ParadoxParserUTF8.h"
 #include "Countries.h"
 #include "CultureGroups.h"
@@ -50,91 +53,95 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 EU4::world::world(const string& EU4SaveFileName):
 	theCountries()
 {
-	registerKeyword(std::regex("EU4txt"), [this](const std::string& unused, std::istream& theStream){});
-	registerKeyword(std::regex("date"), [this](const std::string& dateText, std::istream& theStream)
+	registerKeyword("EU4txt", [this](const std::string& unused, std::istream& theStream){});
+	registerKeyword("date", [this](const std::string& dateText, std::istream& theStream)
 		{
 			commonItems::singleString dateString(theStream);
 			date endDate(dateString.getString());
 			Configuration::setLastEU4Date(endDate);
 		}
 	);
-	registerKeyword(std::regex("savegame_version"), [this](const std::string& versionText, std::istream& theStream)
+	registerKeyword("savegame_version", [this](const std::string& versionText, std::istream& theStream)
 		{
 			auto versionObject = commonItems::convert8859Object(versionText, theStream);
 			loadEU4Version(versionObject);
 		}
 	);
-	registerKeyword(std::regex("dlc_enabled"), [this](const std::string& DLCText, std::istream& theStream)
+	registerKeyword("dlc_enabled", [this](const std::string& DLCText, std::istream& theStream)
 		{
 			auto versionsObject = commonItems::convert8859Object(DLCText, theStream);
 			loadActiveDLC(versionsObject);
 		}
 	);
-	registerKeyword(std::regex("mod_enabled"), [this](const std::string& modText, std::istream& theStream)
+	registerKeyword("mod_enabled", [this](const std::string& modText, std::istream& theStream)
 		{
 			auto modsObject = commonItems::convert8859Object(modText, theStream);
 			loadUsedMods(modsObject);
 		}
 	);
-	registerKeyword(std::regex("revolution_target"), [this](const std::string& revolutionText, std::istream& theStream)
+	registerKeyword("revolution_target", [this](const std::string& revolutionText, std::istream& theStream)
 		{
 			auto modsObject = commonItems::convert8859String(revolutionText, theStream);
 			loadRevolutionTargetString(modsObject);
 		}
 	);
-	registerKeyword(std::regex("empire"), [this](const std::string& empireText, std::istream& theStream)
+	registerKeyword("empire", [this](const std::string& empireText, std::istream& theStream)
 		{
-			auto empireObject = commonItems::convert8859Object(empireText, theStream);
-			loadEmpires(empireObject);
+			commonItems::objectTree empireTree(empireText, theStream);
+			loadEmpires(empireTree.getTopLevel());
 		}
 	);
-	registerKeyword(std::regex("emperor"), [this](const std::string& emperorText, std::istream& theStream)
+	registerKeyword("emperor", [this](const std::string& emperorText, std::istream& theStream)
 		{
-			auto emperorObject = commonItems::convert8859Object(emperorText, theStream);
-			loadEmpires(emperorObject);
+			commonItems::objectTree emperorTree(emperorText, theStream);
+			loadEmpires(emperorTree.getTopLevel());
 		}
 	);
-	registerKeyword(std::regex("celestial_empire"), [this](const std::string& empireText, std::istream& theStream)
+	registerKeyword("celestial_empire", [this](const std::string& empireText, std::istream& theStream)
 		{
-			auto empireObject = commonItems::convert8859Object(empireText, theStream);
-			loadEmpires(empireObject);
+			commonItems::objectTree empireTree(empireText, theStream);
+			loadEmpires(empireTree.getTopLevel());
 		}
 	);
-	registerKeyword(std::regex("provinces"), [this](const std::string& provincesText, std::istream& theStream)
+	registerKeyword("provinces", [this](const std::string&, std::istream& theStream) { loadProvinces(theStream); } );
+	registerKeyword("countries", [this](const std::string& countriesText, std::istream& theStream) { loadCountries(theStream);	} );
+	registerKeyword("diplomacy", [this](const std::string& diplomacyText, std::istream& theStream)
 		{
-			auto provincesObject = commonItems::convert8859Object(provincesText, theStream);
-			loadProvinces(provincesObject);
+			commonItems::objectTree diplomacyTree(diplomacyText, theStream);
+			loadDiplomacy(diplomacyTree.getTopLevel());
 		}
 	);
-	registerKeyword(std::regex("countries"), [this](const std::string& countriesText, std::istream& theStream) { loadCountries(theStream);	} );
-	registerKeyword(std::regex("diplomacy"), [this](const std::string& diplomacyText, std::istream& theStream)
-		{
-			auto diplomacyObject = commonItems::convert8859Object(diplomacyText, theStream);
-			loadDiplomacy(diplomacyObject);
-		}
-	);
-	registerKeyword(std::regex("[A-Za-z0-9\\_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9\\_]+", commonItems::ignoreItem);
 
 	LOG(LogLevel::Info) << "* Importing EU4 save *";
+	commonItems::phaseTimer phase("Parsing save");
 	verifySave(EU4SaveFileName);
 	parseFile(EU4SaveFileName);
 
 	LOG(LogLevel::Info) << "Building world";
+	phase.next("Building world");
 	setEmpires();
 	addProvinceInfoToCountries();
+	phase.next("Determining province weights");
 	determineProvinceWeights();
 	checkAllEU4CulturesMapped();
+	phase.next("Reading common countries");
 	readCommonCountries();
+	phase.next("Setting localisations");
 	setLocalisations();
+	phase.next("Resolving regiment types");
 	resolveRegimentTypes();
+	phase.next("Merging nations");
 	mergeNations();
 	checkAllProvincesMapped();
 	setNumbersOfDestinationProvinces();
 	loadRevolutionTarget();
 
+	phase.next("Reading religions");
 	EU4Religion::createSelf();
 	checkAllEU4ReligionsMapped();
 
+	phase.next("Removing nations");
 	removeEmptyNations();
 	if (Configuration::getRemovetype() == "dead")
 	{
@@ -144,6 +151,8 @@ EU4::world::world(const string& EU4SaveFileName):
 	{
 		removeLandlessNations();
 	}
+
+	commonItems::logParserProfile("the EU4 save and game data");
 }
 
 
@@ -294,7 +303,7 @@ void EU4::world::loadEU4ModDirectory(map<string, string>& possibleMods)
 				if ((name != "") && (path != ""))
 				{
 					possibleMods.insert(make_pair(name, EU4DocumentsLoc + "/" + path));
-					Log(LogLevel::Debug) << "\t\tFound a mod named " << name << " claiming to be at " << EU4DocumentsLoc << "/" << path;
+					LOG(LogLevel::Debug) << "\t\tFound a mod named " << name << " claiming to be at " << EU4DocumentsLoc << "/" << path;
 				}
 			}
 		}
@@ -378,29 +387,29 @@ void EU4::world::loadActiveDLC(const shared_ptr<Object> EU4SaveObj)
 }
 
 
-void EU4::world::loadEmpires(const shared_ptr<Object> EU4SaveObj)
+void EU4::world::loadEmpires(const commonItems::objectNode* EU4SaveObj)
 {
-	vector<shared_ptr<Object>> emperorObj = EU4SaveObj->getValue("emperor");
+	auto emperorObj = EU4SaveObj->getValue("emperor");
 	if (emperorObj.size() > 0)
 	{
 		holyRomanEmperor = emperorObj[0]->getLeaf();
 	}
 
-	vector<shared_ptr<Object>> empireObj = EU4SaveObj->getValue("empire");
+	auto empireObj = EU4SaveObj->getValue("empire");
 	if (empireObj.size() > 0)
 	{
 		loadHolyRomanEmperor(empireObj);
 	}
-	vector<shared_ptr<Object>> celestialEmpireObj = EU4SaveObj->getValue("celestial_empire");
+	auto celestialEmpireObj = EU4SaveObj->getValue("celestial_empire");
 	if (celestialEmpireObj.size() > 0)
 	{
 		loadCelestialEmperor(celestialEmpireObj);
 	}
 }
 
-void EU4::world::loadHolyRomanEmperor(vector<shared_ptr<Object>> empireObj)
+void EU4::world::loadHolyRomanEmperor(const vector<const commonItems::objectNode*>& empireObj)
 {
-	vector<shared_ptr<Object>> emperorObj = empireObj[0]->getValue("emperor");
+	auto emperorObj = empireObj[0]->getValue("emperor");
 	if (emperorObj.size() > 0)
 	{
 		holyRomanEmperor = emperorObj[0]->getLeaf();
@@ -408,38 +417,39 @@ void EU4::world::loadHolyRomanEmperor(vector<shared_ptr<Object>> empireObj)
 }
 
 
-void EU4::world::loadCelestialEmperor(vector<shared_ptr<Object>> celestialEmpireObj)
+void EU4::world::loadCelestialEmperor(const vector<const commonItems::objectNode*>& celestialEmpireObj)
 {
-	vector<shared_ptr<Object>> emperorObj = celestialEmpireObj[0]->getValue("emperor");
+	auto emperorObj = celestialEmpireObj[0]->getValue("emperor");
 	if (emperorObj.size() > 0)
 	{
 		celestialEmperor = emperorObj[0]->getLeaf();
 	}
 }
 
-void EU4::world::loadProvinces(const shared_ptr<Object> EU4SaveObj)
+void EU4::world::loadProvinces(istream& theStream)
 {
 	auto validProvinces = determineValidProvinces();
 
 	provinces.clear();
-	vector<shared_ptr<Object>> provincesObj = EU4SaveObj->getValue("provinces");					// the object holding the provinces
-	if (provincesObj.size() > 0)
-	{
-		vector<shared_ptr<Object>> provincesLeaves = provincesObj[0]->getLeaves();		// the objects holding the individual provinces
-		for (unsigned int j = 0; j < provincesLeaves.size(); j++)
+	commonItems::parser provincesParser;
+	provincesParser.registerRegex("-?[0-9]+", [this, &validProvinces](const std::string& keyProv, std::istream& theStream)
 		{
-			string keyProv = (provincesLeaves[j])->getKey();						// the key for the province
-
 			if (
 				(atoi(keyProv.c_str()) < 0) &&													// Check if key is a negative value (EU4 style)
 				(validProvinces.find(-1 * atoi(keyProv.c_str())) != validProvinces.end())	// check it's a valid province for this version of EU4
 				)
 			{
-				EU4Province* province = new EU4Province((provincesLeaves[j]));	// the province in our format
+				EU4Province* province = new EU4Province(keyProv, theStream);	// the province in our format
 				provinces.insert(make_pair(province->getNum(), province));
 			}
+			else
+			{
+				commonItems::ignoreItem(keyProv, theStream);
+			}
 		}
-	}
+	);
+	provincesParser.registerRegex("[A-Za-z0-9\\_]+", commonItems::ignoreItem);
+	provincesParser.parseStream(theStream);
 }
 
 
@@ -531,9 +541,9 @@ void EU4::world::addProvinceInfoToCountries()
 }
 
 
-void EU4::world::loadDiplomacy(const shared_ptr<Object> EU4SaveObj)
+void EU4::world::loadDiplomacy(const commonItems::objectNode* EU4SaveObj)
 {
-	vector<shared_ptr<Object>> diploObj = EU4SaveObj->getValue("diplomacy");	// the object holding the world's diplomacy
+	auto diploObj = EU4SaveObj->getValue("diplomacy");	// the object holding the world's diplomacy
 	if (diploObj.size() > 0)
 	{
 		diplomacy = new EU4Diplomacy(diploObj[0]);
@@ -960,7 +970,7 @@ void EU4::world::checkAllEU4ReligionsMapped() const
 		auto Vic2Religion = religionMapper::getVic2Religion(EU4Religion.first);
 		if (Vic2Religion == "")
 		{
-			Log(LogLevel::Warning) << "No religion mapping for EU4 religion " << EU4Religion.first;
+			LOG(LogLevel::Warning) << "No religion mapping for EU4 religion " << EU4Religion.first;
 		}
 	}
 }
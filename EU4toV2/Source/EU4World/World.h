@@ -67,19 +67,19 @@ namespace EU4
 
 			void loadEU4Version(const shared_ptr<Object> EU4SaveObj);
 			void loadActiveDLC(const shared_ptr<Object> EU4SaveObj);
-			void loadEmpires(const shared_ptr<Object> EU4SaveObj);
-			void loadHolyRomanEmperor(vector<shared_ptr<Object>> empireObj);
-			void loadCelestialEmperor(vector<shared_ptr<Object>> celestialEmpireObj);
+			void loadEmpires(const commonItems::objectNode* EU4SaveObj);
+			void loadHolyRomanEmperor(const vector<const commonItems::objectNode*>& empireObj);
+			void loadCelestialEmperor(const vector<const commonItems::objectNode*>& celestialEmpireObj);
 
 
-			void loadProvinces(const shared_ptr<Object> EU4SaveObj);
+			void loadProvinces(istream& theStream);
 			map<int, int> determineValidProvinces();
 
 			void loadCountries(istream& theStream);
 			void loadRevolutionTargetString(const shared_ptr<Object> EU4SaveObj);
 			void loadRevolutionTarget();
 			void addProvinceInfoToCountries();
-			void loadDiplomacy(const shared_ptr<Object> EU4SaveObj);
+			void loadDiplomacy(const commonItems::objectNode* EU4SaveObj);
 			void determineProvinceWeights();
 
 			void checkAllEU4CulturesMapped() const;
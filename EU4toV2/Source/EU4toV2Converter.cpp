@@ -22,26 +22,28 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 #include <stdexcept>
+#include "CommandLine.h"
 #include "Configuration.h"
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
+#include "PhaseTimer.h"
 #include "EU4World/World.h"
 #include "V2World/V2World.h"
 
 
 
-string getSaveFileName(const int argc, const char * argv[]);
-void ConvertEU4ToV2(const string& EU4SaveFileName);
+void ConvertEU4ToV2(const string& EU4SaveFileName, const string& commandLineLogLevel);
 int main(const int argc, const char * argv[])
 {
 	try
 	{
+		string commandLineLogLevel = commonItems::getCommandLineLogLevel(argc, argv);
 		LOG(LogLevel::Info) << "Converter version 1.0I";
 		LOG(LogLevel::Info) << "Built " << __TIMESTAMP__;
 		LOG(LogLevel::Debug) << "Current directory is " << Utils::getCurrentDirectory();
 
-		string EU4SaveFileName = getSaveFileName(argc, argv);
-		ConvertEU4ToV2(EU4SaveFileName);
+		string EU4SaveFileName = commonItems::getCommandLineSaveFileName(argc, argv, "input.eu4");
+		ConvertEU4ToV2(EU4SaveFileName, commandLineLogLevel);
 
 		return 0;
 	}
@@ -54,32 +56,29 @@ int main(const int argc, const char * argv[])
 }
 
 
-string getSaveFileName(const int argc, const char * argv[])
-{
-	if (argc >= 2)
-	{
-		LOG(LogLevel::Info) << "Using input file " << argv[1];
-		return argv[1];
-	}
-	else
-	{
-		LOG(LogLevel::Info) << "No input file given, defaulting to input.eu4";
-		return "input.eu4";
-	}
-}
-
-
 void setOutputName(const string& EU4SaveFileName);
 void deleteExistingOutputFolder();
-void ConvertEU4ToV2(const string& EU4SaveFileName)
+void ConvertEU4ToV2(const string& EU4SaveFileName, const string& commandLineLogLevel)
 {
-	Configuration::getInstance();
-	setOutputName(EU4SaveFileName);
-	deleteExistingOutputFolder();
+	{
+		commonItems::phaseTimer conversionPhase("Conversion");
+		commonItems::phaseTimer phase("Reading configuration");
+		Configuration::getInstance();
+		if (!commandLineLogLevel.empty())
+		{
+			Log::setLevel(commandLineLogLevel);	// the command line wins over configuration.txt
+		}
+		setOutputName(EU4SaveFileName);
+		deleteExistingOutputFolder();
 
-	EU4::world sourceWorld(EU4SaveFileName);
-	V2World destWorld(sourceWorld);
+		phase.next("Importing EU4 save");
+		EU4::world sourceWorld(EU4SaveFileName);
+		phase.next("Converting world");
+		V2World destWorld(sourceWorld);
+	}
 
+	commonItems::logPhaseSummary();
+	commonItems::writePhaseTrace("output/" + Configuration::getOutputName() + "_trace.json");
 	LOG(LogLevel::Info) << "* Conversion complete *";
 }
 
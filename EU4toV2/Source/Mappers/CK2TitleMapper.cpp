@@ -54,21 +54,21 @@ titleMapping::titleMapping(std::istream& theStream):
 	ID(),
 	region()
 {
-	registerKeyword(std::regex("name"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("name", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto equals = getNextToken(theStream);
 			auto temp = getNextToken(theStream);
 			name = Utils::convertUTF8To8859_15(*temp);
 		}
 	);
-	registerKeyword(std::regex("title"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("title", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto equals = getNextToken(theStream);
 			auto temp = getNextToken(theStream);
 			ID = *temp;
 		}
 	);
-	registerKeyword(std::regex("region"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("region", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto equals = getNextToken(theStream);
 			auto temp = getNextToken(theStream);
@@ -101,7 +101,7 @@ mappers::CK2TitleMapper::CK2TitleMapper():
 {
 	LOG(LogLevel::Info) << "Getting CK2 titles";
 
-	registerKeyword(std::regex("link"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("link", [this](const std::string& unused, std::istream& theStream)
 		{
 			titleMapping newMapping(theStream);
 			if (newMapping.hasIslamicRegion())
@@ -37,7 +37,7 @@ mappers::colonialTagMapper::colonialTagMapper()
 	LOG(LogLevel::Info) << "Parsing colony naming rules.";
 
 	commonItems::parsingFunction mappingFunction = std::bind(&mappers::colonialTagMapper::initMapping, this, std::placeholders::_1, std::placeholders::_2);
-	registerKeyword(std::regex("link"), mappingFunction);
+	registerKeyword("link", mappingFunction);
 
 	parseFile("colonial_tags.txt");
 }
@@ -47,28 +47,28 @@ void mappers::colonialTagMapper::initMapping(const std::string& unused, std::ist
 {
 	colonyStruct rule;
 
-	registerKeyword(std::regex("tag"), [this, &rule](const std::string& unused, std::istream& theStream)
+	registerKeyword("tag", [this, &rule](const std::string& unused, std::istream& theStream)
 		{
 			auto equals = getNextToken(theStream);
 			auto temp = getNextToken(theStream);
 			rule.tag = *temp;
 		}
 	);
-	registerKeyword(std::regex("EU4_region"), [this, &rule](const std::string& unused, std::istream& theStream)
+	registerKeyword("EU4_region", [this, &rule](const std::string& unused, std::istream& theStream)
 		{
 			auto equals = getNextToken(theStream);
 			auto temp = getNextToken(theStream);
 			rule.EU4Region = *temp;
 		}
 	);
-	registerKeyword(std::regex("V2_region"), [this, &rule](const std::string& unused, std::istream& theStream)
+	registerKeyword("V2_region", [this, &rule](const std::string& unused, std::istream& theStream)
 		{
 			auto equals = getNextToken(theStream);
 			auto temp = getNextToken(theStream);
 			rule.V2Region = *temp;
 		}
 	);
-	registerKeyword(std::regex("is_culture_group"), [this, &rule](const std::string& unused, std::istream& theStream)
+	registerKeyword("is_culture_group", [this, &rule](const std::string& unused, std::istream& theStream)
 		{
 			auto equals = getNextToken(theStream);
 			auto temp = getNextToken(theStream);
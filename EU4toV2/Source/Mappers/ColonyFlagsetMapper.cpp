@@ -36,7 +36,7 @@ mappers::colonyFlag::colonyFlag(std::istream& theStream, const std::string& regi
 	unique(false),
 	overlord()
 {
-	registerKeyword(std::regex("name"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("name", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto equals = getNextToken(theStream);
 			auto possibleName = getNextToken(theStream);
@@ -47,7 +47,7 @@ mappers::colonyFlag::colonyFlag(std::istream& theStream, const std::string& regi
 			}
 		}
 	);
-	registerKeyword(std::regex("unique"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("unique", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto equals = getNextToken(theStream);
 			auto uniqueness = getNextToken(theStream);
@@ -64,7 +64,7 @@ mappers::colonyFlag::colonyFlag(std::istream& theStream, const std::string& regi
 
 mappers::colonyFlagsetRegion::colonyFlagsetRegion(std::istream& theStream, const std::string& region, std::map<std::string, std::shared_ptr<colonyFlag>>& colonyFlagset)
 {
-	registerKeyword(std::regex("flag"), [region, &colonyFlagset](const std::string& unused, std::istream& theStream)
+	registerKeyword("flag", [region, &colonyFlagset](const std::string& unused, std::istream& theStream)
 		{
 			std::shared_ptr<colonyFlag> flag = std::make_shared<colonyFlag>(theStream, region);
 			colonyFlagset[flag->getName()] =  flag;
@@ -80,7 +80,7 @@ mappers::colonyFlagsetMapper::colonyFlagsetMapper()
 {
 	LOG(LogLevel::Info) << "Parsing colony naming rules.";
 
-	registerKeyword(std::regex("[\\w_]+"), [this](const std::string& region, std::istream& theStream)
+	registerRegex("[\\w_]+", [this](const std::string& region, std::istream& theStream)
 		{
 			colonyFlagsetRegion newRegion(theStream, region, colonyFlagset);
 		}
@@ -45,7 +45,7 @@ mappers::CountryMappings* mappers::CountryMappings::instance = nullptr;
 
 mappers::CountryMapping::CountryMapping(std::istream& theStream)
 {
-	registerKeyword(std::regex("EU4"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("EU4", [this](const std::string& unused, std::istream& theStream)
 		{
 			auto equals = getNextToken(theStream);
 			auto possibleEU4Tag = getNextToken(theStream);
@@ -56,7 +56,7 @@ mappers::CountryMapping::CountryMapping(std::istream& theStream)
 			}
 		}
 	);
-	registerKeyword(std::regex("Vic2"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("Vic2", [this](const std::string& unused, std::istream& theStream)
 	{
 		auto equals = getNextToken(theStream);
 		auto possibleVic2Tag = getNextToken(theStream);
@@ -84,7 +84,7 @@ void mappers::CountryMappings::readRules()
 {
 	LOG(LogLevel::Info) << "Reading country mapping rules";
 
-	registerKeyword(std::regex("link"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("link", [this](const std::string& unused, std::istream& theStream)
 		{
 			CountryMapping newMapping(theStream);
 			EU4TagToV2TagsRules.insert(make_pair(newMapping.getEU4Tag(), newMapping.getVic2Tag()));
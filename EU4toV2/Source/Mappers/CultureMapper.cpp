@@ -27,22 +27,18 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
-mappers::cultureMapper* mappers::cultureMapper::instance = nullptr;
-
-
-
 mappers::cultureMapper::cultureMapper():
 	cultureMap()
 {
 	LOG(LogLevel::Info) << "Parsing culture mappings";
 
-	registerKeyword(std::regex("link"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("link", [this](const std::string& unused, std::istream& theStream)
 		{
 			CultureMappingRule rule(theStream);
 			auto newRules = rule.getMappings();
-			for (auto newRule: newRules)
+			for (const auto& newRule: newRules)
 			{
-				cultureMap.push_back(newRule);
+				cultureMap[newRule.getSourceCulture()].push_back(newRule);
 			}
 		}
 	);
@@ -53,9 +49,16 @@ mappers::cultureMapper::cultureMapper():
 
 bool mappers::cultureMapper::CultureMatch(const std::string& srcCulture, std::string& dstCulture, const std::string& religion, int EU4Province, const std::string& ownerTag)
 {
-	for (auto cultureMapping: cultureMap)
+	const commonItems::symbol sourceCulture(srcCulture);
+	auto mappings = cultureMap.find(sourceCulture);
+	if (mappings == cultureMap.end())
+	{
+		return false;
+	}
+
+	for (const auto& cultureMapping: mappings->second)
 	{
-		if (cultureMapping.cultureMatch(srcCulture, dstCulture, religion, EU4Province, ownerTag))
+		if (cultureMapping.cultureMatch(sourceCulture, dstCulture, religion, EU4Province, ownerTag))
 		{
 			return true;
 		}
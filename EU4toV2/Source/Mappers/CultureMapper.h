@@ -28,7 +28,9 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 #include "newParser.h"
 #include "CultureMapping.h"
+#include "Symbol.h"
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 
@@ -44,13 +46,9 @@ namespace mappers
 			}
 
 		private:
-			static cultureMapper* instance;
 			static cultureMapper* getInstance()
 			{
-				if (instance == nullptr)
-				{
-					instance = new cultureMapper;
-				}
+				static cultureMapper* const instance = new cultureMapper;
 				return instance;
 			}
 
@@ -58,7 +56,7 @@ namespace mappers
 
 			bool CultureMatch(const std::string& srcCulture, std::string& dstCulture, const std::string& religion = "", int EU4Province = -1, const std::string& ownerTag = "");
 
-			std::vector<cultureMapping> cultureMap;
+			std::unordered_map<commonItems::symbol, std::vector<cultureMapping>> cultureMap;	// by source culture, in file order
 	};
 }
 
@@ -30,16 +30,40 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 mappers::cultureMapping::cultureMapping(const std::string& _sourceCulture, const std::string& _destinationCulture, const std::map<std::string, std::string>& _distinguishers):
 	sourceCulture(_sourceCulture),
 	destinationCulture(_destinationCulture),
-	distinguishers(_distinguishers)
+	distinguishers()
 {
+	for (const auto& [type, details]: _distinguishers)
+	{
+		if (type == "owner")
+		{
+			distinguishers.push_back({ distinguisherType::owner, details, 0 });
+		}
+		else if (type == "religion")
+		{
+			distinguishers.push_back({ distinguisherType::religion, details, 0 });
+		}
+		else if (type == "region")
+		{
+			distinguishers.push_back({ distinguisherType::region, details, 0 });
+		}
+		else if (type == "provinceid")
+		{
+			distinguishers.push_back({ distinguisherType::provinceID, details, stoi(details) });
+		}
+		else
+		{
+			LOG(LogLevel::Warning) << "Unhandled distinguisher type in culture rules: " << type;
+			distinguishers.push_back({ distinguisherType::unknown, details, 0 });
+		}
+	}
 }
 
 
-bool mappers::cultureMapping::cultureMatch(const std::string& _sourceCulture, std::string& _destinationCulture, const std::string& religion, int EU4Province, const std::string& ownerTag)
+bool mappers::cultureMapping::cultureMatch(commonItems::symbol _sourceCulture, std::string& _destinationCulture, const std::string& religion, int EU4Province, const std::string& ownerTag) const
 {
 	if (sourceCulture == _sourceCulture)
 	{
-		if (distinguishersMatch(distinguishers, religion, EU4Province, ownerTag))
+		if (distinguishersMatch(religion, EU4Province, ownerTag))
 		{
 			_destinationCulture = destinationCulture;
 			return true;
@@ -50,44 +74,40 @@ bool mappers::cultureMapping::cultureMatch(const std::string& _sourceCulture, st
 }
 
 
-bool mappers::cultureMapping::distinguishersMatch(const std::map<std::string, std::string>& distinguishers, const std::string& religion, int EU4Province, const std::string& ownerTag)
+bool mappers::cultureMapping::distinguishersMatch(const std::string& religion, int EU4Province, const std::string& ownerTag) const
 {
-	for (auto currentDistinguisher: distinguishers)
+	for (const auto& currentDistinguisher: distinguishers)
 	{
-		if (currentDistinguisher.first == "owner")
+		switch (currentDistinguisher.type)
 		{
-			if (ownerTag != currentDistinguisher.second)
-			{
+			case distinguisherType::owner:
+				if (ownerTag != currentDistinguisher.details)
+				{
+					return false;
+				}
+				break;
+			case distinguisherType::religion:
+				if (religion != currentDistinguisher.details)
+				{
+					return false;
+				}
+				break;
+			case distinguisherType::region:
+				if (!EU4::Regions::provinceInRegion(EU4Province, currentDistinguisher.details))
+				{
+					return false;
+				}
+				break;
+			case distinguisherType::provinceID:
+				if (currentDistinguisher.provinceID != EU4Province)
+				{
+					return false;
+				}
+				break;
+			default:
 				return false;
-			}
-		}
-		else if (currentDistinguisher.first == "religion")
-		{
-			if (religion != currentDistinguisher.second)
-			{
-				return false;
-			}
-		}
-		else if (currentDistinguisher.first == "region")
-		{
-			if (!EU4::Regions::provinceInRegion(EU4Province, currentDistinguisher.second))
-			{
-				return false;
-			}
-		}
-		else if (currentDistinguisher.first == "provinceid")
-		{
-			if (stoi(currentDistinguisher.second) != EU4Province)
-			{
-				return false;
-			}
-		}
-		else
-		{
-			LOG(LogLevel::Warning) << "Unhandled distinguisher type in culture rules: " << currentDistinguisher.first;
-			return false;
 		}
 	}
 
 	return true;
-}
\ No newline at end of file
+}
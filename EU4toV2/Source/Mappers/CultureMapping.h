@@ -26,8 +26,10 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
+#include "Symbol.h"
 #include <map>
 #include <string>
+#include <vector>
 
 
 
@@ -37,14 +39,24 @@ namespace mappers
 	{
 		public:
 			cultureMapping(const std::string& sourceCulture, const std::string& destinationCulture, const std::map<std::string, std::string>& distinguishers);
-			bool cultureMatch(const std::string& sourceCulture, std::string& destinationCulture, const std::string& religion, int EU4Province, const std::string& ownerTag);
+			bool cultureMatch(commonItems::symbol sourceCulture, std::string& destinationCulture, const std::string& religion, int EU4Province, const std::string& ownerTag) const;
+
+			commonItems::symbol getSourceCulture() const { return sourceCulture; }
 
 		private:
-			bool distinguishersMatch(const std::map<std::string, std::string>& distinguishers, const std::string& religion, int EU4Province, const std::string& ownerTag);
+			enum class distinguisherType { owner, religion, region, provinceID, unknown };
+			struct distinguisher
+			{
+				distinguisherType type;
+				std::string details;
+				int provinceID;
+			};
+
+			bool distinguishersMatch(const std::string& religion, int EU4Province, const std::string& ownerTag) const;
 
-			std::string sourceCulture;
+			commonItems::symbol sourceCulture;
 			std::string destinationCulture;
-			std::map<std::string, std::string> distinguishers;	// type, details
+			std::vector<distinguisher> distinguishers;	// read once, rather than interpreted on every match
 	};
 }
 
@@ -29,7 +29,7 @@ mappers::CultureMappingRule::CultureMappingRule(std::istream& theStream):
 	mappings()
 {
 	std::string destinationCulture;
-	registerKeyword(std::regex("vic2"), [this, &destinationCulture](const std::string& unused, std::istream& theStream)
+	registerKeyword("vic2", [this, &destinationCulture](const std::string& unused, std::istream& theStream)
 		{
 			auto equals = getNextToken(theStream);
 			destinationCulture = *getNextToken(theStream);
@@ -37,7 +37,7 @@ mappers::CultureMappingRule::CultureMappingRule(std::istream& theStream):
 	);
 
 	std::vector<std::string> sourceCultures;
-	registerKeyword(std::regex("eu4"), [this, &sourceCultures](const std::string& unused, std::istream& theStream)
+	registerKeyword("eu4", [this, &sourceCultures](const std::string& unused, std::istream& theStream)
 		{
 			auto equals = getNextToken(theStream);
 			sourceCultures.push_back(*getNextToken(theStream));
@@ -45,7 +45,7 @@ mappers::CultureMappingRule::CultureMappingRule(std::istream& theStream):
 	);
 
 	std::map<std::string, std::string> distinguishers;
-	registerKeyword(std::regex("(?:region)|(?:religion)|(?:owner)|(?:provinceid)"), [this, &distinguishers](const std::string& type, std::istream& theStream)
+	registerRegex("(?:region)|(?:religion)|(?:owner)|(?:provinceid)", [this, &distinguishers](const std::string& type, std::istream& theStream)
 		{
 			auto equals = getNextToken(theStream);
 			distinguishers.insert(make_pair(type, *getNextToken(theStream)));
@@ -36,13 +36,13 @@ mappers::slaveCultureMapper::slaveCultureMapper():
 {
 	LOG(LogLevel::Info) << "Parsing slave culture mappings";
 
-	registerKeyword(std::regex("link"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("link", [this](const std::string& unused, std::istream& theStream)
 		{
 			CultureMappingRule rule(theStream);
 			auto newRules = rule.getMappings();
-			for (auto newRule: newRules)
+			for (const auto& newRule: newRules)
 			{
-				cultureMap.push_back(newRule);
+				cultureMap[newRule.getSourceCulture()].push_back(newRule);
 			}
 		}
 	);
@@ -53,9 +53,16 @@ mappers::slaveCultureMapper::slaveCultureMapper():
 
 bool mappers::slaveCultureMapper::CultureMatch(const std::string& srcCulture, std::string& dstCulture, const std::string& religion, int EU4Province, const std::string& ownerTag)
 {
-	for (auto cultureMapping: cultureMap)
+	const commonItems::symbol sourceCulture(srcCulture);
+	auto mappings = cultureMap.find(sourceCulture);
+	if (mappings == cultureMap.end())
 	{
-		if (cultureMapping.cultureMatch(srcCulture, dstCulture, religion, EU4Province, ownerTag))
+		return false;
+	}
+
+	for (const auto& cultureMapping: mappings->second)
+	{
+		if (cultureMapping.cultureMatch(sourceCulture, dstCulture, religion, EU4Province, ownerTag))
 		{
 			return true;
 		}
@@ -1278,7 +1278,7 @@ void V2Country::addRelation(V2Relations* newRelation)
 
 void V2Country::absorbVassal(V2Country* vassal)
 {
-	Log(LogLevel::Debug) << "\t" << tag << " is absorbing " << vassal->getTag();
+	LOG(LogLevel::Debug) << "\t" << tag << " is absorbing " << vassal->getTag();
 
 	// change province ownership and add owner cores if needed
 	map<int, V2Province*> vassalProvinces = vassal->getProvinces();
@@ -35,6 +35,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "ParadoxParserUTF8.h"
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
+#include "PhaseTimer.h"
 #include "../Mappers/AdjacencyMapper.h"
 #include "../Mappers/CountryMapping.h"
 #include "../Mappers/CultureMapper.h"
@@ -68,30 +69,49 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 V2World::V2World(const EU4::world& sourceWorld)
 {
 	LOG(LogLevel::Info) << "Parsing Vicky2 data";
+	commonItems::phaseTimer phase("Importing provinces");
 	importProvinces();
+	phase.next("Importing default pops");
 	importDefaultPops();
 	//logPopsByCountry();
+	phase.next("Finding coastal provinces");
 	findCoastalProvinces();
+	phase.next("Importing potential countries");
 	importPotentialCountries();
+	phase.next("Importing tech schools");
 	importTechSchools();
 	isRandomWorld = sourceWorld.isRandomWorld();
 
+	phase.next("Creating country mappings");
 	mappers::CountryMappings::createMappings(sourceWorld, potentialCountries);
 
 	LOG(LogLevel::Info) << "Converting world";
+	phase.next("Converting countries");
 	convertCountries(sourceWorld);
+	phase.next("Converting provinces");
 	convertProvinces(sourceWorld);
+	phase.next("Converting diplomacy");
 	convertDiplomacy(sourceWorld);
+	phase.next("Setting up colonies");
 	setupColonies();
+	phase.next("Setting up states");
 	setupStates();
+	phase.next("Converting unciv reforms");
 	convertUncivReforms(sourceWorld);
+	phase.next("Converting techs");
 	convertTechs(sourceWorld);
+	phase.next("Allocating factories");
 	allocateFactories(sourceWorld);
+	phase.next("Setting up pops");
 	setupPops(sourceWorld);
+	phase.next("Adding unions");
 	addUnions();
+	phase.next("Converting armies");
 	convertArmies(sourceWorld);
+	phase.next("Checking for civilized nations");
 	checkForCivilizedNations();
 
+	phase.next("Outputting mod");
 	output();
 }
 
@@ -450,7 +470,7 @@ void V2World::initializeCountries(const EU4::world& sourceWorld)
 
 		V2Country* destCountry = createOrLocateCountry(V2Tag, sourceCountry.second);
 		destCountry->initFromEU4Country(sourceCountry.second, techSchools, leaderIDMap);
-		countries.insert(make_pair(V2Tag, destCountry));
+		addCountry(V2Tag, destCountry);
 	}
 }
 
@@ -582,11 +602,10 @@ void V2World::addAllPotentialCountries()
 	// ALL potential countries should be output to the file, otherwise some things don't get initialized right when loading Vic2
 	for (auto potentialCountry : potentialCountries)
 	{
-		map<string, V2Country*>::iterator citr = countries.find(potentialCountry.first);
-		if (citr == countries.end())
+		if (getCountry(potentialCountry.first) == nullptr)
 		{
 			potentialCountry.second->initFromHistory();
-			countries.insert(make_pair(potentialCountry.first, potentialCountry.second));
+			addCountry(potentialCountry.first, potentialCountry.second);
 		}
 	}
 }
@@ -759,10 +778,9 @@ void V2World::convertProvinces(const EU4::world& sourceWorld)
 		else
 		{
 			Vic2Province.second->setOwner(V2Tag);
-			map<string, V2Country*>::iterator ownerItr = countries.find(V2Tag);
-			if (ownerItr != countries.end())
+			if (V2Country* owner = getCountry(V2Tag); owner != nullptr)
 			{
-				ownerItr->second->addProvince(Vic2Province.second);
+				owner->addProvince(Vic2Province.second);
 			}
 			Vic2Province.second->convertFromOldProvince(oldProvince);
 
@@ -884,43 +902,43 @@ void V2World::convertDiplomacy(const EU4::world& sourceWorld)
 			continue;
 		}
 
-		map<string, V2Country*>::iterator country1 = countries.find(V2Tag1);
-		map<string, V2Country*>::iterator country2 = countries.find(V2Tag2);
-		if (country1 == countries.end())
+		V2Country* country1 = getCountry(V2Tag1);
+		V2Country* country2 = getCountry(V2Tag2);
+		if (country1 == nullptr)
 		{
 			LOG(LogLevel::Warning) << "Vic2 country " << V2Tag1 << " used in diplomatic agreement doesn't exist";
 			continue;
 		}
-		if (country2 == countries.end())
+		if (country2 == nullptr)
 		{
 			LOG(LogLevel::Warning) << "Vic2 country " << V2Tag2 << " used in diplomatic agreement doesn't exist";
 			continue;
 		}
-		V2Relations* r1 = country1->second->getRelations(V2Tag2);
+		V2Relations* r1 = country1->getRelations(V2Tag2);
 		if (!r1)
 		{
 			r1 = new V2Relations(V2Tag2);
-			country1->second->addRelation(r1);
+			country1->addRelation(r1);
 		}
-		V2Relations* r2 = country2->second->getRelations(V2Tag1);
+		V2Relations* r2 = country2->getRelations(V2Tag1);
 		if (!r2)
 		{
 			r2 = new V2Relations(V2Tag1);
-			country2->second->addRelation(r2);
+			country2->addRelation(r2);
 		}
 
 		if (itr->type == "is_colonial"|| itr->type == "colony")
 		{
-			country2->second->setColonyOverlord(country1->second);
+			country2->setColonyOverlord(country1);
 
-			if (country2->second->getSourceCountry()->getLibertyDesire() < Configuration::getLibertyThreshold())
+			if (country2->getSourceCountry()->getLibertyDesire() < Configuration::getLibertyThreshold())
 			{
-				country1->second->absorbVassal(country2->second);
+				country1->absorbVassal(country2);
 				for (vector<EU4Agreement>::iterator itr2 = agreements.begin(); itr2 != agreements.end(); ++itr2)
 				{
-					if (itr2->country2 == country2->second->getSourceCountry()->getTag())
+					if (itr2->country2 == country2->getSourceCountry()->getTag())
 					{
-						itr2->country2 == country1->second->getSourceCountry()->getTag();
+						itr2->country2 == country1->getSourceCountry()->getTag();
 					}
 				}
 			}
@@ -938,12 +956,12 @@ void V2World::convertDiplomacy(const EU4::world& sourceWorld)
 
 		if ((itr->type == "is_march") || (itr->type == "march"))
 		{
-			country1->second->absorbVassal(country2->second);
+			country1->absorbVassal(country2);
 			for (vector<EU4Agreement>::iterator itr2 = agreements.begin(); itr2 != agreements.end(); ++itr2)
 			{
-				if (itr2->country1 == country2->second->getSourceCountry()->getTag())
+				if (itr2->country1 == country2->getSourceCountry()->getTag())
 				{
-					itr2->country1 = country1->second->getSourceCountry()->getTag();
+					itr2->country1 = country1->getSourceCountry()->getTag();
 				}
 			}
 		}
@@ -1133,10 +1151,9 @@ void V2World::setupStates()
 			}
 		}
 		newState->colloectNavalBase();
-		map<string, V2Country*>::iterator iter2 = countries.find(owner);
-		if (iter2 != countries.end())
+		if (V2Country* ownerCountry = getCountry(owner); ownerCountry != nullptr)
 		{
-			iter2->second->addState(newState);
+			ownerCountry->addState(newState);
 		}
 	}
 }
@@ -1942,6 +1959,24 @@ V2Province* V2World::getProvince(const int provNum) const
 
 V2Country* V2World::getCountry(string tag) const
 {
+	if (commonItems::countryTag packedTag(tag); packedTag)
+	{
+		V2Country* const* country = countriesByTag.find(packedTag);
+		return (country != nullptr) ? *country : nullptr;
+	}
+
 	map<string, V2Country*>::const_iterator i = countries.find(tag);
 	return (i != countries.end()) ? i->second : nullptr;
+}
+
+
+void V2World::addCountry(const string& tag, V2Country* country)
+{
+	if (countries.insert(make_pair(tag, country)).second)
+	{
+		if (commonItems::countryTag packedTag(tag); packedTag)
+		{
+			countriesByTag.insert(packedTag, country);
+		}
+	}
 }
\ No newline at end of file
@@ -34,6 +34,8 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "V2Province.h"
 #include "../EU4World/EU4Army.h"
 #include "../EU4World/EU4Province.h"
+#include "CountryTag.h"
+#include "FlatHashMap.h"
 #include <list>
 #include <memory>
 #include <set>
@@ -81,6 +83,7 @@ class V2World
 		void convertCountries(const EU4::world& sourceWorld);
 		void initializeCountries(const EU4::world& sourceWorld);
 		V2Country* createOrLocateCountry(const string& V2Tag, const shared_ptr<EU4::Country> sourceCountry);
+		void addCountry(const string& tag, V2Country* country);
 		void convertNationalValues();
 		void convertPrestige();
 		void addAllPotentialCountries();
@@ -106,6 +109,7 @@ class V2World
 
 		map<int, V2Province*> provinces;
 		map<string, V2Country*> countries;
+		commonItems::flatHashMap<commonItems::countryTag, V2Country*> countriesByTag; // the same countries, for lookups
 		map<string, V2Country*> potentialCountries;
 		map<string, V2Country*> dynamicCountries;
 		V2Diplomacy diplomacy;
@@ -35,7 +35,7 @@ Vic2::regions* Vic2::regions::instance = nullptr;
 
 Vic2::regions::regions()
 {
-	registerKeyword(std::regex("\\w\\w\\w_\\d+"), [this](const std::string& regionName, std::istream& theStream)
+	registerRegex("\\w\\w\\w_\\d+", [this](const std::string& regionName, std::istream& theStream)
 		{
 			commonItems::intList provinceList(theStream);
 
@@ -25,6 +25,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "OSCompatibilityLayer.h"
 #include "Log.h"
 #include "ParserHelpers.h"
+#include "ParserProfiling.h"
 #include <fstream>
 #include <vector>
 
@@ -37,7 +38,7 @@ Configuration theConfiguration;
 
 void Configuration::instantiate(std::istream& theStream)
 {
-	registerKeyword(std::regex("HoI4directory"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("HoI4directory", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString directoryString(theStream);
 		HoI4Path = directoryString.getString();
 		if (HoI4Path.empty() || !Utils::doesFolderExist(HoI4Path))
@@ -55,7 +56,7 @@ void Configuration::instantiate(std::istream& theStream)
 			LOG(LogLevel::Debug) << "HoI4 path install path is " << HoI4Path;
 		}
 	});
-	registerKeyword(std::regex("HoI4Documentsdirectory"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("HoI4Documentsdirectory", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString directoryString(theStream);
 		HoI4DocumentsPath = directoryString.getString();
 		if (HoI4DocumentsPath.empty() || !Utils::doesFolderExist(HoI4DocumentsPath))
@@ -68,7 +69,7 @@ void Configuration::instantiate(std::istream& theStream)
 			LOG(LogLevel::Debug) << "HoI4 documents directory is " << HoI4DocumentsPath;
 		}
 	});
-	registerKeyword(std::regex("V2directory"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("V2directory", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString directoryString(theStream);
 		Vic2Path = directoryString.getString();
 		if (Vic2Path.empty() || !Utils::doesFolderExist(Vic2Path))
@@ -86,27 +87,27 @@ void Configuration::instantiate(std::istream& theStream)
 			LOG(LogLevel::Debug) << "Victoria 2 install path is " << Vic2Path;
 		}
 	});
-	registerKeyword(std::regex("Vic2Mods"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("Vic2Mods", [this](const std::string& unused, std::istream& theStream){
 		commonItems::stringList modsStrings(theStream);
 		Vic2Mods = modsStrings.getStrings();
 	});
-	registerKeyword(std::regex("force_multiplier"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("force_multiplier", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleDouble factorValue(theStream);
 		forceMultiplier = factorValue.getDouble();
 	});
-	registerKeyword(std::regex("manpower_factor"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("manpower_factor", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleDouble factorValue(theStream);
 		manpowerFactor = factorValue.getDouble();
 	});
-	registerKeyword(std::regex("industrial_shape_factor"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("industrial_shape_factor", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleDouble factorValue(theStream);
 		forceMultiplier = factorValue.getDouble();
 	});
-	registerKeyword(std::regex("ic_factor"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("ic_factor", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleDouble factorValue(theStream);
 		icFactor = factorValue.getDouble();
 	});
-	registerKeyword(std::regex("ideologies"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("ideologies", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString ideologiesOptionString(theStream);
 		if (ideologiesOptionString.getString() == "keep_default")
 		{
@@ -125,25 +126,36 @@ void Configuration::instantiate(std::istream& theStream)
 			ideologiesOptions = ideologyOptions::keep_major;
 		}
 	});
-	registerKeyword(std::regex("ideologies_choice"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("ideologies_choice", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString choiceString(theStream);
 		specifiedIdeologies.push_back(choiceString.getString());
 	});
-	registerKeyword(std::regex("debug"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("debug", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString debugString(theStream);
 		if (debugString.getString() == "yes")
 		{
 			debug = true;
 		}
 	});
-	registerKeyword(std::regex("remove_cores"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("log_level", [this](const std::string& unused, std::istream& theStream){
+		commonItems::singleString levelString(theStream);
+		if (!Log::setLevel(levelString.getString()))
+		{
+			LOG(LogLevel::Warning) << "Unknown log_level " << levelString.getString() << ", logging everything";
+		}
+	});
+	registerKeyword("profile_parsing", [this](const std::string& unused, std::istream& theStream){
+		commonItems::singleString profileString(theStream);
+		commonItems::enableParserProfiling(profileString.getString() == "yes");
+	});
+	registerKeyword("remove_cores", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString removecoreString(theStream);
 		if (removecoreString.getString() == "false")
 		{
 			removeCores = false;
 		}
 	});
-	registerKeyword(std::regex("create_factions"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("create_factions", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString createFactionsString(theStream);
 		if (createFactionsString.getString() == "no")
 		{
@@ -151,12 +163,12 @@ void Configuration::instantiate(std::istream& theStream)
 		}
 	});
 	std::string versionMethod;
-	registerKeyword(std::regex("HoI4VersionMethod"), [&versionMethod](const std::string& unused, std::istream& theStream){
+	registerKeyword("HoI4VersionMethod", [&versionMethod](const std::string& unused, std::istream& theStream){
 		commonItems::singleString versionMethodString(theStream);
 		versionMethod = versionMethodString.getString();
 	});
 	std::string manualVersionString;
-	registerKeyword(std::regex("HoI4Version"), [&manualVersionString](const std::string& unused, std::istream& theStream){
+	registerKeyword("HoI4Version", [&manualVersionString](const std::string& unused, std::istream& theStream){
 		commonItems::singleString versionString(theStream);
 		manualVersionString = versionString.getString();
 	});
@@ -176,7 +188,7 @@ void Configuration::instantiate(std::istream& theStream)
 	{
 		version = HoI4::Version();
 	}
-	Log(LogLevel::Debug) << "HoI4 version is " << version;
+	LOG(LogLevel::Debug) << "HoI4 version is " << version;
 }
 
 
@@ -209,7 +221,7 @@ HoI4::Version Configuration::getAutomaticHoI4Version()
 
 ConfigurationFile::ConfigurationFile(const std::string& filename)
 {
-	registerKeyword(std::regex("configuration"), [](const std::string& unused, std::istream& theStream){
+	registerKeyword("configuration", [](const std::string& unused, std::istream& theStream){
 		theConfiguration.instantiate(theStream);
 	});
 
@@ -67,14 +67,7 @@ class Configuration: commonItems::parser
 
 		bool getDebug() const { return debug; }
 
-		int getNextLeaderID() { return leaderID++; }
-
-		void setForceMultiplier(double mult) { forceMultiplier = mult; }
 		void setOutputName(const std::string& name) { outputName = name; }
-		void setLeaderIDForNextCountry() {
-			leaderIDCountryIdx++;
-			leaderID = 1000 * leaderIDCountryIdx;	
-		}
 
 	private:
 		Configuration(const Configuration&) = delete;
@@ -99,9 +92,6 @@ class Configuration: commonItems::parser
 		HoI4::Version version;
 
 		bool debug = false;
-
-		unsigned int leaderID = 1000;
-		unsigned int leaderIDCountryIdx = 1;
 };
 
 
@@ -0,0 +1,49 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+
+#include "ConversionContext.h"
+#include "ParallelFor.h"
+
+
+
+ConversionContext::ConversionContext(const Configuration& theConfiguration):
+	configuration(theConfiguration)
+{
+	// the data sets read separate files, so each is loaded on its own worker
+	commonItems::parallelFor(3, [this](size_t dataSet)
+	{
+		switch (dataSet)
+		{
+			case 0:
+				theProvinceDefinitions = std::make_unique<const provinceDefinitions>(configuration);
+				break;
+			case 1:
+				theProvinceMapper = std::make_unique<const provinceMapper>(configuration);
+				break;
+			case 2:
+				theVic2Localisations = std::make_unique<const V2Localisations>(configuration);
+				break;
+		}
+	});
+}
@@ -0,0 +1,64 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+
+#ifndef CONVERSION_CONTEXT_H_
+#define CONVERSION_CONTEXT_H_
+
+
+
+#include "Configuration.h"
+#include "Mappers/ProvinceDefinitions.h"
+#include "Mappers/ProvinceMapper.h"
+#include "Mappers/V2Localisations.h"
+#include <memory>
+
+
+
+// The game data a conversion reads but never changes: the configuration, the HoI4 province
+// definitions, the province mappings and the Vic2 localisations. The data sets are read up front,
+// side by side, and are only handed out as const from then on, so the world builders can share them
+// between threads, and each conversion in a process can have its own.
+class ConversionContext
+{
+	public:
+		explicit ConversionContext(const Configuration& theConfiguration);
+
+		const Configuration& getConfiguration() const { return configuration; }
+		const provinceDefinitions& getProvinceDefinitions() const { return *theProvinceDefinitions; }
+		const provinceMapper& getProvinceMapper() const { return *theProvinceMapper; }
+		const V2Localisations& getVic2Localisations() const { return *theVic2Localisations; }
+
+	private:
+		ConversionContext(const ConversionContext&) = delete;
+		ConversionContext& operator=(const ConversionContext&) = delete;
+
+		const Configuration& configuration;
+		std::unique_ptr<const provinceDefinitions> theProvinceDefinitions;
+		std::unique_ptr<const provinceMapper> theProvinceMapper;
+		std::unique_ptr<const V2Localisations> theVic2Localisations;
+};
+
+
+
+#endif // CONVERSION_CONTEXT_H_
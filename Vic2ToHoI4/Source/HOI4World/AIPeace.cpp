@@ -29,47 +29,47 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 HoI4::AIPeace::AIPeace(const std::string& theName, std::istream& theStream):
 	name(theName)
 {
-	registerKeyword(std::regex("enable"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("enable", [this](const std::string& unused, std::istream& theStream){
 		commonItems::stringOfItem enableString(theStream);
 		enable = enableString.getString();
 	});
-	registerKeyword(std::regex("annex_randomness"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("annex_randomness", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt randomnessInt(theStream);
 		annexRandomness = randomnessInt.getInt();
 	});
-	registerKeyword(std::regex("liberate_randomness"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("liberate_randomness", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt randomnessInt(theStream);
 		liberateRandomness = randomnessInt.getInt();
 	});
-	registerKeyword(std::regex("puppet_randomness"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("puppet_randomness", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt randomnessInt(theStream);
 		puppetRandomness = randomnessInt.getInt();
 	});
-	registerKeyword(std::regex("take_states_randomness"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("take_states_randomness", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt randomnessInt(theStream);
 		takeStatesRandomness = randomnessInt.getInt();
 	});
-	registerKeyword(std::regex("force_government_randomness"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("force_government_randomness", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt randomnessInt(theStream);
 		forceGovernmentRandomness = randomnessInt.getInt();
 	});
-	registerKeyword(std::regex("annex"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("annex", [this](const std::string& unused, std::istream& theStream){
 		commonItems::stringOfItem annexString(theStream);
 		annex = annexString.getString();
 	});
-	registerKeyword(std::regex("liberate"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("liberate", [this](const std::string& unused, std::istream& theStream){
 		commonItems::stringOfItem liberateString(theStream);
 		liberate = liberateString.getString();
 	});
-	registerKeyword(std::regex("puppet"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("puppet", [this](const std::string& unused, std::istream& theStream){
 		commonItems::stringOfItem puppetString(theStream);
 		puppet = puppetString.getString();
 	});
-	registerKeyword(std::regex("take_states"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("take_states", [this](const std::string& unused, std::istream& theStream){
 		commonItems::stringOfItem takeStatesString(theStream);
 		takeStates = takeStatesString.getString();
 	});
-	registerKeyword(std::regex("force_government"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("force_government", [this](const std::string& unused, std::istream& theStream){
 		commonItems::stringOfItem forceGovernmentString(theStream);
 		forceGovernment = forceGovernmentString.getString();
 	});
@@ -29,7 +29,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 HoI4::AIPeaces::AIPeaces() noexcept
 {
-	registerKeyword(std::regex("[A-Za-z0-9\\_]+"), [this](const std::string& peaceName, std::istream& theStream)
+	registerRegex("[A-Za-z0-9\\_]+", [this](const std::string& peaceName, std::istream& theStream)
 	{
 		thePeaces.push_back(AIPeace(peaceName, theStream));
 	});
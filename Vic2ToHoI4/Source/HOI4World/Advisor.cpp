@@ -29,15 +29,15 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 HoI4::Advisor::Advisor(const std::string& ideology, std::istream& theStream):
 	ideology(ideology)
 {
-	registerKeyword(std::regex("traits"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("traits", [this](const std::string& unused, std::istream& theStream){
 		commonItems::stringList traitString(theStream);
 		traits = traitString.getStrings();
 	});
-	registerKeyword(std::regex("picture"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("picture", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString pictureString(theStream);
 		picture = pictureString.getString();
 	});
-	registerKeyword(std::regex("[A-Za-z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
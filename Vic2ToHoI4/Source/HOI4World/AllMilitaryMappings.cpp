@@ -27,7 +27,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 HoI4::allMilitaryMappings::allMilitaryMappings()
 {
-	registerKeyword(std::regex("[a-zA-Z0-9]+"), [this](const std::string& mod, std::istream& theStream)
+	registerRegex("[a-zA-Z0-9]+", [this](const std::string& mod, std::istream& theStream)
 	{
 		militaryMappings newMappings(mod, theStream);
 		theMappings.insert(make_pair(mod, newMappings));
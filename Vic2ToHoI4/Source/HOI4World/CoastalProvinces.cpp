@@ -23,14 +23,28 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 #include "CoastalProvinces.h"
 #include "MapData.h"
+#include "MapCache.h"
 #include "Log.h"
 #include "../Configuration.h"
 #include <fstream>
 
 
 
+namespace
+{
+
+const char* const coastalProvincesCacheFilename = "coastalProvinces.cache";
+
+}
+
+
 void HoI4::coastalProvinces::init(const MapData& theMapData)
 {
+	if (readCache())
+	{
+		return;
+	}
+
 	auto provinces = getProvinces();
 
 	for (auto province: provinces)
@@ -60,6 +74,8 @@ void HoI4::coastalProvinces::init(const MapData& theMapData)
 			}
 		}
 	}
+
+	writeCache();
 }
 
 
@@ -120,6 +136,54 @@ std::map<int, HoI4::province> HoI4::coastalProvinces::getProvinces() const
 }
 
 
+// Cached as each coastal province with the number of sea provinces it connects to, then all those sea provinces
+bool HoI4::coastalProvinces::readCache()
+{
+	mapCacheReader cache(coastalProvincesCacheFilename);
+	std::vector<int> provinces;
+	std::vector<uint32_t> seaCounts;
+	std::vector<int> seaProvinces;
+	if (!cache.read(provinces) || !cache.read(seaCounts) || !cache.read(seaProvinces) || (provinces.size() != seaCounts.size()))
+	{
+		return false;
+	}
+
+	size_t seaProvince = 0;
+	for (size_t province = 0; province < provinces.size(); province++)
+	{
+		if (seaCounts[province] > seaProvinces.size() - seaProvince)
+		{
+			theCoastalProvinces.clear();
+			return false;
+		}
+		auto firstSeaProvince = seaProvinces.begin() + seaProvince;
+		theCoastalProvinces[provinces[province]].assign(firstSeaProvince, firstSeaProvince + seaCounts[province]);
+		seaProvince += seaCounts[province];
+	}
+	return true;
+}
+
+
+void HoI4::coastalProvinces::writeCache() const
+{
+	std::vector<int> provinces;
+	std::vector<uint32_t> seaCounts;
+	std::vector<int> seaProvinces;
+	for (const auto& coastalProvince: theCoastalProvinces)
+	{
+		provinces.push_back(coastalProvince.first);
+		seaCounts.push_back(static_cast<uint32_t>(coastalProvince.second.size()));
+		seaProvinces.insert(seaProvinces.end(), coastalProvince.second.begin(), coastalProvince.second.end());
+	}
+
+	mapCacheWriter cache(coastalProvincesCacheFilename);
+	cache.write(provinces);
+	cache.write(seaCounts);
+	cache.write(seaProvinces);
+	cache.commit();
+}
+
+
 bool HoI4::coastalProvinces::isProvinceCoastal(int provinceNum) const
 {
 	auto province = theCoastalProvinces.find(provinceNum);
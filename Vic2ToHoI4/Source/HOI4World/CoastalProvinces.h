@@ -58,6 +58,8 @@ class coastalProvinces
 		coastalProvinces& operator=(const coastalProvinces&) = delete;
 
 		std::map<int, province> getProvinces() const;
+		bool readCache();
+		void writeCache() const;
 
 		std::map<int, std::vector<int>> theCoastalProvinces;	// province, connecting sea provinces
 };
@@ -32,7 +32,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 HoI4::decisionsCategory::decisionsCategory(const std::string& categoryName, std::istream& theStream):
 	name(categoryName)
 {
-	registerKeyword(std::regex("[A-Za-z0-9\\_]+"), [this](const std::string& decisionName, std::istream& theStream)
+	registerRegex("[A-Za-z0-9\\_]+", [this](const std::string& decisionName, std::istream& theStream)
 	{
 		decision theDecision(decisionName, theStream);
 		theDecisions.push_back(theDecision);
@@ -204,7 +204,7 @@ namespace HoI4
 		public:
 			explicit decisionsCategorySet(std::istream& theStream)
 			{
-				registerKeyword(std::regex("[A-Za-z\\_]+"), [this](const std::string& categoryName, std::istream& theStream)
+				registerRegex("[A-Za-z\\_]+", [this](const std::string& categoryName, std::istream& theStream)
 				{
 					decisionsCategory category(categoryName, theStream);
 					theCategories.push_back(category);
@@ -222,7 +222,7 @@ namespace HoI4
 
 HoI4::decisions::decisions() noexcept
 {
-	registerKeyword(std::regex("[A-Za-z\\_]+"), [this](const std::string& categoryName, std::istream& theStream)
+	registerRegex("[A-Za-z\\_]+", [this](const std::string& categoryName, std::istream& theStream)
 	{
 		decisionsCategory category(categoryName, theStream);
 		stabilityDecisions.push_back(category);
@@ -231,7 +231,7 @@ HoI4::decisions::decisions() noexcept
 
 	clearRegisteredKeywords();
 
-	registerKeyword(std::regex("[A-Za-z\\_]+"), [this](const std::string& ideologyName, std::istream& theStream)
+	registerRegex("[A-Za-z\\_]+", [this](const std::string& ideologyName, std::istream& theStream)
 	{
 		decisionsCategorySet categorySet(theStream);
 		auto categories = categorySet.takeCategories();
@@ -45,7 +45,7 @@ class RegimentTypeGroup: commonItems::parser
 
 HoI4::RegimentTypeGroup::RegimentTypeGroup(std::istream& theStream)
 {
-	registerKeyword(std::regex("[a-zA-Z0-9_]+"), [this](const std::string& name, std::istream& theStream){
+	registerRegex("[a-zA-Z0-9_]+", [this](const std::string& name, std::istream& theStream){
 		HoI4::RegimentType regimentType(name, theStream);
 		regimentTypes.push_back(regimentType);
 	});
@@ -56,19 +56,19 @@ HoI4::RegimentTypeGroup::RegimentTypeGroup(std::istream& theStream)
 
 HoI4::DivisionTemplateType::DivisionTemplateType(std::istream& theStream)
 {
-	registerKeyword(std::regex("name"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("name", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString nameString(theStream);
 		name = nameString.getString();
 	});
-	registerKeyword(std::regex("regiments"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("regiments", [this](const std::string& unused, std::istream& theStream){
 		HoI4::RegimentTypeGroup regimentsGroup(theStream);
 		regiments = regimentsGroup.getRegimentTypes();
 	});
-	registerKeyword(std::regex("support"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("support", [this](const std::string& unused, std::istream& theStream){
 		HoI4::RegimentTypeGroup supportRegimentsGroup(theStream);
 		supportRegiments = supportRegimentsGroup.getRegimentTypes();
 	});
-	registerKeyword(std::regex("priority"),  commonItems::ignoreItem);
+	registerKeyword("priority",  commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
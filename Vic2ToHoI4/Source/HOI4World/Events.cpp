@@ -209,7 +209,7 @@ void HoI4::Events::createFactionEvents(std::shared_ptr<HoI4Country> Leader, std:
 	}
 	else
 	{
-		Log(LogLevel::Warning) << "Could not determine leader name for faction events";
+		LOG(LogLevel::Warning) << "Could not determine leader name for faction events";
 		leaderName = "";
 	}
 
@@ -221,7 +221,7 @@ void HoI4::Events::createFactionEvents(std::shared_ptr<HoI4Country> Leader, std:
 	}
 	else
 	{
-		Log(LogLevel::Warning) << "Could not determine new ally name for faction events";
+		LOG(LogLevel::Warning) << "Could not determine new ally name for faction events";
 		newAllyName = *possibleNewAllyName;
 	}
 
@@ -316,7 +316,7 @@ void HoI4::Events::createAnnexEvent(std::shared_ptr<HoI4Country> Annexer, std::s
 	}
 	else
 	{
-		Log(LogLevel::Warning) << "Could not determine annexer name for annexation events";
+		LOG(LogLevel::Warning) << "Could not determine annexer name for annexation events";
 		annexerName = "";
 	}
 
@@ -328,7 +328,7 @@ void HoI4::Events::createAnnexEvent(std::shared_ptr<HoI4Country> Annexer, std::s
 	}
 	else
 	{
-		Log(LogLevel::Warning) << "Could not determine annexed country name for annexation events";
+		LOG(LogLevel::Warning) << "Could not determine annexed country name for annexation events";
 		annexedName = "";
 	}
 
@@ -458,7 +458,7 @@ void HoI4::Events::createSudetenEvent(std::shared_ptr<HoI4Country> Annexer, std:
 	}
 	else
 	{
-		Log(LogLevel::Warning) << "Could not determine annexer name for sudeten events";
+		LOG(LogLevel::Warning) << "Could not determine annexer name for sudeten events";
 		annexerName = "";
 	}
 
@@ -470,7 +470,7 @@ void HoI4::Events::createSudetenEvent(std::shared_ptr<HoI4Country> Annexer, std:
 	}
 	else
 	{
-		Log(LogLevel::Warning) << "Could not determine annexer adjective for sudeten events";
+		LOG(LogLevel::Warning) << "Could not determine annexer adjective for sudeten events";
 		annexerAdjctive = "";
 	}
 
@@ -482,7 +482,7 @@ void HoI4::Events::createSudetenEvent(std::shared_ptr<HoI4Country> Annexer, std:
 	}
 	else
 	{
-		Log(LogLevel::Warning) << "Could not determine annexed country name for sudeten events";
+		LOG(LogLevel::Warning) << "Could not determine annexed country name for sudeten events";
 		annexedName = "";
 	}
 
@@ -604,7 +604,7 @@ void HoI4::Events::createTradeEvent(std::shared_ptr<HoI4Country> leader, std::sh
 	}
 	else
 	{
-		Log(LogLevel::Warning) << "Could not determine aggressor name for trade events";
+		LOG(LogLevel::Warning) << "Could not determine aggressor name for trade events";
 		aggressorName = "";
 	}
 
@@ -1194,14 +1194,14 @@ void HoI4::Events::createWarJustificationEvents(const std::set<std::string>& maj
 void HoI4::Events::importElectionEvents(const std::set<std::string>& majorIdeologies, HoI4::OnActions& onActions)
 {
 	clearRegisteredKeywords();
-	registerKeyword(std::regex("country_event"), [this, majorIdeologies](const std::string& type, std::istream& theStream){
+	registerKeyword("country_event", [this, majorIdeologies](const std::string& type, std::istream& theStream){
 		Event electionEvent(type, theStream);
 		if ((majorIdeologies.count("democratic") > 0) || (electionEvent.id != "election.3"))
 		{
 			electionEvents.push_back(electionEvent);
 		}
 	});
-	registerKeyword(std::regex("[A-Za-z0-9\\_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9\\_]+", commonItems::ignoreItem);
 
 	parseFile("blankmod/output/events/ElectionEvents.txt");
 
@@ -1212,7 +1212,7 @@ void HoI4::Events::importElectionEvents(const std::set<std::string>& majorIdeolo
 }
 
 
-void HoI4::Events::addPartyChoiceEvent(const std::string& countryTag, const std::set<Vic2::Party, std::function<bool (const Vic2::Party&, const Vic2::Party&)>>& parties, HoI4::OnActions& onActions, const set<string>& majorIdeologies)
+void HoI4::Events::addPartyChoiceEvent(const std::string& countryTag, const std::set<Vic2::Party, std::function<bool (const Vic2::Party&, const Vic2::Party&)>>& parties, HoI4::OnActions& onActions, const set<string>& majorIdeologies, const V2Localisations& theVic2Localisations)
 {
 	Event partyChoiceEvent;
 
@@ -1262,7 +1262,7 @@ void HoI4::Events::addPartyChoiceEvent(const std::string& countryTag, const std:
 			option += "		retire_country_leader = yes\n";
 			option += "	}";
 			partyChoiceEvent.options.push_back(option);
-			HoI4Localisation::addEventLocalisationFromVic2(partyName, optionName);
+			HoI4Localisation::addEventLocalisationFromVic2(partyName, optionName, theVic2Localisations);
 			optionLetter++;
 		}
 	}
@@ -1276,8 +1276,8 @@ void HoI4::Events::addPartyChoiceEvent(const std::string& countryTag, const std:
 void HoI4::Events::createStabilityEvents(const std::set<std::string>& majorIdeologies)
 {
 	clearRegisteredKeywords();
-	registerKeyword(std::regex("add_namespace"), commonItems::ignoreString);
-	registerKeyword(std::regex("country_event"), [this](const std::string& type, std::istream& theStream)
+	registerKeyword("add_namespace", commonItems::ignoreString);
+	registerKeyword("country_event", [this](const std::string& type, std::istream& theStream)
 		{
 			Event newEvent(type, theStream);
 			if (newEvent.id.substr(0, 9) == "stability")
@@ -38,6 +38,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 class HoI4Country;
+class V2Localisations;
 
 
 
@@ -59,7 +60,7 @@ class Events: commonItems::parser
 		void createPoliticalEvents(const std::set<std::string>& majorIdeologies);
 		void createWarJustificationEvents(const std::set<std::string>& majorIdeologies);
 		void importElectionEvents(const std::set<std::string>& majorIdeologies, HoI4::OnActions& onActions);
-		void addPartyChoiceEvent(const std::string& countryTag, const std::set<Vic2::Party, std::function<bool (const Vic2::Party&, const Vic2::Party&)>>& parties, HoI4::OnActions& onActions, const std::set<std::string>& majorIdeologies);
+		void addPartyChoiceEvent(const std::string& countryTag, const std::set<Vic2::Party, std::function<bool (const Vic2::Party&, const Vic2::Party&)>>& parties, HoI4::OnActions& onActions, const std::set<std::string>& majorIdeologies, const V2Localisations& theVic2Localisations);
 		void createStabilityEvents(const std::set<std::string>& majorIdeologies);
 
 		std::optional<int> getEventNumber(const std::string& eventName) const;
@@ -30,7 +30,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
-void HoI4::Army::convertArmies(const militaryMappings& theMilitaryMappings, int backupLocation)
+void HoI4::Army::convertArmies(const militaryMappings& theMilitaryMappings, int backupLocation, const provinceMapper& theProvinceMapper)
 {
 	std::map<std::string, std::vector<sizedRegiment>> remainingBattalionsAndCompanies;
 
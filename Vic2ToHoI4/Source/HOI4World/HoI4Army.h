@@ -44,6 +44,9 @@ class Army;
 }
 
 
+class provinceMapper;
+
+
 namespace HoI4
 {
 
@@ -61,7 +64,7 @@ class Army
 
 		void addSourceArmies(std::vector<const Vic2::Army*> _sourceArmies) { sourceArmies = _sourceArmies; }
 
-		void convertArmies(const militaryMappings& theMilitaryMappings, int backupLocation);
+		void convertArmies(const militaryMappings& theMilitaryMappings, int backupLocation, const provinceMapper& theProvinceMapper);
 
 		friend std::ostream& operator << (std::ostream& output, const Army& theArmy);
 
@@ -55,7 +55,7 @@ std::ostream& HoI4::operator << (std::ostream& out, const HoI4::Building& buildi
 }
 
 
-HoI4::Buildings::Buildings(const HoI4States& theStates, const coastalProvinces& theCoastalProvinces, MapData& theMapData)
+HoI4::Buildings::Buildings(const HoI4States& theStates, const coastalProvinces& theCoastalProvinces, const MapData& theMapData)
 {
 	LOG(LogLevel::Info) << "Creating buildings";
 
@@ -64,7 +64,7 @@ HoI4::Buildings::Buildings(const HoI4States& theStates, const coastalProvinces&
 }
 
 
-void HoI4::Buildings::importDefaultBuildings(MapData& theMapData)
+void HoI4::Buildings::importDefaultBuildings(const MapData& theMapData)
 {
 	std::ifstream buildingsFile(theConfiguration.getHoI4Path() + "/map/buildings.txt");
 	if (!buildingsFile.is_open())
@@ -82,7 +82,7 @@ void HoI4::Buildings::importDefaultBuildings(MapData& theMapData)
 }
 
 
-void HoI4::Buildings::processLine(const std::string& line, MapData& theMapData)
+void HoI4::Buildings::processLine(const std::string& line, const MapData& theMapData)
 {
 	std::regex pattern("(.+);(.+);(.+);(.+);(.+);(.+);(.+)");
 	std::smatch matches;
@@ -132,7 +132,7 @@ void HoI4::Buildings::processLine(const std::string& line, MapData& theMapData)
 }
 
 
-void HoI4::Buildings::importDefaultBuilding(const std::smatch& matches, defaultPositions& positions, MapData& theMapData)
+void HoI4::Buildings::importDefaultBuilding(const std::smatch& matches, defaultPositions& positions, const MapData& theMapData)
 {
 	buildingPosition position;
 	position.xCoordinate = stof(matches[3].str());
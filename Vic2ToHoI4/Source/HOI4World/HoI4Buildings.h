@@ -82,7 +82,7 @@ typedef std::map<std::pair<int, int>, buildingPosition> defaultPositions;
 class Buildings
 {
 	public:
-		explicit Buildings(const HoI4States& theStates, const coastalProvinces& theCoastalProvinces, MapData& theMapData);
+		explicit Buildings(const HoI4States& theStates, const coastalProvinces& theCoastalProvinces, const MapData& theMapData);
 
 		void output() const;
 
@@ -90,9 +90,9 @@ class Buildings
 		Buildings(const Buildings&) = delete;
 		Buildings& operator=(const Buildings&) = delete;
 
-		void importDefaultBuildings(MapData& theMapData);
-		void processLine(const std::string& line, MapData& theMapData);
-		void importDefaultBuilding(const std::smatch& matches, defaultPositions& positions, MapData& theMapData);
+		void importDefaultBuildings(const MapData& theMapData);
+		void processLine(const std::string& line, const MapData& theMapData);
+		void importDefaultBuilding(const std::smatch& matches, defaultPositions& positions, const MapData& theMapData);
 
 		void placeBuildings(const HoI4States& theStates, const coastalProvinces& theCoastalProvinces, const MapData& theMapData);
 		void placeArmsFactories(const HoI4States& theStates, const MapData& theMapData);
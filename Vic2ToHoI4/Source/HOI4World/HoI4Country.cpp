@@ -96,7 +96,7 @@ HoI4Country::HoI4Country(const string& _tag, const string& _commonCountryFile, c
 }
 
 
-void HoI4Country::initFromV2Country(const Vic2::World& _srcWorld, const Vic2::Country* _srcCountry, const map<int, int>& stateMap, const map<int, HoI4::State*>& states, HoI4::namesMapper& theNames, const graphicsMapper& theGraphics, const CountryMapper& countryMap)
+void HoI4Country::initFromV2Country(const Vic2::World& _srcWorld, const Vic2::Country* _srcCountry, const map<int, int>& stateMap, const map<int, HoI4::State*>& states, HoI4::namesMapper& theNames, const graphicsMapper& theGraphics, const CountryMapper& countryMap, const provinceMapper& theProvinceMapper)
 {
 	srcCountry = _srcCountry;
 
@@ -155,7 +155,7 @@ void HoI4Country::initFromV2Country(const Vic2::World& _srcWorld, const Vic2::Co
 	convertLeaders(theGraphics);
 	convertRelations(countryMap);
 
-	determineCapitalFromVic2(stateMap, states);
+	determineCapitalFromVic2(stateMap, states, theProvinceMapper);
 	if (isThisStateOwnedByUs(capitalState))
 	{
 		capitalState->setAsCapitalState();
@@ -186,7 +186,7 @@ void HoI4Country::determineFilename()
 }
 
 
-void HoI4Country::convertGovernment(const Vic2::World& sourceWorld, const governmentMapper& governmentMap)
+void HoI4Country::convertGovernment(const Vic2::World& sourceWorld, const governmentMapper& governmentMap, const V2Localisations& theVic2Localisations)
 {
 	auto possibleRulingParty = srcCountry->getRulingParty(sourceWorld.getParties());
 	if (!possibleRulingParty)
@@ -207,12 +207,12 @@ void HoI4Country::convertGovernment(const Vic2::World& sourceWorld, const govern
 	{
 		string partyName = party.getName();
 		string trimmedName = partyName.substr(4, partyName.size());
-		HoI4Localisation::addPoliticalPartyLocalisation(partyName, tag + "_" + trimmedName + "_party");
+		HoI4Localisation::addPoliticalPartyLocalisation(partyName, tag + "_" + trimmedName + "_party", theVic2Localisations);
 	}
 }
 
 
-void HoI4Country::convertParties(const set<string>& majorIdeologies, const governmentMapper& governmentMap)
+void HoI4Country::convertParties(const set<string>& majorIdeologies, const governmentMapper& governmentMap, const V2Localisations& theVic2Localisations)
 {
 	for (auto HoI4Ideology: majorIdeologies)
 	{
@@ -220,11 +220,11 @@ void HoI4Country::convertParties(const set<string>& majorIdeologies, const gover
 		{
 			if (governmentMap.getSupportedIdeology(governmentIdeology, party.getIdeology(), majorIdeologies) == HoI4Ideology)
 			{
-				HoI4Localisation::addPoliticalPartyLocalisation(party.getName(), tag + "_" + HoI4Ideology + "_party");
+				HoI4Localisation::addPoliticalPartyLocalisation(party.getName(), tag + "_" + HoI4Ideology + "_party", theVic2Localisations);
 			}
 		}
 	}
-	HoI4Localisation::addPoliticalPartyLocalisation(rulingParty.getName(), tag + "_" + governmentIdeology + "_party");
+	HoI4Localisation::addPoliticalPartyLocalisation(rulingParty.getName(), tag + "_" + governmentIdeology + "_party", theVic2Localisations);
 }
 
 
@@ -285,8 +285,6 @@ void HoI4Country::convertLeaders(const graphicsMapper& theGraphics)
 			admirals.push_back(newLeader);
 		}
 	}
-
-	theConfiguration.setLeaderIDForNextCountry();
 }
 
 
@@ -305,7 +303,7 @@ void HoI4Country::convertRelations(const CountryMapper& countryMap)
 }
 
 
-void HoI4Country::determineCapitalFromVic2(const map<int, int>& provinceToStateIDMap, const map<int, HoI4::State*>& states)
+void HoI4Country::determineCapitalFromVic2(const map<int, int>& provinceToStateIDMap, const map<int, HoI4::State*>& states, const provinceMapper& theProvinceMapper)
 {
 	int oldCapital = srcCountry->getCapital();
 	if (auto mapping = theProvinceMapper.getVic2ToHoI4ProvinceMapping(oldCapital))
@@ -407,7 +405,7 @@ void HoI4Country::convertIdeologySupport(const set<string>& majorIdeologies, con
 }
 
 
-void HoI4Country::convertNavies(const map<string, HoI4::UnitMap>& unitMap, const HoI4::coastalProvinces& theCoastalProvinces, const std::map<int, int>& provinceToStateIDMap)
+void HoI4Country::convertNavies(const map<string, HoI4::UnitMap>& unitMap, const HoI4::coastalProvinces& theCoastalProvinces, const std::map<int, int>& provinceToStateIDMap, const provinceMapper& theProvinceMapper, const provinceDefinitions& theProvinceDefinitions)
 {
 	int backupNavalLocation = 0;
 	for (auto state: states)
@@ -433,7 +431,7 @@ void HoI4Country::convertNavies(const map<string, HoI4::UnitMap>& unitMap, const
 		{
 			for (auto possibleProvince: *mapping)
 			{
-				if (provinceDefinitions::isSeaProvince(possibleProvince))
+				if (theProvinceDefinitions.isSeaProvince(possibleProvince))
 				{
 					navalLocation = possibleProvince;
 					break;
@@ -557,14 +555,14 @@ void HoI4Country::convertAirforce(const map<string, HoI4::UnitMap>& unitMap)
 }
 
 
-void HoI4Country::convertArmies(const HoI4::militaryMappings& theMilitaryMappings)
+void HoI4Country::convertArmies(const HoI4::militaryMappings& theMilitaryMappings, const provinceMapper& theProvinceMapper)
 {
 	int backupLocation = 0;
 	if (capitalState != nullptr)
 	{
 		backupLocation = capitalState->getVPLocation();
 	}
-	theArmy.convertArmies(theMilitaryMappings, backupLocation);
+	theArmy.convertArmies(theMilitaryMappings, backupLocation, theProvinceMapper);
 }
 
 
@@ -847,7 +845,7 @@ void HoI4Country::outputHistory(HoI4::namesMapper& theNames, graphicsMapper& the
 	ofstream output("output/" + theConfiguration.getOutputName() + "/history/countries/" + Utils::normalizeUTF8Path(filename));
 	if (!output.is_open())
 	{
-		Log(LogLevel::Error) << "Could not open output/" << theConfiguration.getOutputName() << "/history/countries/" << Utils::normalizeUTF8Path(filename);
+		LOG(LogLevel::Error) << "Could not open output/" << theConfiguration.getOutputName() << "/history/countries/" << Utils::normalizeUTF8Path(filename);
 		exit(-1);
 	}
 	output << "\xEF\xBB\xBF";    // add the BOM to make HoI4 happy
@@ -1217,7 +1215,7 @@ void HoI4Country::outputOOB(const vector<HoI4::DivisionTemplateType>& divisionTe
 	ofstream output("output/" + theConfiguration.getOutputName() + "/history/units/" + tag + "_OOB.txt");
 	if (!output.is_open())
 	{
-		Log(LogLevel::Error) << "Could not open output/" << theConfiguration.getOutputName() << "/history/units/" << tag << "_OOB.txt";
+		LOG(LogLevel::Error) << "Could not open output/" << theConfiguration.getOutputName() << "/history/units/" << tag << "_OOB.txt";
 		exit(-1);
 	}
 	output << "\xEF\xBB\xBF";	// add the BOM to make HoI4 happy
@@ -1386,7 +1384,7 @@ void HoI4Country::outputCommonCountryFile() const
 	ofstream output("output/" + theConfiguration.getOutputName() + "/common/countries/" + Utils::normalizeUTF8Path(commonCountryFile));
 	if (!output.is_open())
 	{
-		Log(LogLevel::Error) << "Could not open " << "output/" << theConfiguration.getOutputName() << "/common/countries/" << Utils::normalizeUTF8Path(commonCountryFile);
+		LOG(LogLevel::Error) << "Could not open " << "output/" << theConfiguration.getOutputName() << "/common/countries/" << Utils::normalizeUTF8Path(commonCountryFile);
 		exit(-1);
 	}
 
@@ -76,6 +76,9 @@ struct advisorCompare;
 class CountryMapper;
 class governmentMapper;
 class graphicsMapper;
+class provinceDefinitions;
+class provinceMapper;
+class V2Localisations;
 
 
 
@@ -84,15 +87,15 @@ class HoI4Country
 	public:
 		HoI4Country(const string& _tag, const string& _commonCountryFile, const HoI4::World* _theWorld);
 
-		void initFromV2Country(const Vic2::World& _srcWorld, const Vic2::Country* _srcCountry, const std::map<int, int>& stateMap, const std::map<int, HoI4::State*>& states, HoI4::namesMapper& theNames, const graphicsMapper& theGraphics, const CountryMapper& countryMap);
+		void initFromV2Country(const Vic2::World& _srcWorld, const Vic2::Country* _srcCountry, const std::map<int, int>& stateMap, const std::map<int, HoI4::State*>& states, HoI4::namesMapper& theNames, const graphicsMapper& theGraphics, const CountryMapper& countryMap, const provinceMapper& theProvinceMapper);
 		void setGovernmentToExistingIdeology(const set<string>& majorIdeologies, const map<string, HoI4Ideology*>& ideologies, const governmentMapper& governmentMap);
-		void convertGovernment(const Vic2::World& _srcWorld, const governmentMapper& governmentMap);
-		void convertParties(const set<string>& majorIdeologies, const governmentMapper& governmentMap);
+		void convertGovernment(const Vic2::World& _srcWorld, const governmentMapper& governmentMap, const V2Localisations& theVic2Localisations);
+		void convertParties(const set<string>& majorIdeologies, const governmentMapper& governmentMap, const V2Localisations& theVic2Localisations);
 		void convertIdeologySupport(const set<string>& majorIdeologies, const governmentMapper& governmentMap);
-		void convertNavies(const map<string, HoI4::UnitMap>& unitMap, const HoI4::coastalProvinces& theCoastalProvinces, const std::map<int, int>& provinceToStateIDMap);
+		void convertNavies(const map<string, HoI4::UnitMap>& unitMap, const HoI4::coastalProvinces& theCoastalProvinces, const std::map<int, int>& provinceToStateIDMap, const provinceMapper& theProvinceMapper, const provinceDefinitions& theProvinceDefinitions);
 		void convertConvoys(const map<string, HoI4::UnitMap>& unitMap);
 		void convertAirforce(const map<string, HoI4::UnitMap>& unitMap);
-		void convertArmies(const HoI4::militaryMappings& theMilitaryMappings);
+		void convertArmies(const HoI4::militaryMappings& theMilitaryMappings, const provinceMapper& theProvinceMapper);
 		void		setTechnology(const string& tech, int level);
 		void		setResearchBonus(const string& tech, int bonus);
 		void addState(HoI4::State* _state);
@@ -161,7 +164,7 @@ class HoI4Country
 		void convertLaws();
 		void convertLeaders(const graphicsMapper& theGraphics);
 		void convertRelations(const CountryMapper& countryMap);
-		void determineCapitalFromVic2(const map<int, int>& provinceToStateIDMap, const map<int, HoI4::State*>& states);
+		void determineCapitalFromVic2(const map<int, int>& provinceToStateIDMap, const map<int, HoI4::State*>& states, const provinceMapper& theProvinceMapper);
 		bool isStateValidForCapital(int capitalState, const map<int, HoI4::State*>& states);
 		bool isThisStateOwnedByUs(const HoI4::State* state) const;
 		bool isThisStateACoreWhileWeOwnNoStates(const HoI4::State* state) const;
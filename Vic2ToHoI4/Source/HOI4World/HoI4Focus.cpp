@@ -29,110 +29,122 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 HoI4Focus::HoI4Focus(std::istream& theStream)
 {
-	registerKeyword(std::regex("id"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::singleString idString(theStream);
-			id = idString.getString();
-		}
-	);
-	registerKeyword(std::regex("icon"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::singleString iconString(theStream);
-			icon = iconString.getString();
-		}
-	);
-	registerKeyword(std::regex("text"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::singleString textString(theStream);
-			text = textString.getString();
-		}
-	);
-	registerKeyword(std::regex("mutually_exclusive"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::stringOfObject mutuallyExclusiveString(theStream);
-			mutuallyExclusive = mutuallyExclusiveString.getString();
-		}
-	);
-	registerKeyword(std::regex("bypass"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::stringOfObject bypassString(theStream);
-			bypass = bypassString.getString();
-		}
-	);
-	registerKeyword(std::regex("x"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::singleInt xPosInt(theStream);
-			xPos = xPosInt.getInt();
-		}
-	);
-	registerKeyword(std::regex("y"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::singleInt yPosInt(theStream);
-			yPos = yPosInt.getInt();
-		}
-	);
-	registerKeyword(std::regex("relative_position_id"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::singleString relativePositionIdString(theStream);
-			relativePositionId = relativePositionIdString.getString();
-		}
-	);
-	registerKeyword(std::regex("cost"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::singleInt costInt(theStream);
-			cost = costInt.getInt();
-		}
-	);
-	registerKeyword(std::regex("available_if_capitulated"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::singleString availableIfCapitulatedString(theStream);
-			availableIfCapitulated = (availableIfCapitulatedString.getString() == "yes");
-		}
-	);
-	registerKeyword(std::regex("available"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::stringOfObject availableString(theStream);
-			available = availableString.getString();
-		}
-	);
-	registerKeyword(std::regex("cancel_if_invalid"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::singleString cancelIfInvalidString(theStream);
-			cancelIfInvalid = cancelIfInvalidString.getString();
-		}
-	);
-	registerKeyword(std::regex("continue_if_invalid"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::singleString continueIfInvalidString(theStream);
-			continueIfInvalid = continueIfInvalidString.getString();
-		}
-	);
-	registerKeyword(std::regex("complete_tooltip"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::stringOfObject completeTooltipString(theStream);
-			completeTooltip = completeTooltipString.getString();
-		}
-	);
-	registerKeyword(std::regex("completion_reward"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::stringOfObject completionRewardString(theStream);
-			completionReward = completionRewardString.getString();
-		}
-	);
-	registerKeyword(std::regex("ai_will_do"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::stringOfObject aiWillDoString(theStream);
-			aiWillDo = aiWillDoString.getString();
-		}
-	);
-	registerKeyword(std::regex("prerequisite"), [this](const std::string& unused, std::istream& theStream)
-		{
-			commonItems::stringOfObject prerequisiteString(theStream);
-			prerequisites.push_back(prerequisiteString.getString());
-		}
-	);
+	getSchema().parseStream(*this, theStream);
+}
+
+
+const commonItems::parserSchema<HoI4Focus>& HoI4Focus::getSchema()
+{
+	static const auto theSchema = []()
+	{
+		commonItems::parserSchema<HoI4Focus> schema;
+		schema.registerKeyword("id", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleString idString(theStream);
+				focus.id = idString.getString();
+			}
+		);
+		schema.registerKeyword("icon", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleString iconString(theStream);
+				focus.icon = iconString.getString();
+			}
+		);
+		schema.registerKeyword("text", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleString textString(theStream);
+				focus.text = textString.getString();
+			}
+		);
+		schema.registerKeyword("mutually_exclusive", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::stringOfObject mutuallyExclusiveString(theStream);
+				focus.mutuallyExclusive = mutuallyExclusiveString.getString();
+			}
+		);
+		schema.registerKeyword("bypass", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::stringOfObject bypassString(theStream);
+				focus.bypass = bypassString.getString();
+			}
+		);
+		schema.registerKeyword("x", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleInt xPosInt(theStream);
+				focus.xPos = xPosInt.getInt();
+			}
+		);
+		schema.registerKeyword("y", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleInt yPosInt(theStream);
+				focus.yPos = yPosInt.getInt();
+			}
+		);
+		schema.registerKeyword("relative_position_id", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleString relativePositionIdString(theStream);
+				focus.relativePositionId = relativePositionIdString.getString();
+			}
+		);
+		schema.registerKeyword("cost", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleInt costInt(theStream);
+				focus.cost = costInt.getInt();
+			}
+		);
+		schema.registerKeyword("available_if_capitulated", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleString availableIfCapitulatedString(theStream);
+				focus.availableIfCapitulated = (availableIfCapitulatedString.getString() == "yes");
+			}
+		);
+		schema.registerKeyword("available", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::stringOfObject availableString(theStream);
+				focus.available = availableString.getString();
+			}
+		);
+		schema.registerKeyword("cancel_if_invalid", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleString cancelIfInvalidString(theStream);
+				focus.cancelIfInvalid = cancelIfInvalidString.getString();
+			}
+		);
+		schema.registerKeyword("continue_if_invalid", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::singleString continueIfInvalidString(theStream);
+				focus.continueIfInvalid = continueIfInvalidString.getString();
+			}
+		);
+		schema.registerKeyword("complete_tooltip", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::stringOfObject completeTooltipString(theStream);
+				focus.completeTooltip = completeTooltipString.getString();
+			}
+		);
+		schema.registerKeyword("completion_reward", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::stringOfObject completionRewardString(theStream);
+				focus.completionReward = completionRewardString.getString();
+			}
+		);
+		schema.registerKeyword("ai_will_do", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::stringOfObject aiWillDoString(theStream);
+				focus.aiWillDo = aiWillDoString.getString();
+			}
+		);
+		schema.registerKeyword("prerequisite", [](HoI4Focus& focus, const std::string& unused, std::istream& theStream)
+			{
+				commonItems::stringOfObject prerequisiteString(theStream);
+				focus.prerequisites.push_back(prerequisiteString.getString());
+			}
+		);
+
+		return schema;
+	}();
 
-	parseStream(theStream);
+	return theSchema;
 }
 
 
@@ -32,7 +32,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
-class HoI4Focus: commonItems::parser
+class HoI4Focus
 {
 	public:
 		HoI4Focus() = default;
@@ -64,6 +64,8 @@ class HoI4Focus: commonItems::parser
 	private:
 		HoI4Focus& operator=(const HoI4Focus&) = delete;
 
+		static const commonItems::parserSchema<HoI4Focus>& getSchema();
+
 		void customizeMutualExclusion(std::shared_ptr<HoI4Focus> newFocus, const std::string& country) const;
 		void customizePrerequisite(std::shared_ptr<HoI4Focus> newFocus, std::string& prerequisite, const std::string& country) const;
 };
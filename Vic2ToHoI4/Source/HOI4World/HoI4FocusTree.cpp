@@ -346,12 +346,12 @@ void HoI4FocusTree::confirmLoadedFocuses()
 {
 	if (loadedFocuses.size() == 0)
 	{
-		registerKeyword(std::regex("focus_tree"), [this](const std::string& unused, std::istream& theStream) {});
-		registerKeyword(std::regex("id"), commonItems::ignoreString);
-		registerKeyword(std::regex("country"), commonItems::ignoreObject);
-		registerKeyword(std::regex("default"), commonItems::ignoreString);
-		registerKeyword(std::regex("reset_on_civilwar"), commonItems::ignoreString);
-		registerKeyword(std::regex("focus"), [this](const std::string& unused, std::istream& theStream)
+		registerKeyword("focus_tree", [this](const std::string& unused, std::istream& theStream) {});
+		registerKeyword("id", commonItems::ignoreString);
+		registerKeyword("country", commonItems::ignoreObject);
+		registerKeyword("default", commonItems::ignoreString);
+		registerKeyword("reset_on_civilwar", commonItems::ignoreString);
+		registerKeyword("focus", [this](const std::string& unused, std::istream& theStream)
 		{
 			HoI4Focus newFocus(theStream);
 			loadedFocuses.insert(make_pair(newFocus.id, newFocus));
@@ -25,6 +25,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "HoI4State.h"
 #include "HoI4States.h"
 #include "../Mappers/GovernmentMapper.h"
+#include "../Mappers/ProvinceMapper.h"
 #include "../Mappers/V2Localisations.h"
 #include "../V2World/Country.h"
 #include "../V2World/State.h"
@@ -35,10 +36,6 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
-HoI4Localisation* HoI4Localisation::instance = nullptr;
-
-
-
 HoI4Localisation::HoI4Localisation() noexcept
 {
 	importLocalisations();
@@ -170,31 +167,34 @@ void HoI4Localisation::prepareIdeaLocalisations()
 }
 
 
-void HoI4Localisation::CreateCountryLocalisations(const pair<const string&, const string&>& tags, const governmentMapper& governmentMap)
+void HoI4Localisation::CreateCountryLocalisations(const pair<const string&, const string&>& tags, const string& domainName, const governmentMapper& governmentMap, const V2Localisations& theVic2Localisations)
 {
-	addLocalisationsForAllGovernments(tags, make_pair(string(""), string("_DEF")), governmentMap);
-	addLocalisationsForAllGovernments(tags, make_pair(string("_ADJ"), string("")), governmentMap);
+	const auto plainName = getVic2CountryName(tags.first, domainName, theVic2Localisations);
+	const auto& plainAdjective = theVic2Localisations.GetTextInEachLanguage(tags.first + "_ADJ");
+
+	addLocalisationsForAllGovernments(tags, make_pair(string(""), string("_DEF")), plainName, governmentMap, theVic2Localisations);
+	addLocalisationsForAllGovernments(tags, make_pair(string("_ADJ"), string("")), plainAdjective, governmentMap, theVic2Localisations);
 
-	if (!addNeutralLocalisation(tags, make_pair(string(""), string("_DEF"))))
+	if (!addNeutralLocalisation(tags.second, make_pair(string(""), string("_DEF")), plainName))
 	{
 		LOG(LogLevel::Warning) << "Could not find plain localisation for " << tags.first;
 	}
-	if (!addNeutralLocalisation(tags, make_pair(string("_ADJ"), string(""))))
+	if (!addNeutralLocalisation(tags.second, make_pair(string("_ADJ"), string("")), plainAdjective))
 	{
 		LOG(LogLevel::Warning) << "Could not find plain adjective localisation for " << tags.first;
 	}
 }
 
 
-void HoI4Localisation::addLocalisationsForAllGovernments(const pair<const string&, const string&>& tags, const pair<const string&, const string&>& suffixes, const governmentMapper& governmentMap)
+void HoI4Localisation::addLocalisationsForAllGovernments(const pair<const string&, const string&>& tags, const pair<const string&, const string&>& suffixes, const keyToLocalisationMap& plainLocalisation, const governmentMapper& governmentMap, const V2Localisations& theVic2Localisations)
 {
 	for (auto mapping: governmentMap.getGovernmentMappings())
 	{
-		auto localisationForGovernment = V2Localisations::GetTextInEachLanguage(tags.first + "_" + mapping.vic2Government + suffixes.first);
+		auto localisationForGovernment = theVic2Localisations.GetTextInEachLanguage(tags.first + "_" + mapping.vic2Government + suffixes.first);
 		addLocalisationsInAllLanguages(tags.second, suffixes, mapping.HoI4GovernmentIdeology, localisationForGovernment);
 		if (localisationForGovernment.size() == 0)
 		{
-			addLocalisationsInAllLanguages(tags.second, suffixes, mapping.HoI4GovernmentIdeology, V2Localisations::GetTextInEachLanguage(tags.first + suffixes.first));
+			addLocalisationsInAllLanguages(tags.second, suffixes, mapping.HoI4GovernmentIdeology, plainLocalisation);
 		}
 	}
 }
@@ -212,16 +212,15 @@ void HoI4Localisation::addLocalisationsInAllLanguages(const string& destTag, con
 }
 
 
-bool HoI4Localisation::addNeutralLocalisation(const pair<const string&, const string&>& tags, const pair<const string&, const string&>& suffixes)
+bool HoI4Localisation::addNeutralLocalisation(const string& HoI4Tag, const pair<const string&, const string&>& suffixes, const keyToLocalisationMap& plainLocalisation)
 {
-	auto plainLocalisation = V2Localisations::GetTextInEachLanguage(tags.first + suffixes.first);
 	if (plainLocalisation.size() > 0)
 	{
 		for (auto nameInLanguage: plainLocalisation)
 		{
 			auto existingLanguage = getExistingLocalisationsInLanguage(nameInLanguage.first);
 
-			string newKey = tags.second + "_neutrality" + suffixes.first;
+			string newKey = HoI4Tag + "_neutrality" + suffixes.first;
 			addLocalisation(newKey, existingLanguage, nameInLanguage.second, suffixes.second);
 		}
 		return true;
@@ -233,6 +232,19 @@ bool HoI4Localisation::addNeutralLocalisation(const pair<const string&, const st
 }
 
 
+keyToLocalisationMap HoI4Localisation::getVic2CountryName(const string& Vic2Tag, const string& domainName, const V2Localisations& theVic2Localisations) const
+{
+	if (domainName.empty())
+	{
+		return theVic2Localisations.GetTextInEachLanguage(Vic2Tag);
+	}
+	else
+	{
+		return theVic2Localisations.GetDomainCountryNames(Vic2Tag, domainName);
+	}
+}
+
+
 languageToLocalisationsMap::iterator HoI4Localisation::getExistingLocalisationsInLanguage(const string& language)
 {
 	auto existingLanguage = countryLocalisations.find(language);
@@ -269,26 +281,27 @@ void HoI4Localisation::addLocalisation(const string& newKey, languageToLocalisat
 }
 
 
-void HoI4Localisation::UpdateMainCountryLocalisation(const std::string& HoI4Key, const std::string& Vic2Tag, const std::string& Vic2Government)
+void HoI4Localisation::UpdateMainCountryLocalisation(const std::string& HoI4Key, const std::string& Vic2Tag, const std::string& Vic2Government, const std::string& domainName, const V2Localisations& theVic2Localisations)
 {
-	if (!attemptToUpdateMainCountryLocalisation(HoI4Key, Vic2Tag + "_" + Vic2Government))
+	const auto& governmentName = theVic2Localisations.GetTextInEachLanguage(Vic2Tag + "_" + Vic2Government);
+	if (!attemptToUpdateMainCountryLocalisation(HoI4Key, governmentName))
 	{
-		attemptToUpdateMainCountryLocalisation(HoI4Key, Vic2Tag);
+		attemptToUpdateMainCountryLocalisation(HoI4Key, getVic2CountryName(Vic2Tag, domainName, theVic2Localisations));
 	}
-	if (!attemptToUpdateMainCountryLocalisation(HoI4Key + "_DEF", Vic2Tag + "_" + Vic2Government))
+	if (!attemptToUpdateMainCountryLocalisation(HoI4Key + "_DEF", governmentName))
 	{
-		attemptToUpdateMainCountryLocalisation(HoI4Key + "_DEF", Vic2Tag);
+		attemptToUpdateMainCountryLocalisation(HoI4Key + "_DEF", getVic2CountryName(Vic2Tag, domainName, theVic2Localisations));
 	}
-	if (!attemptToUpdateMainCountryLocalisation(HoI4Key + "_ADJ", Vic2Tag + "_" + Vic2Government + "_ADJ"))
+	if (!attemptToUpdateMainCountryLocalisation(HoI4Key + "_ADJ", theVic2Localisations.GetTextInEachLanguage(Vic2Tag + "_" + Vic2Government + "_ADJ")))
 	{
-		attemptToUpdateMainCountryLocalisation(HoI4Key + "_ADJ", Vic2Tag + "_ADJ");
+		attemptToUpdateMainCountryLocalisation(HoI4Key + "_ADJ", theVic2Localisations.GetTextInEachLanguage(Vic2Tag + "_ADJ"));
 	}
 }
 
 
-bool HoI4Localisation::attemptToUpdateMainCountryLocalisation(const std::string& HoI4Key, const std::string& Vic2Key)
+bool HoI4Localisation::attemptToUpdateMainCountryLocalisation(const std::string& HoI4Key, const keyToLocalisationMap& Vic2Text)
 {
-	if (auto Vic2Text = V2Localisations::GetTextInEachLanguage(Vic2Key); Vic2Text.size() > 0)
+	if (Vic2Text.size() > 0)
 	{
 		for (auto textInLanguage: Vic2Text)
 		{
@@ -367,20 +380,20 @@ void HoI4Localisation::CopyEventLocalisations(const string& oldKey, const string
 }
 
 
-void HoI4Localisation::AddStateLocalisations(const HoI4States* states)
+void HoI4Localisation::AddStateLocalisations(const HoI4States* states, const V2Localisations& theVic2Localisations, const provinceMapper& theProvinceMapper)
 {
 	for (auto state: states->getStates())
 	{
-		for (auto Vic2NameInLanguage: V2Localisations::GetTextInEachLanguage(state.second->getSourceState()->getStateID()))
+		for (auto Vic2NameInLanguage: theVic2Localisations.GetTextInEachLanguage(state.second->getSourceState()->getStateID()))
 		{
-			addStateLocalisationForLanguage(state.second, Vic2NameInLanguage);
+			addStateLocalisationForLanguage(state.second, Vic2NameInLanguage, theVic2Localisations);
 		}
 
 		int VPPositionInHoI4 = state.second->getVPLocation();
 		auto VPProvinceMapping = theProvinceMapper.getHoI4ToVic2ProvinceMapping(VPPositionInHoI4);
 		if (VPProvinceMapping && (VPProvinceMapping->size() > 0))
 		{
-			for (auto Vic2NameInLanguage: V2Localisations::GetTextInEachLanguage("PROV" + to_string((*VPProvinceMapping)[0])))
+			for (auto Vic2NameInLanguage: theVic2Localisations.GetTextInEachLanguage("PROV" + to_string((*VPProvinceMapping)[0])))
 			{
 				addVPLocalisationForLanguage(state.second, Vic2NameInLanguage);
 			}
@@ -388,7 +401,7 @@ void HoI4Localisation::AddStateLocalisations(const HoI4States* states)
 
 		if (theConfiguration.getDebug())
 		{
-			addDebugLocalisations(state);
+			addDebugLocalisations(state, theVic2Localisations, theProvinceMapper);
 		}
 	}
 
@@ -397,14 +410,14 @@ void HoI4Localisation::AddStateLocalisations(const HoI4States* states)
 }
 
 
-void HoI4Localisation::addDebugLocalisations(const pair<const int, HoI4::State*>& state)
+void HoI4Localisation::addDebugLocalisations(const pair<const int, HoI4::State*>& state, const V2Localisations& theVic2Localisations, const provinceMapper& theProvinceMapper)
 {
 	for (auto VPPositionInHoI4: state.second->getDebugVPs())
 	{
 		auto VPProvinceMapping = theProvinceMapper.getHoI4ToVic2ProvinceMapping(VPPositionInHoI4);
 		if (VPProvinceMapping && (VPProvinceMapping->size() > 0))
 		{
-			for (auto Vic2NameInLanguage: V2Localisations::GetTextInEachLanguage("PROV" + to_string((*VPProvinceMapping)[0])))
+			for (auto Vic2NameInLanguage: theVic2Localisations.GetTextInEachLanguage("PROV" + to_string((*VPProvinceMapping)[0])))
 			{
 				getExistingVPLocalisation(Vic2NameInLanguage.first).insert(make_pair("VICTORY_POINTS_" + to_string(VPPositionInHoI4), Vic2NameInLanguage.second));
 			}
@@ -416,7 +429,7 @@ void HoI4Localisation::addDebugLocalisations(const pair<const int, HoI4::State*>
 		auto VPProvinceMapping = theProvinceMapper.getHoI4ToVic2ProvinceMapping(VPPositionInHoI4);
 		if (VPProvinceMapping && (VPProvinceMapping->size() > 0))
 		{
-			for (auto Vic2NameInLanguage: V2Localisations::GetTextInEachLanguage("PROV" + to_string((*VPProvinceMapping)[0])))
+			for (auto Vic2NameInLanguage: theVic2Localisations.GetTextInEachLanguage("PROV" + to_string((*VPProvinceMapping)[0])))
 			{
 				getExistingVPLocalisation(Vic2NameInLanguage.first).insert(make_pair("VICTORY_POINTS_" + to_string(VPPositionInHoI4), "_" + Vic2NameInLanguage.second));
 			}
@@ -425,14 +438,14 @@ void HoI4Localisation::addDebugLocalisations(const pair<const int, HoI4::State*>
 }
 
 
-void HoI4Localisation::addStateLocalisationForLanguage(const HoI4::State* state, const pair<const string, string>& Vic2NameInLanguage)
+void HoI4Localisation::addStateLocalisationForLanguage(const HoI4::State* state, const pair<const string, string>& Vic2NameInLanguage, const V2Localisations& theVic2Localisations)
 {
 	string key = string("STATE_") + to_string(state->getID());
 
 	string localisedName = "";
 	if (state->getSourceState()->isPartialState())
 	{
-		auto possibleOwnerAdjective = V2Localisations::GetTextInLanguage(state->getSourceState()->getOwner() + "_ADJ", Vic2NameInLanguage.first);
+		auto possibleOwnerAdjective = theVic2Localisations.GetTextInLanguage(state->getSourceState()->getOwner() + "_ADJ", Vic2NameInLanguage.first);
 		if (possibleOwnerAdjective)
 		{
 			localisedName += *possibleOwnerAdjective + " ";
@@ -517,9 +530,9 @@ void HoI4Localisation::AddEventLocalisation(const string& event, const string& l
 }
 
 
-void HoI4Localisation::AddEventLocalisationFromVic2(const string& Vic2Key, const string& HoI4Key)
+void HoI4Localisation::AddEventLocalisationFromVic2(const string& Vic2Key, const string& HoI4Key, const V2Localisations& theVic2Localisations)
 {
-	for (auto textInLanguage: V2Localisations::GetTextInEachLanguage(Vic2Key))
+	for (auto textInLanguage: theVic2Localisations.GetTextInEachLanguage(Vic2Key))
 	{
 		auto language = textInLanguage.first;
 		auto existingLanguage = newEventLocalisations.find(language);
@@ -568,9 +581,9 @@ void HoI4Localisation::AddIdeaLocalisation(const string& idea, const optional<st
 }
 
 
-void HoI4Localisation::AddPoliticalPartyLocalisation(const string& Vic2Key, const string& HoI4Key)
+void HoI4Localisation::AddPoliticalPartyLocalisation(const string& Vic2Key, const string& HoI4Key, const V2Localisations& theVic2Localisations)
 {
-	for (auto textInLanguage: V2Localisations::GetTextInEachLanguage(Vic2Key))
+	for (auto textInLanguage: theVic2Localisations.GetTextInEachLanguage(Vic2Key))
 	{
 		auto language = textInLanguage.first;
 		auto existingLanguage = politicalPartyLocalisations.find(language);
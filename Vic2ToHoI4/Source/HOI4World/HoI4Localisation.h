@@ -42,6 +42,8 @@ namespace HoI4
 class State;
 }
 class governmentMapper;
+class provinceMapper;
+class V2Localisations;
 
 
 
@@ -54,19 +56,20 @@ typedef std::map<std::string, keyToLocalisationMap> languageToLocalisationsMap;
 class HoI4Localisation
 {
 	public:
-		static void addStateLocalisations(const HoI4States* states)
+		static void addStateLocalisations(const HoI4States* states, const V2Localisations& theVic2Localisations, const provinceMapper& theProvinceMapper)
 		{
-			getInstance()->AddStateLocalisations(states);
+			getInstance()->AddStateLocalisations(states, theVic2Localisations, theProvinceMapper);
 		}
 
-		static void createCountryLocalisations(const std::pair<const std::string&, const std::string&>& tags, const governmentMapper& governmentMap)
+		// domainName is the Vic2 domain of a dominion, which fills the $REGION$ in its name, or empty
+		static void createCountryLocalisations(const std::pair<const std::string&, const std::string&>& tags, const std::string& domainName, const governmentMapper& governmentMap, const V2Localisations& theVic2Localisations)
 		{
-			getInstance()->CreateCountryLocalisations(tags, governmentMap);
+			getInstance()->CreateCountryLocalisations(tags, domainName, governmentMap, theVic2Localisations);
 		}
 
-		static void updateMainCountryLocalisation(const std::string& HoI4Key, const std::string& Vic2Tag, const std::string& Vic2Government)
+		static void updateMainCountryLocalisation(const std::string& HoI4Key, const std::string& Vic2Tag, const std::string& Vic2Government, const std::string& domainName, const V2Localisations& theVic2Localisations)
 		{
-			getInstance()->UpdateMainCountryLocalisation(HoI4Key, Vic2Tag, Vic2Government);
+			getInstance()->UpdateMainCountryLocalisation(HoI4Key, Vic2Tag, Vic2Government, domainName, theVic2Localisations);
 		}
 
 		static void addNonenglishCountryLocalisations()
@@ -89,9 +92,9 @@ class HoI4Localisation
 			getInstance()->AddEventLocalisation(event, localisation);
 		}
 
-		static void addEventLocalisationFromVic2(const std::string& Vic2Key, const std::string& HoI4Key)
+		static void addEventLocalisationFromVic2(const std::string& Vic2Key, const std::string& HoI4Key, const V2Localisations& theVic2Localisations)
 		{
-			getInstance()->AddEventLocalisationFromVic2(Vic2Key, HoI4Key);
+			getInstance()->AddEventLocalisationFromVic2(Vic2Key, HoI4Key, theVic2Localisations);
 		}
 
 		static void addIdeaLocalisation(const std::string& idea, const std::optional<std::string>& localisation)
@@ -99,9 +102,9 @@ class HoI4Localisation
 			getInstance()->AddIdeaLocalisation(idea, localisation);
 		}
 
-		static void addPoliticalPartyLocalisation(const std::string& Vic2Key, const std::string& HoI4Key)
+		static void addPoliticalPartyLocalisation(const std::string& Vic2Key, const std::string& HoI4Key, const V2Localisations& theVic2Localisations)
 		{
-			getInstance()->AddPoliticalPartyLocalisation(Vic2Key, HoI4Key);
+			getInstance()->AddPoliticalPartyLocalisation(Vic2Key, HoI4Key, theVic2Localisations);
 		}
 
 		static void updateLocalisationWithCountry(const std::string& key, const std::string& oldText, const std::string& newTextLocalisationKey)
@@ -115,13 +118,10 @@ class HoI4Localisation
 		}
 
 	private:
-		static HoI4Localisation* instance;
+		// created on first use, which the language guarantees happens once even if threads race to it
 		static HoI4Localisation* getInstance()
 		{
-			if (instance == nullptr)
-			{
-				instance = new HoI4Localisation();
-			}
+			static HoI4Localisation* const instance = new HoI4Localisation();
 			return instance;
 		}
 		HoI4Localisation() noexcept;
@@ -137,22 +137,23 @@ class HoI4Localisation
 
 		void AddNonenglishCountryLocalisations();
 
-		void CreateCountryLocalisations(const std::pair<const std::string&, const std::string&>& tags, const governmentMapper& governmentMap);
-		void addLocalisationsForAllGovernments(const std::pair<const std::string&, const std::string&>& tags, const std::pair<const std::string&, const std::string&>& suffixes, const governmentMapper& governmentMap);
+		void CreateCountryLocalisations(const std::pair<const std::string&, const std::string&>& tags, const std::string& domainName, const governmentMapper& governmentMap, const V2Localisations& theVic2Localisations);
+		void addLocalisationsForAllGovernments(const std::pair<const std::string&, const std::string&>& tags, const std::pair<const std::string&, const std::string&>& suffixes, const keyToLocalisationMap& plainLocalisation, const governmentMapper& governmentMap, const V2Localisations& theVic2Localisations);
 		void addLocalisationsInAllLanguages(const std::string& destTag, const std::pair<const std::string&, const std::string&>& suffixes, const std::string& HoI4GovernmentIdeology, const keyToLocalisationMap& namesInLanguage);
 		languageToLocalisationsMap::iterator getExistingLocalisationsInLanguage(const std::string& language);
 		void addLocalisation(const std::string& newKey, languageToLocalisationsMap::iterator& existingLanguage, const std::string& localisation, const std::string& HoI4Suffix);
-		bool addNeutralLocalisation(const std::pair<const std::string&, const std::string&>& tags, const std::pair<const std::string&, const std::string&>& suffixes);
+		bool addNeutralLocalisation(const std::string& HoI4Tag, const std::pair<const std::string&, const std::string&>& suffixes, const keyToLocalisationMap& plainLocalisation);
+		keyToLocalisationMap getVic2CountryName(const std::string& Vic2Tag, const std::string& domainName, const V2Localisations& theVic2Localisations) const;
 
-		void UpdateMainCountryLocalisation(const std::string& HoI4Key, const std::string& Vic2Tag, const std::string& Vic2Government);
-		bool attemptToUpdateMainCountryLocalisation(const std::string& HoI4Key, const std::string& Vic2Key);
+		void UpdateMainCountryLocalisation(const std::string& HoI4Key, const std::string& Vic2Tag, const std::string& Vic2Government, const std::string& domainName, const V2Localisations& theVic2Localisations);
+		bool attemptToUpdateMainCountryLocalisation(const std::string& HoI4Key, const keyToLocalisationMap& Vic2Text);
 
 		void CopyFocusLocalisations(const std::string& oldKey, const std::string& newKey);
 
 		void CopyEventLocalisations(const std::string& oldKey, const std::string& newKey);
 
-		void AddStateLocalisations(const HoI4States* states);
-		void addStateLocalisationForLanguage(const HoI4::State* state, const std::pair<const std::string, std::string>& Vic2NameInLanguage);
+		void AddStateLocalisations(const HoI4States* states, const V2Localisations& theVic2Localisations, const provinceMapper& theProvinceMapper);
+		void addStateLocalisationForLanguage(const HoI4::State* state, const std::pair<const std::string, std::string>& Vic2NameInLanguage, const V2Localisations& theVic2Localisations);
 		void addVPLocalisationForLanguage(const HoI4::State* state, const std::pair<const std::string, std::string>& Vic2NameInLanguage);
 		keyToLocalisationMap& getExistingStateLocalisation(const std::string& language);
 		keyToLocalisationMap& getExistingVPLocalisation(const std::string& language);
@@ -160,14 +161,14 @@ class HoI4Localisation
 		void addLanguageToVPLocalisations(const std::string& language);
 		void addNonenglishStateLocalisations();
 		void addNonenglishVPLocalisations();
-		void addDebugLocalisations(const std::pair<const int, HoI4::State*>& state);
+		void addDebugLocalisations(const std::pair<const int, HoI4::State*>& state, const V2Localisations& theVic2Localisations, const provinceMapper& theProvinceMapper);
 
 		void AddEventLocalisation(const std::string& event, const std::string& localisation);
-		void AddEventLocalisationFromVic2(const std::string& Vic2Key, const std::string& HoI4Key);
+		void AddEventLocalisationFromVic2(const std::string& Vic2Key, const std::string& HoI4Key, const V2Localisations& theVic2Localisations);
 
 		void AddIdeaLocalisation(const std::string& idea, const std::optional<std::string>& localisation);
 
-		void AddPoliticalPartyLocalisation(const std::string& Vic2Key, const std::string& HoI4Key);
+		void AddPoliticalPartyLocalisation(const std::string& Vic2Key, const std::string& HoI4Key, const V2Localisations& theVic2Localisations);
 
 		void UpdateLocalisationWithCountry(const std::string& key, const std::string& oldText, const std::string& newTextLocalisationKey);
 
@@ -33,6 +33,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "OSCompatibilityLayer.h"
 #include "ParserHelpers.h"
 #include <fstream>
+#include <list>
 #include <random>
 
 // Currently not populated anywhere, so no forts will be created from them; they
@@ -54,12 +55,12 @@ class dockyardProvince: commonItems::parser
 
 dockyardProvince::dockyardProvince(std::istream& theStream)
 {
-	registerKeyword(std::regex("naval_base"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("naval_base", [this](const std::string& unused, std::istream& theStream)
 	{
 		commonItems::singleInt baseInt(theStream);
 		dockyards = baseInt.getInt();
 	});
-	registerKeyword(std::regex("[a-zA-Z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
@@ -83,22 +84,22 @@ class stateBuildings: commonItems::parser
 
 stateBuildings::stateBuildings(std::istream& theStream)
 {
-	registerKeyword(std::regex("industrial_complex"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("industrial_complex", [this](const std::string& unused, std::istream& theStream)
 	{
 		commonItems::singleInt factoryInt(theStream);
 		civFactories = factoryInt.getInt();
 	});
-	registerKeyword(std::regex("arms_factory"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("arms_factory", [this](const std::string& unused, std::istream& theStream)
 	{
 		commonItems::singleInt factoryInt(theStream);
 		milFactories = factoryInt.getInt();
 	});
-	registerKeyword(std::regex("\\d+"), [this](const std::string& unused, std::istream& theStream)
+	registerRegex("\\d+", [this](const std::string& unused, std::istream& theStream)
 	{
 		dockyardProvince province(theStream);
 		dockyards += province.getDockyards();
 	});
-	registerKeyword(std::regex("[a-zA-Z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
@@ -124,19 +125,19 @@ class stateHistory: commonItems::parser
 
 stateHistory::stateHistory(std::istream& theStream)
 {
-	registerKeyword(std::regex("owner"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("owner", [this](const std::string& unused, std::istream& theStream)
 	{
 		commonItems::singleString ownerString(theStream);
 		owner = ownerString.getString();
 	});
-	registerKeyword(std::regex("buildings"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("buildings", [this](const std::string& unused, std::istream& theStream)
 	{
 		stateBuildings theBuildings(theStream);
 		civFactories = theBuildings.getCivFactories();
 		milFactories = theBuildings.getMilFactories();
 		dockyards = theBuildings.getDockyards();
 	});
-	registerKeyword(std::regex("[a-zA-Z0-9\\._]+"), commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9\\._]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
@@ -144,25 +145,25 @@ stateHistory::stateHistory(std::istream& theStream)
 
 HoI4::State::State(std::istream& theStream)
 {
-	registerKeyword(std::regex("impassable"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("impassable", [this](const std::string& unused, std::istream& theStream){
 		impassable = true;
 		commonItems::ignoreItem(unused, theStream);
 	});
-	registerKeyword(std::regex("provinces"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("provinces", [this](const std::string& unused, std::istream& theStream){
 		commonItems::intList provinceNums(theStream);
 		for (auto province: provinceNums.getInts())
 		{
 			provinces.insert(province);
 		}
 	});
-	registerKeyword(std::regex("history"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("history", [this](const std::string& unused, std::istream& theStream){
 		stateHistory theHistory(theStream);
 		civFactories = theHistory.getCivFactories();
 		milFactories = theHistory.getMilFactories();
 		dockyards = theHistory.getDockyards();
 		ownerTag = theHistory.getOwner();
 	});
-	registerKeyword(std::regex("[a-zA-Z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 
@@ -299,7 +300,7 @@ void HoI4::State::output(const std::string& _filename) const
 }
 
 
-void HoI4::State::convertNavalBases(const coastalProvinces& theCoastalProvinces)
+void HoI4::State::convertNavalBases(const coastalProvinces& theCoastalProvinces, const provinceMapper& theProvinceMapper)
 {
 	for (auto sourceProvince: sourceState->getProvinces())
 	{
@@ -309,7 +310,7 @@ void HoI4::State::convertNavalBases(const coastalProvinces& theCoastalProvinces)
 			continue;
 		}
 
-		auto navalBaseLocation = determineNavalBaseLocation(sourceProvince, theCoastalProvinces);
+		auto navalBaseLocation = determineNavalBaseLocation(sourceProvince, theCoastalProvinces, theProvinceMapper);
 		if (navalBaseLocation)
 		{
 			addNavalBase(navalBaseLevel, *navalBaseLocation);
@@ -330,7 +331,7 @@ int HoI4::State::determineNavalBaseLevel(const Vic2::Province* sourceProvince)
 }
 
 
-std::optional<int> HoI4::State::determineNavalBaseLocation(const Vic2::Province* sourceProvince, const coastalProvinces& theCoastalProvinces)
+std::optional<int> HoI4::State::determineNavalBaseLocation(const Vic2::Province* sourceProvince, const coastalProvinces& theCoastalProvinces, const provinceMapper& theProvinceMapper)
 {
 	if (auto mapping = theProvinceMapper.getVic2ToHoI4ProvinceMapping(sourceProvince->getNumber()))
 	{
@@ -365,7 +366,7 @@ void HoI4::State::addCores(const std::vector<std::string>& newCores)
 }
 
 
-bool HoI4::State::assignVPFromVic2Province(int Vic2ProvinceNumber)
+bool HoI4::State::assignVPFromVic2Province(int Vic2ProvinceNumber, const provinceMapper& theProvinceMapper)
 {
 	if (auto mapping = theProvinceMapper.getVic2ToHoI4ProvinceMapping(Vic2ProvinceNumber))
 	{
@@ -412,14 +413,14 @@ std::optional<int> HoI4::State::getMainNavalLocation() const
 }
 
 
-void HoI4::State::tryToCreateVP()
+void HoI4::State::tryToCreateVP(const provinceMapper& theProvinceMapper)
 {
 	bool VPCreated = false;
 
 	auto vic2CapitalProvince = sourceState->getCapitalProvince();
 	if (vic2CapitalProvince)
 	{
-		VPCreated = assignVPFromVic2Province(*vic2CapitalProvince);
+		VPCreated = assignVPFromVic2Province(*vic2CapitalProvince, theProvinceMapper);
 	}
 
 	if (!VPCreated)
@@ -428,15 +429,18 @@ void HoI4::State::tryToCreateVP()
 		{
 			LOG(LogLevel::Warning) << "Could not initially create VP for state " << ID << ", but state is not split.";
 		}
+		static const commonItems::symbol aristocrats("aristocrats");
+		static const commonItems::symbol bureaucrats("bureaucrats");
+		static const commonItems::symbol capitalists("capitalists");
 		for (auto province: sourceState->getProvinces())
 		{
 			if (
-				 (province->getPopulation("aristocrats") > 0) ||
-				 (province->getPopulation("bureaucrats") > 0) ||
-				 (province->getPopulation("capitalists") > 0)
+				 (province->getPopulation(aristocrats) > 0) ||
+				 (province->getPopulation(bureaucrats) > 0) ||
+				 (province->getPopulation(capitalists) > 0)
 				)
 			{
-				VPCreated = assignVPFromVic2Province(province->getNumber());
+				VPCreated = assignVPFromVic2Province(province->getNumber(), theProvinceMapper);
 				if (VPCreated)
 				{
 					break;
@@ -462,7 +466,7 @@ void HoI4::State::tryToCreateVP()
 		}
 		for (auto province: provincesOrderedByPopulation)
 		{
-			VPCreated = assignVPFromVic2Province(province->getNumber());
+			VPCreated = assignVPFromVic2Province(province->getNumber(), theProvinceMapper);
 			if (VPCreated)
 			{
 				break;
@@ -475,11 +479,11 @@ void HoI4::State::tryToCreateVP()
 		LOG(LogLevel::Warning) << "Could not create VP for state " << ID;
 	}
 
-	addDebugVPs();
+	addDebugVPs(theProvinceMapper);
 }
 
 
-void HoI4::State::addDebugVPs()
+void HoI4::State::addDebugVPs(const provinceMapper& theProvinceMapper)
 {
 	for (auto sourceProvinceNum: sourceState->getProvinceNums())
 	{
@@ -496,7 +500,7 @@ void HoI4::State::addDebugVPs()
 }
 
 
-void HoI4::State::addManpower()
+void HoI4::State::addManpower(const provinceMapper& theProvinceMapper)
 {
 	for (auto sourceProvince: sourceState->getProvinces())
 	{
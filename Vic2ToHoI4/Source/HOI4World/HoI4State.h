@@ -34,6 +34,9 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include <vector>
 
 
+class provinceMapper;
+
+
 namespace Vic2
 {
 class Province;
@@ -65,7 +68,7 @@ class State: commonItems::parser
 		void addVictoryPointValue(int additionalValue) { victoryPointValue += additionalValue; }
 		void setVPLocation(int province) { victoryPointPosition = province; }
 
-		void convertNavalBases(const coastalProvinces& theCoastalProvinces);
+		void convertNavalBases(const coastalProvinces& theCoastalProvinces, const provinceMapper& theProvinceMapper);
 		void addNavalBase(int level, int location);
 		void addCores(const std::vector<std::string>& newCores);
 
@@ -86,8 +89,8 @@ class State: commonItems::parser
 
 		std::optional<int> getMainNavalLocation() const;
 
-		void tryToCreateVP();
-		void addManpower();
+		void tryToCreateVP(const provinceMapper& theProvinceMapper);
+		void addManpower(const provinceMapper& theProvinceMapper);
 
 		void convertIndustry(double workerFactoryRatio, const HoI4::stateCategories& theStateCategories, const coastalProvinces& theCoastalProvinces);
 
@@ -103,12 +106,12 @@ class State: commonItems::parser
 		bool amICoastal(const coastalProvinces& theCoastalProvinces);
 
 		int determineNavalBaseLevel(const Vic2::Province* sourceProvince);
-		std::optional<int> determineNavalBaseLocation(const Vic2::Province* sourceProvince, const coastalProvinces& theCoastalProvinces);
+		std::optional<int> determineNavalBaseLocation(const Vic2::Province* sourceProvince, const coastalProvinces& theCoastalProvinces, const provinceMapper& theProvinceMapper);
 
-		bool assignVPFromVic2Province(int Vic2ProvinceNumber);
+		bool assignVPFromVic2Province(int Vic2ProvinceNumber, const provinceMapper& theProvinceMapper);
 		void assignVP(int location);
 		bool isProvinceInState(int provinceNum);
-		void addDebugVPs();
+		void addDebugVPs(const provinceMapper& theProvinceMapper);
 
 		const Vic2::State* sourceState;
 
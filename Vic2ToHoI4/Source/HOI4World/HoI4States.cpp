@@ -28,6 +28,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "OSCompatibilityLayer.h"
 #include "../Mappers/CountryMapping.h"
 #include "../Mappers/ProvinceDefinitions.h"
+#include "../Mappers/ProvinceMapper.h"
 #include "../Mappers/V2Localisations.h"
 #include "../V2World/Country.h"
 #include "../V2World/Province.h"
@@ -38,8 +39,10 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
-HoI4States::HoI4States(const Vic2::World* _sourceWorld, const CountryMapper& countryMap):
+HoI4States::HoI4States(const Vic2::World* _sourceWorld, const CountryMapper& countryMap, const provinceDefinitions& _theProvinceDefinitions, const provinceMapper& _theProvinceMapper):
 	sourceWorld(_sourceWorld),
+	theProvinceDefinitions(_theProvinceDefinitions),
+	theProvinceMapper(_theProvinceMapper),
 	ownersMap(),
 	coresMap(),
 	assignedProvinces(),
@@ -49,7 +52,7 @@ HoI4States::HoI4States(const Vic2::World* _sourceWorld, const CountryMapper& cou
 	int num;
 
 	LOG(LogLevel::Info) << "Converting states";
-	registerKeyword(std::regex("state"), [this, &num](const std::string& unused, std::istream& theStream){
+	registerKeyword("state", [this, &num](const std::string& unused, std::istream& theStream){
 		defaultStates.insert(make_pair(num, new HoI4::State(theStream)));
 	});
 
@@ -72,7 +75,7 @@ HoI4States::HoI4States(const Vic2::World* _sourceWorld, const CountryMapper& cou
 
 void HoI4States::determineOwnersAndCores(const CountryMapper& countryMap)
 {
-	for (auto provinceNumber: provinceDefinitions::getLandProvinces())
+	for (auto provinceNumber: theProvinceDefinitions.getLandProvinces())
 	{
 		auto sourceProvinceNums = retrieveSourceProvinceNums(provinceNumber);
 		if (sourceProvinceNums)
@@ -293,8 +296,8 @@ void HoI4States::createMatchingHoI4State(const Vic2::State* vic2State, const str
 			newState->markHadImpassablePart();
 		}
 		addProvincesAndCoresToNewState(newState, passableProvinces);
-		newState->tryToCreateVP();
-		newState->addManpower();
+		newState->tryToCreateVP(theProvinceMapper);
+		newState->addManpower(theProvinceMapper);
 		states.insert(make_pair(nextStateID, newState));
 		nextStateID++;
 	}
@@ -304,8 +307,8 @@ void HoI4States::createMatchingHoI4State(const Vic2::State* vic2State, const str
 		HoI4::State* newState = new HoI4::State(vic2State, nextStateID, stateOwner);
 		addProvincesAndCoresToNewState(newState, impassableProvinces);
 		newState->makeImpassable();
-		newState->tryToCreateVP();
-		newState->addManpower();
+		newState->tryToCreateVP(theProvinceMapper);
+		newState->addManpower(theProvinceMapper);
 		states.insert(make_pair(nextStateID, newState));
 		nextStateID++;
 	}
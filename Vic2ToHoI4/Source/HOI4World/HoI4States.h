@@ -25,7 +25,6 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
-#include "../Mappers/ProvinceMapper.h"
 #include "newParser.h"
 #include <map>
 #include <optional>
@@ -38,6 +37,8 @@ using namespace std;
 
 
 class CountryMapper;
+class provinceDefinitions;
+class provinceMapper;
 namespace HoI4
 {
 class impassableProvinces;
@@ -55,7 +56,7 @@ class World;
 class HoI4States: commonItems::parser
 {
 	public:
-		explicit HoI4States(const Vic2::World* _sourceWorld, const CountryMapper& countryMap);
+		HoI4States(const Vic2::World* _sourceWorld, const CountryMapper& countryMap, const provinceDefinitions& _theProvinceDefinitions, const provinceMapper& _theProvinceMapper);
 
 		const map<int, HoI4::State*>& getDefaultStates() const { return defaultStates; }
 		const map<int, HoI4::State*>& getStates() const { return states; }
@@ -84,6 +85,8 @@ class HoI4States: commonItems::parser
 
 
 		const Vic2::World* sourceWorld = nullptr;
+		const provinceDefinitions& theProvinceDefinitions;
+		const provinceMapper& theProvinceMapper;
 		map<int, string> ownersMap;
 		map<int, vector<string>> coresMap;
 		set<int> assignedProvinces;
@@ -48,19 +48,18 @@ class region: commonItems::parser
 
 region::region(std::istream& theStream)
 {
-	registerKeyword(std::regex("id"), [this](const std::string& unused, std::istream& theStream){
-		commonItems::singleInt idString(theStream);
-		ID = idString.getInt();
+	registerKeyword("id", [this](const std::string& unused, std::istream& theStream){
+		ID = commonItems::readInt(theStream);
 	});
-	registerKeyword(std::regex("provinces"), [this](const std::string& unused, std::istream& theStream){
-		commonItems::intList provinceInts(theStream);
-		provinces = provinceInts.getInts();
+	registerKeyword("provinces", [this](const std::string& unused, std::istream& theStream){
+		provinces.clear();
+		commonItems::readInts(theStream, provinces);
 	});
-	registerKeyword(std::regex("weather"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("weather", [this](const std::string& unused, std::istream& theStream){
 		commonItems::stringOfItem weatherString(theStream);
 		weather = weatherString.getString();
 	});
-	registerKeyword(std::regex("[a-zA-Z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
@@ -69,7 +68,7 @@ region::region(std::istream& theStream)
 HoI4StrategicRegion::HoI4StrategicRegion(const std::string& _filename):
 	filename(_filename)
 {
-	registerKeyword(std::regex("strategic_region"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("strategic_region", [this](const std::string& unused, std::istream& theStream){
 		region theRegion(theStream);
 		ID = theRegion.getID();
 		oldProvinces = theRegion.getProvinces();
@@ -34,9 +34,10 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
-HoI4WarCreator::HoI4WarCreator(const HoI4::World* world, const HoI4::MapData& theMapData):
+HoI4WarCreator::HoI4WarCreator(const HoI4::World* world, const HoI4::MapData& theMapData, const provinceDefinitions& _theProvinceDefinitions):
 	genericFocusTree(new HoI4FocusTree),
 	theWorld(world),
+	theProvinceDefinitions(_theProvinceDefinitions),
 	AggressorFactions(),
 	WorldTargetMap(),
 	provincePositions(),
@@ -303,10 +304,9 @@ void HoI4WarCreator::setSphereLeaders(const Vic2::World* sourceWorld)
 			if (relation.second->getSphereLeader())
 			{
 				string tag = relation.second->getTag();
-				auto spheredcountry = theWorld->getCountries().find(tag);
-				if (spheredcountry != theWorld->getCountries().end())
+				if (auto spheredcountry = theWorld->findCountry(tag); spheredcountry)
 				{
-					spheredcountry->second->setSphereLeader(greatPower->getTag());
+					spheredcountry->setSphereLeader(greatPower->getTag());
 				}
 			}
 		}
@@ -615,22 +615,21 @@ map<string, shared_ptr<HoI4Country>> HoI4WarCreator::getImmediateNeighbors(share
 	{
 		for (int provinceNumber: theMapData.getNeighbors(province))
 		{
-			if (!provinceDefinitions::isLandProvince(province))
+			if (!theProvinceDefinitions.isLandProvince(province))
 			{
 				continue;
 			}
 
-			auto provinceToOwnerItr = provinceToOwnerMap.find(provinceNumber);
-			if (provinceToOwnerItr == provinceToOwnerMap.end())
+			auto ownerTag = provinceToOwnerMap.find(provinceNumber);
+			if (ownerTag == nullptr)
 			{
 				continue;
 			}
 
-			string ownerTag = provinceToOwnerItr->second;
-			auto ownerCountry = theWorld->getCountries().find(ownerTag)->second;
-			if (ownerCountry != checkingCountry)
+			auto ownerCountry = theWorld->findCountry(*ownerTag);
+			if (ownerCountry && (ownerCountry != checkingCountry))
 			{
-				neighbors.insert(make_pair(ownerTag, ownerCountry));
+				neighbors.insert(make_pair(ownerCountry->getTag(), ownerCountry));
 			}
 		}
 	}
@@ -666,10 +665,10 @@ void HoI4WarCreator::determineProvinceOwners()
 {
 	for (auto state: theWorld->getStates())
 	{
+		commonItems::countryTag owner(state.second->getOwner());
 		for (auto province: state.second->getProvinces())
 		{
-			string owner = state.second->getOwner();
-			provinceToOwnerMap.insert(make_pair(province, owner));
+			provinceToOwnerMap.insert(province, owner);
 		}
 	}
 }
@@ -1313,22 +1312,19 @@ set<int> HoI4WarCreator::findBorderState(shared_ptr<HoI4Country> country, shared
 {
 	set<int> demandedStates;
 	std::map<int,int> provinceToStateIdMapping = world->getProvinceToStateIDMap();
+	commonItems::countryTag neighborTag(neighbor->getTag());
 	for (auto leaderprov : country->getProvinces())
 	{
 		for (int prov : theMapData.getNeighbors(leaderprov))
 		{
-			if (!provinceDefinitions::isLandProvince(prov))
+			if (!theProvinceDefinitions.isLandProvince(prov))
 			{
 				continue;
 			}
 
-			if (provinceToOwnerMap.find(prov) != provinceToOwnerMap.end())
+			if (auto owner = provinceToOwnerMap.find(prov); owner && neighborTag.isValid() && (*owner == neighborTag))
 			{
-				string owner = provinceToOwnerMap.find(prov)->second;
-				if (owner == neighbor->getTag())
-				{
-					demandedStates.insert(provinceToStateIdMapping[prov]);
-				}
+				demandedStates.insert(provinceToStateIdMapping[prov]);
 			}
 		}
 	}
@@ -26,6 +26,8 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include <map>
 #include <string>
 #include "HoI4Country.h"
+#include "CountryTag.h"
+#include "FlatHashMap.h"
 using namespace std;
 
 
@@ -47,6 +49,9 @@ class World;
 }
 
 
+class provinceDefinitions;
+
+
 const int maxGCWars = 1;
 
 
@@ -54,7 +59,7 @@ const int maxGCWars = 1;
 class HoI4WarCreator
 {
 	public:
-		explicit HoI4WarCreator(const HoI4::World* world, const HoI4::MapData& theMapData);
+		explicit HoI4WarCreator(const HoI4::World* world, const HoI4::MapData& theMapData, const provinceDefinitions& _theProvinceDefinitions);
 
 	private:
 		HoI4WarCreator(const HoI4WarCreator&) = delete;
@@ -113,10 +118,11 @@ class HoI4WarCreator
 
 		HoI4FocusTree* genericFocusTree;
 		const HoI4::World* theWorld;
+		const provinceDefinitions& theProvinceDefinitions;
 
 		vector<HoI4Country*> AggressorFactions;
 		map<shared_ptr<HoI4Country>, vector<shared_ptr<HoI4Country>>> WorldTargetMap;
 		map<int, pair<int, int>> provincePositions;
 
-		map<int, string> provinceToOwnerMap;
+		commonItems::flatHashMap<int, commonItems::countryTag> provinceToOwnerMap;
 };
\ No newline at end of file
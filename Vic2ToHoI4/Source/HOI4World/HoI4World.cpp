@@ -25,6 +25,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
 #include "../Configuration.h"
+#include "../ConversionContext.h"
 #include "../V2World/Diplomacy.h"
 #include "../V2World/Party.h"
 #include "Advisor.h"
@@ -52,74 +53,113 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "../Mappers/CountryMapping.h"
 #include "../Mappers/TechMapper.h"
 #include "ParserHelpers.h"
+#include "PhaseTimer.h"
 #include <fstream>
 using namespace std;
 
 
 
 
-HoI4::World::World(const Vic2::World* _sourceWorld):
-	sourceWorld(_sourceWorld),
+HoI4::World::World(const Vic2::World* _sourceWorld, const ConversionContext& _context):
 	countryMap(_sourceWorld),
-	states(new HoI4States(sourceWorld, countryMap)),
+	sourceWorld(_sourceWorld),
+	context(_context),
+	states(new HoI4States(sourceWorld, countryMap, context.getProvinceDefinitions(), context.getProvinceMapper())),
 	supplyZones(new HoI4::SupplyZones(states->getDefaultStates())),
 	theIdeas(std::make_unique<HoI4::Ideas>()),
 	decisions(make_unique<HoI4::decisions>()),
 	peaces(make_unique<HoI4::AIPeaces>()),
 	diplomacy(new HoI4Diplomacy),
 	events(new HoI4::Events),
-	onActions(make_unique<HoI4::OnActions>())
+	onActions(make_unique<HoI4::OnActions>()),
+	theMapData(context.getProvinceDefinitions())
 {
 	LOG(LogLevel::Info) << "Parsing HoI4 data";
 
+	commonItems::phaseTimer phase("Finding coastal provinces");
 	theCoastalProvinces.init(theMapData);
-	buildings = new Buildings(*states, theCoastalProvinces, theMapData),
+	phase.next("Creating buildings");
+	buildings = new Buildings(*states, theCoastalProvinces, theMapData);
+	phase.next("Converting naval bases");
 	convertNavalBases();
+	phase.next("Converting countries");
 	convertCountries();
-	HoI4Localisation::addStateLocalisations(states);
+	phase.next("Adding state localisations");
+	HoI4Localisation::addStateLocalisations(states, context.getVic2Localisations(), context.getProvinceMapper());
+	phase.next("Converting industry");
 	convertIndustry();
+	phase.next("Converting resources");
 	convertResources();
+	phase.next("Converting supply zones");
 	supplyZones->convertSupplyZones(states);
+	phase.next("Converting strategic regions");
 	convertStrategicRegions();
+	phase.next("Converting diplomacy");
 	convertDiplomacy();
+	phase.next("Converting techs");
 	convertTechs();
+	phase.next("Converting militaries");
 	convertMilitaries();
 	//convertArmies();
 	//convertNavies();
 	//convertAirforces();
+	phase.next("Determining great powers");
 	determineGreatPowers();
+	phase.next("Importing ideologies");
 	importIdeologies();
+	phase.next("Importing leader traits");
 	importLeaderTraits();
+	phase.next("Converting governments");
 	convertGovernments();
+	phase.next("Identifying major ideologies");
 	identifyMajorIdeologies();
+	phase.next("Importing ideological ministers");
 	importIdeologicalMinisters();
+	phase.next("Converting parties");
 	convertParties();
+	phase.next("Creating events");
 	events->createPoliticalEvents(majorIdeologies);
 	events->createWarJustificationEvents(majorIdeologies);
 	events->importElectionEvents(majorIdeologies, *onActions);
 	addCountryElectionEvents(majorIdeologies);
 	events->createStabilityEvents(majorIdeologies);
+	phase.next("Updating ideas");
 	theIdeas->updateIdeas(majorIdeologies);
+	phase.next("Updating decisions");
 	decisions->updateDecisions(majorIdeologies, *events);
+	phase.next("Updating AI peaces");
 	peaces->updateAIPeaces(majorIdeologies);
+	phase.next("Adding neutrality");
 	addNeutrality();
+	phase.next("Converting ideology support");
 	convertIdeologySupport();
+	phase.next("Converting capital VPs");
 	convertCapitalVPs();
+	phase.next("Converting air bases");
 	convertAirBases();
 	if (theConfiguration.getCreateFactions())
 	{
+		phase.next("Creating factions");
 		createFactions();
 	}
 
-	HoI4WarCreator warCreator(this, theMapData);
+	phase.next("Creating wars");
+	HoI4WarCreator warCreator(this, theMapData, context.getProvinceDefinitions());
 
+	phase.next("Adding focus trees");
 	addFocusTrees();
+	phase.next("Adjusting research focuses");
 	adjustResearchFocuses();
 }
 
 
-shared_ptr<HoI4Country> HoI4::World::findCountry(const string& countryTag)
+shared_ptr<HoI4Country> HoI4::World::findCountry(const string& countryTag) const
 {
+	if (commonItems::countryTag tag(countryTag); tag)
+	{
+		return findCountry(tag);
+	}
+
 	auto country = countries.find(countryTag);
 	if (country == countries.end())
 	{
@@ -129,11 +169,24 @@ shared_ptr<HoI4Country> HoI4::World::findCountry(const string& countryTag)
 	return country->second;
 }
 
+
+shared_ptr<HoI4Country> HoI4::World::findCountry(commonItems::countryTag tag) const
+{
+	auto country = countriesByTag.find(tag);
+	if (country == nullptr)
+	{
+		return {};
+	}
+
+	return *country;
+}
+
+
 void HoI4::World::convertNavalBases()
 {
 	for (auto state: states->getStates())
 	{
-		state.second->convertNavalBases(theCoastalProvinces);
+		state.second->convertNavalBases(theCoastalProvinces, context.getProvinceMapper());
 	}
 }
 
@@ -199,10 +252,14 @@ void HoI4::World::convertCountry(pair<string, Vic2::Country*> country)
 		}
 		destCountry = new HoI4Country(*possibleHoI4Tag, countryFileName, this);
 
-		destCountry->initFromV2Country(*sourceWorld, country.second, states->getProvinceToStateIDMap(), states->getStates(), theNames, theGraphics, countryMap);
+		destCountry->initFromV2Country(*sourceWorld, country.second, states->getProvinceToStateIDMap(), states->getStates(), theNames, theGraphics, countryMap, context.getProvinceMapper());
 		countries.insert(make_pair(*possibleHoI4Tag, destCountry));
-		HoI4Localisation::createCountryLocalisations(make_pair(country.first, *possibleHoI4Tag), governmentMap);
-		HoI4Localisation::updateMainCountryLocalisation(destCountry->getTag() + "_" + destCountry->getGovernmentIdeology(), country.first, country.second->getGovernment());
+		if (commonItems::countryTag tag(*possibleHoI4Tag); tag)
+		{
+			countriesByTag.insert(tag, countries[*possibleHoI4Tag]);
+		}
+		HoI4Localisation::createCountryLocalisations(make_pair(country.first, *possibleHoI4Tag), country.second->getDomainName(), governmentMap, context.getVic2Localisations());
+		HoI4Localisation::updateMainCountryLocalisation(destCountry->getTag() + "_" + destCountry->getGovernmentIdeology(), country.first, country.second->getGovernment(), country.second->getDomainName(), context.getVic2Localisations());
 	}
 }
 
@@ -210,7 +267,7 @@ void HoI4::World::convertCountry(pair<string, Vic2::Country*> country)
 void HoI4::World::importIdeologies()
 {
 	clearRegisteredKeywords();
-	registerKeyword(std::regex("ideologies"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("ideologies", [this](const std::string& unused, std::istream& theStream)
 	{
 		IdeologyFile theFile(theStream);
 		for (auto ideology: theFile.getIdeologies())
@@ -230,7 +287,7 @@ void HoI4::World::importIdeologies()
 void HoI4::World::importLeaderTraits()
 {
 	clearRegisteredKeywords();
-	registerKeyword(std::regex("[a-z]+"), [this](const std::string& ideologyName, std::istream& theStream){
+	registerRegex("[a-z]+", [this](const std::string& ideologyName, std::istream& theStream){
 		commonItems::stringsOfItems traits(theStream);
 		ideologicalLeaderTraits.insert(make_pair(ideologyName, traits.getStrings()));
 	});
@@ -250,7 +307,7 @@ void HoI4::World::convertGovernments()
 {
 	for (auto country: countries)
 	{
-		country.second->convertGovernment(*sourceWorld, governmentMap);
+		country.second->convertGovernment(*sourceWorld, governmentMap, context.getVic2Localisations());
 	}
 }
 
@@ -259,7 +316,7 @@ void HoI4::World::convertParties()
 {
 	for (auto country: countries)
 	{
-		country.second->convertParties(majorIdeologies, governmentMap);
+		country.second->convertParties(majorIdeologies, governmentMap, context.getVic2Localisations());
 	}
 }
 
@@ -340,10 +397,9 @@ void HoI4::World::addStatesToCountries()
 {
 	for (auto state: states->getStates())
 	{
-		auto owner = countries.find(state.second->getOwner());
-		if (owner != countries.end())
+		if (auto owner = findCountry(state.second->getOwner()); owner)
 		{
-			owner->second->addState(state.second);
+			owner->addState(state.second);
 		}
 	}
 
@@ -736,14 +792,14 @@ void HoI4::World::convertAgreements()
 			continue;
 		}
 
-		auto HoI4Country1 = countries.find(*possibleHoI4Tag1);
-		auto HoI4Country2 = countries.find(*possibleHoI4Tag2);
-		if (HoI4Country1 == countries.end())
+		auto HoI4Country1 = findCountry(*possibleHoI4Tag1);
+		auto HoI4Country2 = findCountry(*possibleHoI4Tag2);
+		if (!HoI4Country1)
 		{
 			LOG(LogLevel::Warning) << "HoI4 country " << *possibleHoI4Tag1 << " used in diplomatic agreement doesn't exist";
 			continue;
 		}
-		if (HoI4Country2 == countries.end())
+		if (!HoI4Country2)
 		{
 			LOG(LogLevel::Warning) << "HoI4 country " << *possibleHoI4Tag2 << " used in diplomatic agreement doesn't exist";
 			continue;
@@ -757,14 +813,14 @@ void HoI4::World::convertAgreements()
 
 		if (agreement->getType() == "alliance")
 		{
-			HoI4Country1->second->editAllies().insert(*possibleHoI4Tag2);
-			HoI4Country2->second->editAllies().insert(*possibleHoI4Tag1);
+			HoI4Country1->editAllies().insert(*possibleHoI4Tag2);
+			HoI4Country2->editAllies().insert(*possibleHoI4Tag1);
 		}
 
 		if (agreement->getType() == "vassal")
 		{
-			HoI4Country1->second->addPuppet(*possibleHoI4Tag2);
-			HoI4Country2->second->setPuppetmaster(*possibleHoI4Tag1);
+			HoI4Country1->addPuppet(*possibleHoI4Tag2);
+			HoI4Country2->setPuppetmaster(*possibleHoI4Tag1);
 		}
 	}
 }
@@ -864,7 +920,7 @@ void HoI4::World::convertArmies(const militaryMappings& theMilitaryMappings)
 
 	for (auto country: countries)
 	{
-		country.second->convertArmies(theMilitaryMappings);
+		country.second->convertArmies(theMilitaryMappings, context.getProvinceMapper());
 	}
 }
 
@@ -875,7 +931,7 @@ void HoI4::World::convertNavies(const map<string, HoI4::UnitMap>& unitMap)
 
 	for (auto country : countries)
 	{
-		country.second->convertNavies(unitMap, theCoastalProvinces, states->getProvinceToStateIDMap());
+		country.second->convertNavies(unitMap, theCoastalProvinces, states->getProvinceToStateIDMap(), context.getProvinceMapper(), context.getProvinceDefinitions());
 		country.second->convertConvoys(unitMap);
 	}
 }
@@ -899,11 +955,10 @@ void HoI4::World::determineGreatPowers()
 		auto possibleGreatPowerTag = countryMap.getHoI4Tag(greatPowerVic2Tag);
 		if (possibleGreatPowerTag)
 		{
-			auto greatPower = countries.find(*possibleGreatPowerTag);
-			if (greatPower != countries.end())
+			if (auto greatPower = findCountry(*possibleGreatPowerTag); greatPower)
 			{
-				greatPowers.push_back(greatPower->second);
-				greatPower->second->setGreatPower();
+				greatPowers.push_back(greatPower);
+				greatPower->setGreatPower();
 			}
 		}
 	}
@@ -1211,7 +1266,7 @@ void HoI4::World::addCountryElectionEvents(const set<string>& majorIdeologies)
 {
 	for (auto country: countries)
 	{
-		events->addPartyChoiceEvent(country.first, country.second->getParties(), *onActions, majorIdeologies);
+		events->addPartyChoiceEvent(country.first, country.second->getParties(), *onActions, majorIdeologies, context.getVic2Localisations());
 	}
 }
 
@@ -1292,7 +1347,7 @@ void HoI4::World::outputColorsfile() const
 	ofstream output("output/" + theConfiguration.getOutputName() + "/common/countries/colors.txt");
 	if (!output.is_open())
 	{
-		Log(LogLevel::Error) << "Could not open output/" << theConfiguration.getOutputName() << "/common/countries/colors.txt";
+		LOG(LogLevel::Error) << "Could not open output/" << theConfiguration.getOutputName() << "/common/countries/colors.txt";
 		exit(-1);
 	}
 
@@ -1316,7 +1371,7 @@ void HoI4::World::outputNames() const
 
 	if (!namesFile.is_open())
 	{
-		Log(LogLevel::Error) << "Could not open output/" << theConfiguration.getOutputName() << "/common/names/01_names.txt";
+		LOG(LogLevel::Error) << "Could not open output/" << theConfiguration.getOutputName() << "/common/names/01_names.txt";
 		exit(-1);
 	}
 
@@ -1336,7 +1391,7 @@ void HoI4::World::outputUnitNames() const
 
 	if (!namesFile.is_open())
 	{
-		Log(LogLevel::Error) << "Could not open output/" << theConfiguration.getOutputName() << "/common/units/names/01_names.txt";
+		LOG(LogLevel::Error) << "Could not open output/" << theConfiguration.getOutputName() << "/common/units/names/01_names.txt";
 		exit(-1);
 	}
 
@@ -1473,7 +1528,7 @@ void HoI4::World::outputRelations() const
 {
 	if (!Utils::TryCreateFolder("output/" + theConfiguration.getOutputName() + "/common/opinion_modifiers"))
 	{
-		Log(LogLevel::Error) << "Could not create output/" + theConfiguration.getOutputName() + "/common/opinion_modifiers/";
+		LOG(LogLevel::Error) << "Could not create output/" + theConfiguration.getOutputName() + "/common/opinion_modifiers/";
 		exit(-1);
 	}
 
@@ -1527,7 +1582,7 @@ void HoI4::World::outputIdeologies() const
 {
 	if (!Utils::TryCreateFolder("output/" + theConfiguration.getOutputName() + "/common/ideologies/"))
 	{
-		Log(LogLevel::Error) << "Could not create output/" + theConfiguration.getOutputName() + "/common/ideologies/";
+		LOG(LogLevel::Error) << "Could not create output/" + theConfiguration.getOutputName() + "/common/ideologies/";
 	}
 	ofstream ideologyFile("output/" + theConfiguration.getOutputName() + "/common/ideologies/00_ideologies.txt");
 	ideologyFile << "ideologies = {\n";
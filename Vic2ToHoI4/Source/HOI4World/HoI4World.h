@@ -38,6 +38,8 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "../Mappers/CountryMapping.h"
 #include "../Mappers/GovernmentMapper.h"
 #include "../Mappers/GraphicsMapper.h"
+#include "CountryTag.h"
+#include "FlatHashMap.h"
 #include "newParser.h"
 #include <map>
 #include <optional>
@@ -55,6 +57,7 @@ class HoI4Province;
 class HoI4States;
 class HoI4StrategicRegion;
 class techMapper;
+class ConversionContext;
 
 
 namespace Vic2
@@ -82,12 +85,12 @@ struct advisorCompare;
 class World: commonItems::parser
 {
 	public:
-		explicit World(const Vic2::World* sourceWorld);
+		World(const Vic2::World* sourceWorld, const ConversionContext& _context);
 		~World() = default;
 
 		void output();
 
-		map<string, shared_ptr<HoI4Country>> getCountries()	const { return countries; }
+		const map<string, shared_ptr<HoI4Country>>& getCountries()	const { return countries; }
 		vector<shared_ptr<HoI4Country>> getGreatPowers() const { return greatPowers; }
 		map<int, HoI4::State*> getStates() const { return states->getStates(); }
 		const map<int, int>& getProvinceToStateIDMap() const { return states->getProvinceToStateIDMap(); }
@@ -95,7 +98,8 @@ class World: commonItems::parser
 		HoI4::Events* getEvents() const { return events; }
 		set<string> getMajorIdeologies() const { return majorIdeologies; }
 
-		shared_ptr<HoI4Country> findCountry(const string& countryTag);
+		shared_ptr<HoI4Country> findCountry(const string& countryTag) const;
+		shared_ptr<HoI4Country> findCountry(commonItems::countryTag tag) const;
 
 	private:
 		World(const World&) = delete;
@@ -204,6 +208,7 @@ class World: commonItems::parser
 		CountryMapper countryMap;
 
 		const Vic2::World* sourceWorld = nullptr;
+		const ConversionContext& context;
 
 		HoI4States* states = nullptr;
 		//map<int, HoI4Province*> provinces;
@@ -213,9 +218,12 @@ class World: commonItems::parser
 		Buildings* buildings = nullptr;
 
 		map<string, shared_ptr<HoI4Country>> countries;
+		commonItems::flatHashMap<commonItems::countryTag, shared_ptr<HoI4Country>> countriesByTag; // the same countries, for lookups
 		map<string, shared_ptr<HoI4Country>> landedCountries;
 		vector<shared_ptr<HoI4Country>> greatPowers;
 
+		// Ideology names stay strings rather than symbols. There are only a handful, they are looked up
+		// per country rather than per pop or province, and nearly every use splices them into output text.
 		map<string, HoI4Ideology*> ideologies;
 		std::set<std::string> majorIdeologies;
 		std::map<std::string, vector<std::string>> ideologicalLeaderTraits;
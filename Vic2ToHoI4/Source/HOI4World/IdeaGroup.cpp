@@ -29,15 +29,15 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 HoI4::IdeaGroup::IdeaGroup(const std::string& ideaGroupName, std::istream& theStream):
 	name(ideaGroupName)
 {
-	registerKeyword(std::regex("law"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("law", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString lawString(theStream);
 		law = (lawString.getString() == "yes");
 	});
-	registerKeyword(std::regex("designer"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("designer", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString designerString(theStream);
 		designer = (designerString.getString() == "yes");
 	});
-	registerKeyword(std::regex("[a-zA-Z0-9\\_]+"), [this](const std::string& ideaName, std::istream& theStream){
+	registerRegex("[a-zA-Z0-9\\_]+", [this](const std::string& ideaName, std::istream& theStream){
 		Idea newIdea(ideaName, theStream);
 		ideas.push_back(newIdea);
 	});
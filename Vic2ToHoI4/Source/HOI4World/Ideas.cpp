@@ -37,7 +37,7 @@ HoI4::Ideas::Ideas() noexcept
 
 void HoI4::Ideas::importIdeologicalIdeas()
 {
-	registerKeyword(std::regex("[a-zA-Z_]+"), [this](const std::string& ideology, std::istream& theStream){
+	registerRegex("[a-zA-Z_]+", [this](const std::string& ideology, std::istream& theStream){
 		ideologicalIdeas.insert(make_pair(ideology, IdeaGroup(ideology, theStream)));
 	});
 
@@ -48,7 +48,7 @@ void HoI4::Ideas::importIdeologicalIdeas()
 void HoI4::Ideas::importGeneralIdeas()
 {
 	clearRegisteredKeywords();
-	registerKeyword(std::regex("[a-zA-Z_]+"), [this](const std::string& ideaGroupName, std::istream& theStream){
+	registerRegex("[a-zA-Z_]+", [this](const std::string& ideaGroupName, std::istream& theStream){
 		generalIdeas.push_back(std::make_unique<IdeaGroup>(ideaGroupName, theStream));
 	});
 
@@ -28,7 +28,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 HoI4::IdeologyFile::IdeologyFile(std::istream& theStream)
 {
-	registerKeyword(std::regex("[a-z]+"), [this](const std::string& ideologyName, std::istream& theStream)
+	registerRegex("[a-z]+", [this](const std::string& ideologyName, std::istream& theStream)
 	{
 		HoI4Ideology* newIdeology = new HoI4Ideology(ideologyName, theStream);
 		ideologies.insert(make_pair(ideologyName, newIdeology));
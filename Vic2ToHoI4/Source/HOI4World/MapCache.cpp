@@ -0,0 +1,138 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+
+#include "MapCache.h"
+#include "../Configuration.h"
+#include "Log.h"
+#include <cstdio>
+#include <optional>
+
+
+
+namespace
+{
+
+// Bump this whenever the layout of a cache file or the way cached data is worked out changes
+const uint32_t cacheFormatVersion = 1;
+
+
+// What a cache file must have been written from: this cache format, and the HoI4 map files as they are now
+std::optional<std::string> getCacheKey()
+{
+	std::string key = "Vic2ToHoI4 map cache " + std::to_string(cacheFormatVersion) + "\n" + theConfiguration.getHoI4Path() + "\n";
+	for (auto mapFile: { "/map/provinces.bmp", "/map/definition.csv" })
+	{
+		auto stamp = Utils::getFileStamp(theConfiguration.getHoI4Path() + mapFile);
+		if (!stamp)
+		{
+			return std::nullopt;
+		}
+		key += std::to_string(stamp->size) + " " + std::to_string(stamp->lastWriteTime) + "\n";
+	}
+	return key;
+}
+
+}
+
+
+HoI4::mapCacheReader::mapCacheReader(const std::string& filename):
+	file(filename)
+{
+	if (!file.isOpen())
+	{
+		return;
+	}
+	remaining = file.getContents();
+	valid = true;
+
+	auto key = getCacheKey();
+	std::vector<char> cachedKey;
+	if (!key || !read(cachedKey) || (std::string_view(cachedKey.data(), cachedKey.size()) != *key))
+	{
+		valid = false;
+	}
+}
+
+
+bool HoI4::mapCacheReader::readBytes(void* destination, size_t count)
+{
+	if (!valid || (remaining.size() < count))
+	{
+		valid = false;
+		return false;
+	}
+
+	if (count > 0)
+	{
+		memcpy(destination, remaining.data(), count);
+	}
+	remaining.remove_prefix(count);
+	return true;
+}
+
+
+HoI4::mapCacheWriter::mapCacheWriter(const std::string& _filename):
+	filename(_filename),
+	temporaryFilename(_filename + "." + std::to_string(Utils::getCurrentProcessID()) + ".tmp")
+{
+	auto key = getCacheKey();
+	if (!key)
+	{
+		return;
+	}
+
+	file.open(temporaryFilename, std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+	{
+		LOG(LogLevel::Warning) << "Could not create " << temporaryFilename << ", so map data will not be cached";
+		return;
+	}
+	valid = true;
+
+	write(std::vector<char>(key->begin(), key->end()));
+}
+
+
+void HoI4::mapCacheWriter::commit()
+{
+	if (!valid)
+	{
+		return;
+	}
+
+	file.close();
+	if (!file)
+	{
+		LOG(LogLevel::Warning) << "Could not write " << temporaryFilename << ", so map data will not be cached";
+		std::remove(temporaryFilename.c_str());
+		return;
+	}
+
+	std::remove(filename.c_str());
+	if (std::rename(temporaryFilename.c_str(), filename.c_str()) != 0)
+	{
+		LOG(LogLevel::Warning) << "Could not rename " << temporaryFilename << " to " << filename << ", so map data will not be cached";
+		std::remove(temporaryFilename.c_str());
+	}
+}
@@ -0,0 +1,131 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+
+#ifndef MAP_CACHE_H_
+#define MAP_CACHE_H_
+
+
+
+#include "OSCompatibilityLayer.h"
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+
+
+namespace HoI4
+{
+
+// Map data the converter works out from the HoI4 install (province adjacency, coastal provinces, and
+// so on) is saved in cache files between runs. A cache file is only read back if it was written by the
+// same cache format from the same provinces.bmp and definition.csv, as told by their sizes and write
+// times. Values are written in the machine's own layout, so cache files are not portable.
+class mapCacheReader
+{
+	public:
+		explicit mapCacheReader(const std::string& filename);
+
+		bool isValid() const { return valid; }
+
+		template<typename T> bool read(T& value);
+		template<typename T> bool read(std::vector<T>& values);
+
+	private:
+		mapCacheReader(const mapCacheReader&) = delete;
+		mapCacheReader& operator=(const mapCacheReader&) = delete;
+
+		bool readBytes(void* destination, size_t count);
+
+		Utils::mappedFile file;
+		std::string_view remaining;
+		bool valid = false;
+};
+
+
+class mapCacheWriter
+{
+	public:
+		explicit mapCacheWriter(const std::string& _filename);
+
+		template<typename T> void write(const T& value);
+		template<typename T> void write(const std::vector<T>& values);
+
+		// The cache file is written to a temporary file and only replaces any older cache once complete.
+		// The temporary file is named for this process, so conversions running at once don't share it.
+		void commit();
+
+	private:
+		mapCacheWriter(const mapCacheWriter&) = delete;
+		mapCacheWriter& operator=(const mapCacheWriter&) = delete;
+
+		std::string filename;
+		std::string temporaryFilename;
+		std::ofstream file;
+		bool valid = false;
+};
+
+
+template<typename T> bool mapCacheReader::read(T& value)
+{
+	static_assert(std::is_trivially_copyable_v<T>, "only plain values can be read from a map cache");
+	return readBytes(&value, sizeof(T));
+}
+
+
+template<typename T> bool mapCacheReader::read(std::vector<T>& values)
+{
+	static_assert(std::is_trivially_copyable_v<T>, "only plain values can be read from a map cache");
+	uint64_t count = 0;
+	if (!read(count) || (count > remaining.size() / sizeof(T)))
+	{
+		valid = false;
+		return false;
+	}
+	values.resize(static_cast<size_t>(count));
+	return readBytes(values.data(), values.size() * sizeof(T));
+}
+
+
+template<typename T> void mapCacheWriter::write(const T& value)
+{
+	static_assert(std::is_trivially_copyable_v<T>, "only plain values can be written to a map cache");
+	file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+
+template<typename T> void mapCacheWriter::write(const std::vector<T>& values)
+{
+	static_assert(std::is_trivially_copyable_v<T>, "only plain values can be written to a map cache");
+	write(static_cast<uint64_t>(values.size()));
+	file.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+}
+
+
+
+#endif // MAP_CACHE_H_
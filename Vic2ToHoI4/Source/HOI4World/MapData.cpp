@@ -22,326 +22,482 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 #include "MapData.h"
+#include "MapCache.h"
 #include "../Mappers/ProvinceDefinitions.h"
-#include "../Color.h"
 #include "../Configuration.h"
 #include "Log.h"
+#include "ParallelFor.h"
+#include "../bitmap_image.hpp"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <numeric>
 
 
 
 void HoI4::provincePoints::addPoint(const point& thePoint)
 {
-	thePoints.emplace(thePoint);
-	if (thePoint.first < leftmostPoint.first)
-	{
-		leftmostPoint = thePoint;
-	}
-	if (thePoint.first > rightmostPoint.first)
-	{
-		rightmostPoint = thePoint;
-	}
-	if (thePoint.second < lowestPoint.second)
+	addRun(thePoint.second, thePoint.first, thePoint.first);
+}
+
+
+void HoI4::provincePoints::addRun(int y, int firstX, int lastX)
+{
+	if (!runs.empty() && (runs.back().y == y) && (runs.back().lastX + 1 == firstX))
 	{
-		lowestPoint = thePoint;
+		runs.back().lastX = lastX;
 	}
-	if (thePoint.second > highestPoint.second)
+	else
 	{
-		highestPoint = thePoint;
+		runs.push_back({ y, firstX, lastX });
 	}
+
+	leftmostX = std::min(leftmostX, firstX);
+	rightmostX = std::max(rightmostX, lastX);
+	lowestY = std::min(lowestY, y);
+	highestY = std::max(highestY, y);
+}
+
+
+void HoI4::provincePoints::addPoints(provincePoints&& otherPoints)
+{
+	runs.insert(runs.end(), otherPoints.runs.begin(), otherPoints.runs.end());
+	leftmostX = std::min(leftmostX, otherPoints.leftmostX);
+	rightmostX = std::max(rightmostX, otherPoints.rightmostX);
+	lowestY = std::min(lowestY, otherPoints.lowestY);
+	highestY = std::max(highestY, otherPoints.highestY);
 }
 
 
-point HoI4::provincePoints::getCentermostPoint()
+point HoI4::provincePoints::getCentermostPoint() const
 {
-	point possibleCenter;
-	possibleCenter.first = (leftmostPoint.first + rightmostPoint.first) / 2;
-	possibleCenter.second = (lowestPoint.second + highestPoint.second) / 2;
-	if (thePoints.count(possibleCenter) > 0)
+	const point possibleCenter((leftmostX + rightmostX) / 2, (lowestY + highestY) / 2);
+
+	// the nearest pixel of a run is the one level with the center, or else the run's nearer end
+	float shortestDistance = 1000000;
+	point closestPoint;
+	for (const auto& run: runs)
 	{
-		return possibleCenter;
+		const point possiblePoint(std::clamp(possibleCenter.first, run.firstX, run.lastX), run.y);
+
+		float distanceSquared;
+		float deltaX = static_cast<float>(possiblePoint.first - possibleCenter.first);
+		distanceSquared = deltaX * deltaX;
+		float deltaY = static_cast<float>(possiblePoint.second - possibleCenter.second);
+		distanceSquared += deltaY * deltaY;
+
+		// on a tie, prefer the leftmost point, then the lowest, as when points were checked in order
+		if ((distanceSquared < shortestDistance) || ((distanceSquared == shortestDistance) && (possiblePoint < closestPoint)))
+		{
+			shortestDistance = distanceSquared;
+			closestPoint = possiblePoint;
+		}
 	}
-	else
+	return closestPoint;
+}
+
+
+namespace
+{
+
+const uint16_t noProvince = 0; // province numbers start at 1
+
+
+// Pixels are looked up as one packed 0xRRGGBB value, read straight from the bitmap's BGR rows. Only
+// the first pixel of each run of one color is looked up. Provinces too large for a label are left
+// unlabeled, and one of them is reported through oversizedProvince.
+void labelRow(const bitmap_image& provinceMap, unsigned int y, const provinceDefinitions& theProvinceDefinitions, uint16_t* labels, std::atomic<int>& oversizedProvince)
+{
+	const unsigned char* pixel = provinceMap.row(y);
+	const unsigned int bytesPerPixel = provinceMap.bytes_per_pixel();
+
+	int lastColor = -1;
+	uint16_t lastLabel = noProvince;
+	for (unsigned int x = 0; x < provinceMap.width(); x++, pixel += bytesPerPixel)
 	{
-		float shortestDistance = 1000000;
-		point closestPoint;
-		for (auto possiblePoint: thePoints)
+		const int color = (pixel[2] << 16) | (pixel[1] << 8) | pixel[0];
+		if (color != lastColor)
 		{
-			float distanceSquared;
-			float deltaX = static_cast<float>(possiblePoint.first - possibleCenter.first);
-			distanceSquared = deltaX * deltaX;
-			float deltaY = static_cast<float>(possiblePoint.second - possibleCenter.second);
-			distanceSquared += deltaY * deltaY;
-
-			if (distanceSquared < shortestDistance)
+			lastColor = color;
+			auto province = theProvinceDefinitions.getProvinceFromPackedColor(color).value_or(noProvince);
+			if (province <= std::numeric_limits<uint16_t>::max())
+			{
+				lastLabel = static_cast<uint16_t>(province);
+			}
+			else
 			{
-				shortestDistance = distanceSquared;
-				closestPoint = possiblePoint;
+				lastLabel = noProvince;
+				oversizedProvince.store(province, std::memory_order_relaxed);
 			}
 		}
-		return closestPoint;
+		labels[x] = lastLabel;
 	}
 }
 
 
-HoI4::MapData::MapData() noexcept:
-	provinceMap(theConfiguration.getHoI4Path() + "/map/provinces.bmp")
+// A pixel on the border of one province with another, packed so that sorting border pixels groups them
+// by province, then by neighbor, then in scan order: province << 48 | neighbor << 32 | (y * width + x)
+uint64_t packBorderPixel(uint16_t province, uint16_t neighbor, unsigned int pixel)
 {
-	if (!provinceMap)
+	return (static_cast<uint64_t>(province) << 48) | (static_cast<uint64_t>(neighbor) << 32) | pixel;
+}
+
+
+// What one horizontal band of the province map contributes
+struct mapBand
+{
+	std::vector<uint64_t> borderPixels;
+	std::map<int, HoI4::provincePoints> theProvincePoints;
+};
+
+
+void addBorder(mapBand& band, uint16_t province, unsigned int pixel, uint16_t otherProvince, unsigned int otherPixel)
+{
+	if ((province == noProvince) || (otherProvince == noProvince))
 	{
-		LOG(LogLevel::Error) << "Could not open " << theConfiguration.getHoI4Path() << "/map/provinces.bmp";
+		return;
 	}
 
-	unsigned int height = provinceMap.height();
-	unsigned int width = provinceMap.width();
+	band.borderPixels.push_back(packBorderPixel(province, otherProvince, pixel));
+	band.borderPixels.push_back(packBorderPixel(otherProvince, province, otherPixel));
+}
 
-	for (unsigned int y = 0; y < height; y++)
+
+// Each pixel is compared with the one to its right (wrapping around the map) and the one below it,
+// which between them cover every pair of touching pixels once. Rows firstRow to lastRow - 1 are
+// scanned; the row below lastRow is only read for comparison.
+void scanBand(const std::vector<uint16_t>& provinceLabels, unsigned int width, unsigned int height, unsigned int firstRow, unsigned int lastRow, mapBand& band)
+{
+	auto lastPoints = band.theProvincePoints.end();
+	for (unsigned int y = firstRow; y < lastRow; y++)
 	{
+		const uint16_t* row = &provinceLabels[y * width];
+		const uint16_t* below = (y + 1 < height) ? row + width : nullptr;
+
 		for (unsigned int x = 0; x < width; x++)
 		{
-			point position = { x, y };
-
-			ConverterColor::Color centerColor = getCenterColor(position);
-			ConverterColor::Color aboveColor = getAboveColor(position, height);
-			ConverterColor::Color belowColor = getBelowColor(position, height);
-			ConverterColor::Color leftColor = getLeftColor(position, width);
-			ConverterColor::Color rightColor = getRightColor(position, width);
-
-			position.second = height - position.second - 1;
-			if (centerColor != aboveColor)
-			{
-				handleNeighbor(centerColor, aboveColor, position);
-			}
-			if (centerColor != rightColor)
-			{
-				handleNeighbor(centerColor, rightColor, position);
-			}
-			if (centerColor != belowColor)
+			const unsigned int pixel = y * width + x;
+			const uint16_t province = row[x];
+			if (province != noProvince)
 			{
-				handleNeighbor(centerColor, belowColor, position);
+				if ((lastPoints == band.theProvincePoints.end()) || (lastPoints->first != province))
+				{
+					lastPoints = band.theProvincePoints.emplace(province, HoI4::provincePoints()).first;
+				}
+				lastPoints->second.addPoint(point(x, height - y - 1));
 			}
-			if (centerColor != leftColor)
+
+			const unsigned int rightX = (x + 1 < width) ? x + 1 : 0;
+			if (province != row[rightX])
 			{
-				handleNeighbor(centerColor, leftColor, position);
+				addBorder(band, province, pixel, row[rightX], y * width + rightX);
 			}
-
-			auto province = provinceDefinitions::getProvinceFromColor(centerColor);
-			if (province)
+			if ((below != nullptr) && (province != below[x]))
 			{
-				auto specificProvincePoints = theProvincePoints.find(*province);
-				if (specificProvincePoints != theProvincePoints.end())
-				{
-					specificProvincePoints->second.addPoint(position);
-				}
-				else
-				{
-					provincePoints theNewPoints;
-					theNewPoints.addPoint(position);
-					theProvincePoints.insert(make_pair(*province, theNewPoints));
-				}
+				addBorder(band, province, pixel, below[x], pixel + width);
 			}
 		}
 	}
 }
 
 
-ConverterColor::Color HoI4::MapData::getCenterColor(point position)
-{
-	rgb_t color;
-	provinceMap.get_pixel(position.first, position.second, color);
+const char* const mapCacheFilename = "mapData.cache";
 
-	ConverterColor::Color theColor(ConverterColor::red(color.red), ConverterColor::green(color.green), ConverterColor::blue(color.blue));
-	return theColor;
 }
 
 
-ConverterColor::Color HoI4::MapData::getAboveColor(point position, int height)
+HoI4::MapData::MapData(const provinceDefinitions& theProvinceDefinitions) noexcept
 {
-	if (position.second > 0)
+	if (readCache())
 	{
-		position.second--;
+		LOG(LogLevel::Info) << "Read map data from " << mapCacheFilename;
+		return;
 	}
 
-	rgb_t color;
-	provinceMap.get_pixel(position.first, position.second, color);
-
-	ConverterColor::Color theColor(ConverterColor::red(color.red), ConverterColor::green(color.green), ConverterColor::blue(color.blue));
-	return theColor;
+	scanProvinceMap(theProvinceDefinitions);
+	writeCache();
 }
 
 
-ConverterColor::Color HoI4::MapData::getBelowColor(point position, int height)
+void HoI4::MapData::scanProvinceMap(const provinceDefinitions& theProvinceDefinitions)
 {
-	if (position.second < height - 1)
+	bitmap_image provinceMap(theConfiguration.getHoI4Path() + "/map/provinces.bmp");
+	if (!provinceMap)
 	{
-		position.second++;
+		LOG(LogLevel::Error) << "Could not open " << theConfiguration.getHoI4Path() << "/map/provinces.bmp";
 	}
 
-	rgb_t color;
-	provinceMap.get_pixel(position.first, position.second, color);
+	width = provinceMap.width();
+	height = provinceMap.height();
+	provinceLabels.resize(static_cast<size_t>(width) * height);
 
-	ConverterColor::Color theColor(ConverterColor::red(color.red), ConverterColor::green(color.green), ConverterColor::blue(color.blue));
-	return theColor;
-}
+	const unsigned int rowsPerBand = 64;
+	const size_t bandCount = (height + rowsPerBand - 1) / rowsPerBand;
+	std::atomic<int> oversizedProvince(0);
+	commonItems::parallelFor(bandCount, [&](size_t bandNum)
+	{
+		const unsigned int firstRow = static_cast<unsigned int>(bandNum) * rowsPerBand;
+		for (unsigned int y = firstRow; y < std::min(firstRow + rowsPerBand, height); y++)
+		{
+			labelRow(provinceMap, y, theProvinceDefinitions, &provinceLabels[y * width], oversizedProvince);
+		}
+	});
+	if (oversizedProvince != 0)
+	{
+		LOG(LogLevel::Error) << "Province " << oversizedProvince.load() << " in definition.csv is above " << std::numeric_limits<uint16_t>::max() << ", so it and any other such provinces are left off the map";
+	}
 
+	std::vector<mapBand> bands(bandCount);
+	commonItems::parallelFor(bandCount, [&](size_t bandNum)
+	{
+		const unsigned int firstRow = static_cast<unsigned int>(bandNum) * rowsPerBand;
+		scanBand(provinceLabels, width, height, firstRow, std::min(firstRow + rowsPerBand, height), bands[bandNum]);
+	});
 
-ConverterColor::Color HoI4::MapData::getLeftColor(point position, int width)
-{
-	if (position.first > 0)
+	size_t borderPixelCount = 0;
+	for (const auto& band: bands)
 	{
-		position.first--;
+		borderPixelCount += band.borderPixels.size();
 	}
-	else
+	std::vector<uint64_t> borderPixels;
+	borderPixels.reserve(borderPixelCount);
+	for (auto& band: bands)
 	{
-		position.first = width - 1;
+		borderPixels.insert(borderPixels.end(), band.borderPixels.begin(), band.borderPixels.end());
+		band.borderPixels = std::vector<uint64_t>();
+
+		for (auto& points: band.theProvincePoints)
+		{
+			auto [existingPoints, inserted] = theProvincePoints.try_emplace(points.first, std::move(points.second));
+			if (!inserted)
+			{
+				existingPoints->second.addPoints(std::move(points.second));
+			}
+		}
 	}
 
-	rgb_t color;
-	provinceMap.get_pixel(position.first, position.second, color);
+	// a pixel can border the same province on several sides, and the bands overlap by a row
+	std::sort(borderPixels.begin(), borderPixels.end());
+	borderPixels.erase(std::unique(borderPixels.begin(), borderPixels.end()), borderPixels.end());
+
+	// each run of border pixels with the same province and neighbor is one edge of the graph
+	const size_t provinceCount = borderPixels.empty() ? 0 : static_cast<size_t>(borderPixels.back() >> 48) + 1;
+	neighborOffsets.assign(provinceCount + 1, 0);
+	for (auto edgeStart = borderPixels.begin(); edgeStart != borderPixels.end();)
+	{
+		const uint64_t edge = *edgeStart >> 32;
+		const auto edgeEnd = std::find_if(edgeStart, borderPixels.end(), [edge](uint64_t borderPixel) { return (borderPixel >> 32) != edge; });
+
+		neighborOffsets[(edge >> 16) + 1]++;
+		neighborList.push_back(static_cast<int>(edge & 0xFFFF));
+		const unsigned int centerPixel = static_cast<unsigned int>(*(edgeStart + (edgeEnd - edgeStart) / 2));
+		borderCenters.push_back(point(centerPixel % width, height - (centerPixel / width) - 1));
 
-	ConverterColor::Color theColor(ConverterColor::red(color.red), ConverterColor::green(color.green), ConverterColor::blue(color.blue));
-	return theColor;
+		edgeStart = edgeEnd;
+	}
+	std::partial_sum(neighborOffsets.begin(), neighborOffsets.end(), neighborOffsets.begin());
 }
 
 
-ConverterColor::Color HoI4::MapData::getRightColor(point position, int width)
+// The cache holds the label raster as runs of one label along each row, which also give the province
+// points, and the adjacency graph as it is
+bool HoI4::MapData::readCache()
 {
-	if (position.first < width - 1)
+	mapCacheReader cache(mapCacheFilename);
+	std::vector<uint16_t> runLabels;
+	std::vector<uint32_t> runLengths;
+	std::vector<int> centerCoordinates;
+	if (
+		!cache.read(width) ||
+		!cache.read(height) ||
+		!cache.read(runLabels) ||
+		!cache.read(runLengths) ||
+		!cache.read(neighborOffsets) ||
+		!cache.read(neighborList) ||
+		!cache.read(centerCoordinates) ||
+		(runLabels.size() != runLengths.size()) ||
+		(centerCoordinates.size() != 2 * neighborList.size()) ||
+		!areCachedNeighborsUsable() ||
+		!readCachedRuns(runLabels, runLengths)
+	)
 	{
-		position.first++;
+		neighborOffsets.clear();
+		neighborList.clear();
+		provinceLabels.clear();
+		theProvincePoints.clear();
+		return false;
 	}
-	else
+
+	borderCenters.reserve(neighborList.size());
+	for (size_t center = 0; center < neighborList.size(); center++)
 	{
-		position.first = 0;
+		borderCenters.push_back(point(centerCoordinates[2 * center], centerCoordinates[2 * center + 1]));
 	}
-
-	rgb_t color;
-	provinceMap.get_pixel(position.first, position.second, color);
-
-	ConverterColor::Color theColor(ConverterColor::red(color.red), ConverterColor::green(color.green), ConverterColor::blue(color.blue));
-	return theColor;
+	return true;
 }
 
 
-void HoI4::MapData::handleNeighbor(ConverterColor::Color centerColor, ConverterColor::Color otherColor, const point& position)
+// getNeighbors indexes neighborList through the offsets and getSpecifiedBorderCenter searches each
+// province's neighbors, so the offsets must stay in range and each province's neighbors be sorted
+bool HoI4::MapData::areCachedNeighborsUsable() const
 {
-	auto centerProvince = provinceDefinitions::getProvinceFromColor(centerColor);
-	auto otherProvince = provinceDefinitions::getProvinceFromColor(otherColor);
+	if (neighborOffsets.empty())
+	{
+		return neighborList.empty();
+	}
+	if ((neighborOffsets.front() != 0) || (neighborOffsets.back() != neighborList.size()))
+	{
+		return false;
+	}
 
-	if (centerProvince && otherProvince)
+	for (size_t province = 0; province + 1 < neighborOffsets.size(); province++)
 	{
-		addNeighbor(*centerProvince, *otherProvince);
-		addPointToBorder(*centerProvince, *otherProvince, position);
+		if (neighborOffsets[province] > neighborOffsets[province + 1])
+		{
+			return false;
+		}
+		if (!std::is_sorted(neighborList.data() + neighborOffsets[province], neighborList.data() + neighborOffsets[province + 1]))
+		{
+			return false;
+		}
 	}
+	return true;
 }
 
 
-void HoI4::MapData::addNeighbor(int mainProvince, int neighborProvince)
+// The runs must cover the map exactly, without any running past the end of a row
+bool HoI4::MapData::readCachedRuns(const std::vector<uint16_t>& runLabels, const std::vector<uint32_t>& runLengths)
 {
-	auto centerMapping = provinceNeighbors.find(mainProvince);
-	if (centerMapping != provinceNeighbors.end())
+	const uint64_t pixelCount = static_cast<uint64_t>(width) * height;
+	if (std::accumulate(runLengths.begin(), runLengths.end(), uint64_t(0)) != pixelCount)
 	{
-		centerMapping->second.insert(neighborProvince);
+		return false;
 	}
-	else
+
+	provinceLabels.resize(pixelCount);
+	unsigned int x = 0;
+	unsigned int y = 0;
+	for (size_t run = 0; run < runLabels.size(); run++)
 	{
-		std::set<int> neighbors = { neighborProvince };
-		provinceNeighbors[mainProvince] = neighbors;
+		if ((runLengths[run] == 0) || (runLengths[run] > width - x))
+		{
+			return false;
+		}
+
+		std::fill_n(&provinceLabels[static_cast<size_t>(y) * width + x], runLengths[run], runLabels[run]);
+		if (runLabels[run] != noProvince)
+		{
+			theProvincePoints[runLabels[run]].addRun(height - y - 1, x, x + runLengths[run] - 1);
+		}
+
+		x += runLengths[run];
+		if (x == width)
+		{
+			x = 0;
+			y++;
+		}
 	}
+	return (x == 0) && (y == height);
 }
 
 
-void HoI4::MapData::addPointToBorder(int mainProvince, int neighborProvince, point position)
+void HoI4::MapData::writeCache() const
 {
-	auto bordersWithNeighbors = borders.find(mainProvince);
-	if (bordersWithNeighbors == borders.end())
+	std::vector<uint16_t> runLabels;
+	std::vector<uint32_t> runLengths;
+	for (unsigned int y = 0; y < height; y++)
 	{
-		bordersWith newBordersWithNeighbors;
-		borders.insert(make_pair(mainProvince, newBordersWithNeighbors));
-		bordersWithNeighbors = borders.find(mainProvince);
+		const uint16_t* row = &provinceLabels[y * width];
+		for (unsigned int x = 0; x < width;)
+		{
+			unsigned int runEnd = x + 1;
+			while ((runEnd < width) && (row[runEnd] == row[x]))
+			{
+				runEnd++;
+			}
+			runLabels.push_back(row[x]);
+			runLengths.push_back(runEnd - x);
+			x = runEnd;
+		}
 	}
 
-	auto border = bordersWithNeighbors->second.find(neighborProvince);
-	if (border == bordersWithNeighbors->second.end())
+	std::vector<int> centerCoordinates;
+	centerCoordinates.reserve(2 * borderCenters.size());
+	for (const auto& center: borderCenters)
 	{
-		borderPoints newBorder;
-		bordersWithNeighbors->second.insert(make_pair(neighborProvince, newBorder));
-		border = bordersWithNeighbors->second.find(neighborProvince);
+		centerCoordinates.push_back(center.first);
+		centerCoordinates.push_back(center.second);
 	}
 
-	if (border->second.size() == 0)
-	{
-		border->second.push_back(position);
-	}
-	else
-	{
-		auto lastPoint = border->second.back();
-		if ((lastPoint.first != position.first) || (lastPoint.second != position.second))
-		{
-			border->second.push_back(position);
-		}
-	}
+	mapCacheWriter cache(mapCacheFilename);
+	cache.write(width);
+	cache.write(height);
+	cache.write(runLabels);
+	cache.write(runLengths);
+	cache.write(neighborOffsets);
+	cache.write(neighborList);
+	cache.write(centerCoordinates);
+	cache.commit();
 }
 
 
-set<int> HoI4::MapData::getNeighbors(int province) const
+HoI4::neighborSpan HoI4::MapData::getNeighbors(int province) const
 {
-	auto neighbors = provinceNeighbors.find(province);
-	if (neighbors != provinceNeighbors.end())
-	{
-		return neighbors->second;
-	}
-	else
+	if ((province < 0) || (static_cast<size_t>(province) + 1 >= neighborOffsets.size()))
 	{
-		std::set<int> empty;
-		return empty;
+		return neighborSpan(nullptr, nullptr);
 	}
+
+	const int* neighbors = neighborList.data();
+	return neighborSpan(neighbors + neighborOffsets[province], neighbors + neighborOffsets[province + 1]);
 }
 
 
 optional<point> HoI4::MapData::getSpecifiedBorderCenter(int mainProvince, int neighbor) const
 {
-	auto bordersWithNeighbors = borders.find(mainProvince);
-	if (bordersWithNeighbors == borders.end())
+	auto neighbors = getNeighbors(mainProvince);
+	if (neighbors.empty())
 	{
 		LOG(LogLevel::Warning) << "Province " << mainProvince << " has no borders.";
 		return std::nullopt;
 	}
-	auto border = bordersWithNeighbors->second.find(neighbor);
-	if (border == bordersWithNeighbors->second.end())
+	auto border = std::lower_bound(neighbors.begin(), neighbors.end(), neighbor);
+	if ((border == neighbors.end()) || (*border != neighbor))
 	{
 		LOG(LogLevel::Warning) << "Province " << mainProvince << " does not border " << neighbor << ".";
 		return std::nullopt;
 	}
 
-	return border->second[(border->second.size() / 2)];
+	return borderCenters[border - neighborList.data()];
 }
 
 
 optional<point> HoI4::MapData::getAnyBorderCenter(int province) const
 {
-	auto bordersWithNeighbors = borders.find(province);
-	if (bordersWithNeighbors == borders.end())
-	{
-		LOG(LogLevel::Warning) << "Province " << province << " has no borders.";
-		return std::nullopt;
-	}
-	auto border = bordersWithNeighbors->second.begin();
-	if (border == bordersWithNeighbors->second.end())
+	auto neighbors = getNeighbors(province);
+	if (neighbors.empty())
 	{
 		LOG(LogLevel::Warning) << "Province " << province << " has no borders.";
 		return std::nullopt;
 	}
 
-	return border->second[(border->second.size() / 2)];
+	return borderCenters[neighbors.begin() - neighborList.data()];
 }
 
 
-optional<int> HoI4::MapData::getProvinceNumber(double x, double y)
+optional<int> HoI4::MapData::getProvinceNumber(double x, double y) const
 {
-	rgb_t color;
-	provinceMap.get_pixel(static_cast<unsigned int>(x), (provinceMap.height() - 1) - static_cast<unsigned int>(y), color);
-	ConverterColor::Color theColor(ConverterColor::red(color.red), ConverterColor::green(color.green), ConverterColor::blue(color.blue));
-	return provinceDefinitions::getProvinceFromColor(theColor);
+	if ((x < 0.0) || (y < 0.0) || (x >= width) || (y >= height))
+	{
+		return {};
+	}
+
+	const uint16_t province = provinceLabels[((height - 1) - static_cast<unsigned int>(y)) * width + static_cast<unsigned int>(x)];
+	if (province == noProvince)
+	{
+		return {};
+	}
+	return province;
 }
 
 
@@ -28,48 +28,76 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 #include <optional>
 #include <map>
-#include <set>
-#include "../bitmap_image.hpp"
-#include "../Color.h"
+#include <cstdint>
+#include <vector>
 
 
 
 typedef std::pair<int, int> point;
-typedef std::vector<point> borderPoints;
-typedef std::map<int, borderPoints> bordersWith;
+
+
+
+class provinceDefinitions;
 
 
 
 namespace HoI4
 {
 
+// The pixels of one province, kept as the horizontal runs they form on the map rather than one by one
 class provincePoints
 {
 	public:
 		provincePoints() = default;
 
-		void addPoint(const point& thePoint);
+		void addPoint(const point& thePoint); // points must be added row by row, left to right
+		void addRun(int y, int firstX, int lastX);
+		void addPoints(provincePoints&& otherPoints);
+
+		point getCentermostPoint() const;
+
+	private:
+		struct pixelRun
+		{
+			int y;
+			int firstX;
+			int lastX;
+		};
+		std::vector<pixelRun> runs;
+
+		int leftmostX = 1000000;
+		int rightmostX = -1;
+		int lowestY = 1000000;
+		int highestY = -1;
+};
+
+
+// A province's neighbors, viewed in place inside MapData
+class neighborSpan
+{
+	public:
+		neighborSpan(const int* _first, const int* _last): first(_first), last(_last) {}
 
-		point getCentermostPoint();
+		const int* begin() const { return first; }
+		const int* end() const { return last; }
+		size_t size() const { return last - first; }
+		bool empty() const { return first == last; }
 
 	private:
-		std::set<point> thePoints;
-		point leftmostPoint = {1000000, 0};
-		point rightmostPoint = {-1, 0};
-		point highestPoint = {0, -1};
-		point lowestPoint = {0, 1000000};
+		const int* first;
+		const int* last;
 };
 
 
 class MapData
 {
 	public:
-		MapData() noexcept;
+		explicit MapData(const provinceDefinitions& theProvinceDefinitions) noexcept;
 
-		std::set<int> getNeighbors(int province) const;
+		neighborSpan getNeighbors(int province) const;
 		std::optional<point> getSpecifiedBorderCenter(int mainProvince, int neighbor) const;
 		std::optional<point> getAnyBorderCenter(int province) const;
-		std::optional<int> getProvinceNumber(double x, double y);
+		std::optional<int> getProvinceNumber(double x, double y) const;
 
 		std::optional<provincePoints> getProvincePoints(int provinceNum) const;
 
@@ -77,20 +105,23 @@ class MapData
 		MapData(const MapData&) = delete;
 		MapData& operator=(const MapData&) = delete;
 
-		ConverterColor::Color getCenterColor(point position);
-		ConverterColor::Color getAboveColor(point position, int height);
-		ConverterColor::Color getBelowColor(point position, int height);
-		ConverterColor::Color getLeftColor(point position, int width);
-		ConverterColor::Color getRightColor(point position, int width);
-		void handleNeighbor(ConverterColor::Color centerColor, ConverterColor::Color otherColor, const point& position);
-		void addNeighbor(int mainProvince, int neighborProvince);
-		void addPointToBorder(int mainProvince, int neighborProvince, point position);
-
-		std::map<int, std::set<int>> provinceNeighbors;
-		std::map<int, bordersWith> borders;
+		void scanProvinceMap(const provinceDefinitions& theProvinceDefinitions);
+		bool readCache();
+		bool areCachedNeighborsUsable() const;
+		bool readCachedRuns(const std::vector<uint16_t>& runLabels, const std::vector<uint32_t>& runLengths);
+		void writeCache() const;
+
+		// The province adjacency graph in compressed sparse row form: the neighbors of province p are
+		// neighborList[neighborOffsets[p]] up to neighborList[neighborOffsets[p + 1]], in ascending order.
+		// borderCenters holds the center of the border behind each entry of neighborList.
+		std::vector<unsigned int> neighborOffsets;
+		std::vector<int> neighborList;
+		std::vector<point> borderCenters;
 		std::map<int, provincePoints> theProvincePoints;
 
-		bitmap_image provinceMap;
+		unsigned int width = 0;
+		unsigned int height = 0;
+		std::vector<uint16_t> provinceLabels; // the province at each pixel of provinces.bmp, 0 for none, top row first
 };
 
 }
@@ -47,12 +47,12 @@ class UnitMapping: commonItems::parser
 
 HoI4::UnitMapping::UnitMapping(std::istream& theStream)
 {
-	registerKeyword(std::regex("vic"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("vic", [this](const std::string& unused, std::istream& theStream)
 	{
 		commonItems::singleString typeString(theStream);
 		Vic2Type = typeString.getString();
 	});
-	registerKeyword(std::regex("hoi"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("hoi", [this](const std::string& unused, std::istream& theStream)
 	{
 		HoI4::UnitMap theUnit(theStream);
 		HoI4Type = theUnit;
@@ -65,13 +65,13 @@ HoI4::UnitMapping::UnitMapping(std::istream& theStream)
 HoI4::militaryMappings::militaryMappings(const std::string& name, std::istream& theStream):
 	mappingsName(name)
 {
-	registerKeyword(std::regex("map"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("map", [this](const std::string& unused, std::istream& theStream){
 		importUnitMap(theStream);
 	});
-	registerKeyword(std::regex("division_templates"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("division_templates", [this](const std::string& unused, std::istream& theStream){
 		importDivisionTemplates(theStream);
 	});
-	registerKeyword(std::regex("substitutes"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("substitutes", [this](const std::string& unused, std::istream& theStream){
 		importSubstitutes(theStream);
 	});
 
@@ -98,7 +98,7 @@ class UnitMappingsImporter: commonItems::parser
 
 HoI4::UnitMappingsImporter::UnitMappingsImporter(std::istream& theStream)
 {
-	registerKeyword(std::regex("link"), [this](const std::string& unused, std::istream&theStream)
+	registerKeyword("link", [this](const std::string& unused, std::istream&theStream)
 	{
 		UnitMapping newMapping(theStream);
 		unitMap.insert(make_pair(newMapping.getVic2Type(), newMapping.getHoI4Type()));
@@ -133,7 +133,7 @@ class DivisionTemplatesImporter: commonItems::parser
 
 HoI4::DivisionTemplatesImporter::DivisionTemplatesImporter(std::istream& theStream)
 {
-	registerKeyword(std::regex("division_template"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("division_template", [this](const std::string& unused, std::istream& theStream)
 	{
 		HoI4::DivisionTemplateType newTemplate(theStream);
 		divisionTemplates.push_back(newTemplate);
@@ -169,7 +169,7 @@ class substitutesImporter: commonItems::parser
 
 HoI4::substitutesImporter::substitutesImporter(std::istream& theStream)
 {
-	registerKeyword(std::regex("[a-zA-Z_]+"), [this](const std::string& left, std::istream& theStream)
+	registerRegex("[a-zA-Z_]+", [this](const std::string& left, std::istream& theStream)
 	{
 		commonItems::singleString right(theStream);
 		substitutes.insert(std::make_pair(left, right.getString()));
@@ -65,51 +65,51 @@ class culture: commonItems::parser
 
 culture::culture(std::istream& theStream)
 {
-	registerKeyword(std::regex("first_names"), [this](const std::string unused, std::istream& theStream){
+	registerKeyword("first_names", [this](const std::string unused, std::istream& theStream){
 		commonItems::stringList firstNameStrings(theStream);
 		maleNames = firstNameStrings.getStrings();
 	});
-	registerKeyword(std::regex("last_names"), [this](const std::string unused, std::istream& theStream){
+	registerKeyword("last_names", [this](const std::string unused, std::istream& theStream){
 		commonItems::stringList firstNameStrings(theStream);
 		surnames = firstNameStrings.getStrings();
 	});
-	registerKeyword(std::regex("female_names"), [this](const std::string unused, std::istream& theStream){
+	registerKeyword("female_names", [this](const std::string unused, std::istream& theStream){
 		commonItems::stringList firstNameStrings(theStream);
 		femaleNames = firstNameStrings.getStrings();
 	});
-	registerKeyword(std::regex("female_surnames"), [this](const std::string unused, std::istream& theStream){
+	registerKeyword("female_surnames", [this](const std::string unused, std::istream& theStream){
 		commonItems::stringList firstNameStrings(theStream);
 		femaleSurnames = firstNameStrings.getStrings();
 	});
-	registerKeyword(std::regex("callsigns"), [this](const std::string unused, std::istream& theStream){
+	registerKeyword("callsigns", [this](const std::string unused, std::istream& theStream){
 		commonItems::stringList firstNameStrings(theStream);
 		callsigns = firstNameStrings.getStrings();
 	});
-	registerKeyword(std::regex("industry_companies"), [this](const std::string unused, std::istream& theStream){
+	registerKeyword("industry_companies", [this](const std::string unused, std::istream& theStream){
 		commonItems::stringList firstNameStrings(theStream);
 		industryCompanies = firstNameStrings.getStrings();
 	});
-	registerKeyword(std::regex("electronic_companies"), [this](const std::string unused, std::istream& theStream){
+	registerKeyword("electronic_companies", [this](const std::string unused, std::istream& theStream){
 		commonItems::stringList firstNameStrings(theStream);
 		electronicCompanies = firstNameStrings.getStrings();
 	});
-	registerKeyword(std::regex("car_companies"), [this](const std::string unused, std::istream& theStream){
+	registerKeyword("car_companies", [this](const std::string unused, std::istream& theStream){
 		commonItems::stringList firstNameStrings(theStream);
 		carCompanies = firstNameStrings.getStrings();
 	});
-	registerKeyword(std::regex("naval_companies"), [this](const std::string unused, std::istream& theStream){
+	registerKeyword("naval_companies", [this](const std::string unused, std::istream& theStream){
 		commonItems::stringList firstNameStrings(theStream);
 		navalCompanies = firstNameStrings.getStrings();
 	});
-	registerKeyword(std::regex("weapon_companies"), [this](const std::string unused, std::istream& theStream){
+	registerKeyword("weapon_companies", [this](const std::string unused, std::istream& theStream){
 		commonItems::stringList firstNameStrings(theStream);
 		weaponCompanies = firstNameStrings.getStrings();
 	});
-	registerKeyword(std::regex("aircraft_companies"), [this](const std::string unused, std::istream& theStream){
+	registerKeyword("aircraft_companies", [this](const std::string unused, std::istream& theStream){
 		commonItems::stringList firstNameStrings(theStream);
 		aircraftCompanies = firstNameStrings.getStrings();
 	});
-	registerKeyword(std::regex("[A-Za-z0-9\\_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9\\_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
@@ -138,11 +138,11 @@ class cultureGroup: commonItems::parser
 
 cultureGroup::cultureGroup(std::istream& theStream)
 {
-	registerKeyword(std::regex("leader"), commonItems::ignoreItem);
-	registerKeyword(std::regex("unit"), commonItems::ignoreItem);
-	registerKeyword(std::regex("union"), commonItems::ignoreItem);
-	registerKeyword(std::regex("is_overseas"), commonItems::ignoreItem);
-	registerKeyword(std::regex("[A-Za-z0-9\\_]+"), [this](const std::string& cultureName, std::istream& theStream){
+	registerKeyword("leader", commonItems::ignoreItem);
+	registerKeyword("unit", commonItems::ignoreItem);
+	registerKeyword("union", commonItems::ignoreItem);
+	registerKeyword("is_overseas", commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9\\_]+", [this](const std::string& cultureName, std::istream& theStream){
 		culture newCulture(theStream);
 		newCulture.convertNamesToUTF8();
 		maleNamesMap.insert(make_pair(cultureName, newCulture.getMaleNames()));
@@ -177,7 +177,7 @@ HoI4::namesMapper::namesMapper() noexcept:
 void HoI4::namesMapper::processVic2CulturesFile(const std::string& filename)
 {
 	clearRegisteredKeywords();
-	registerKeyword(std::regex("[A-Za-z0-9\\_]+"), [this](const std::string& cultureGroupName, std::istream& theStream){
+	registerRegex("[A-Za-z0-9\\_]+", [this](const std::string& cultureGroupName, std::istream& theStream){
 		cultureGroup theGroup(theStream);
 		for (auto newMaleNameMapping: theGroup.getMaleNames())
 		{
@@ -196,7 +196,7 @@ void HoI4::namesMapper::processVic2CulturesFile(const std::string& filename)
 void HoI4::namesMapper::processNamesFile()
 {
 	clearRegisteredKeywords();
-	registerKeyword(std::regex("[A-Za-z0-9\\_]+"), [this](const std::string& cultureName, std::istream& theStream){
+	registerRegex("[A-Za-z0-9\\_]+", [this](const std::string& cultureName, std::istream& theStream){
 		culture newCulture(theStream);
 		auto tempNames = newCulture.getMaleNames();
 		addNamesToMap(maleNamesMap, cultureName, tempNames);
@@ -39,7 +39,7 @@ class actualResources: commonItems::parser
 
 actualResources::actualResources(std::istream& theStream)
 {
-	registerKeyword(std::regex("[a-z]+"), [this](const std::string& resourceName, std::istream& theStream){
+	registerRegex("[a-z]+", [this](const std::string& resourceName, std::istream& theStream){
 		commonItems::singleDouble resourceAmount(theStream);
 		theResources.insert(std::make_pair(resourceName, resourceAmount.getDouble()));
 	});
@@ -64,11 +64,11 @@ class link: commonItems::parser
 
 link::link(std::istream& theStream)
 {
-	registerKeyword(std::regex("province"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("province", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt theProvinceNum(theStream);
 		provinceNum = theProvinceNum.getInt();
 	});
-	registerKeyword(std::regex("resources"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("resources", [this](const std::string& unused, std::istream& theStream){
 		actualResources theActualResources(theStream);
 		theResources = theActualResources.getResources();
 	});
@@ -79,7 +79,7 @@ link::link(std::istream& theStream)
 
 resources::resources() noexcept
 {
-	registerKeyword(std::regex("link"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("link", [this](const std::string& unused, std::istream& theStream){
 		link theLink(theStream);
 		resourceMap.insert(std::make_pair(theLink.getProvinceNum(), theLink.getResources()));
 	});
@@ -43,11 +43,11 @@ class stateCategory: commonItems::parser
 
 stateCategory::stateCategory(std::istream& theStream)
 {
-	registerKeyword(std::regex("local_building_slots"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("local_building_slots", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt slotsInt(theStream);
 		numberOfSlots = slotsInt.getInt();
 	});
-	registerKeyword(std::regex("[A-Za-z0-9\\_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9\\_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
@@ -67,7 +67,7 @@ class stateCategoryFile: commonItems::parser
 
 stateCategoryFile::stateCategoryFile(std::istream& theStream)
 {
-	registerKeyword(std::regex("[a-z\\_]+"), [this](const std::string& categoryName, std::istream& theStream){
+	registerRegex("[a-z\\_]+", [this](const std::string& categoryName, std::istream& theStream){
 		stateCategory category(theStream);
 		theCategories.insert(make_pair(category.getNumberOfSlots(), categoryName));
 	});
@@ -78,7 +78,7 @@ stateCategoryFile::stateCategoryFile(std::istream& theStream)
 
 HoI4::stateCategories::stateCategories() noexcept
 {
-	registerKeyword(std::regex("state_categories"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("state_categories", [this](const std::string& unused, std::istream& theStream){
 		stateCategoryFile theFile(theStream);
 		for (auto category: theFile.getCategories())
 		{
@@ -49,19 +49,17 @@ class supplyArea: commonItems::parser
 
 supplyArea::supplyArea(std::istream& theStream)
 {
-	registerKeyword(std::regex("id"), [this](const std::string& unused, std::istream& theStream){
-		commonItems::singleInt idInt(theStream);
-		ID = idInt.getInt();
+	registerKeyword("id", [this](const std::string& unused, std::istream& theStream){
+		ID = commonItems::readInt(theStream);
 	});
-	registerKeyword(std::regex("value"), [this](const std::string& unused, std::istream& theStream){
-		commonItems::singleInt valueInt(theStream);
-		value = valueInt.getInt();
+	registerKeyword("value", [this](const std::string& unused, std::istream& theStream){
+		value = commonItems::readInt(theStream);
 	});
-	registerKeyword(std::regex("states"), [this](const std::string& unused, std::istream& theStream){
-		commonItems::intList stateInts(theStream);
-		states = stateInts.getInts();
+	registerKeyword("states", [this](const std::string& unused, std::istream& theStream){
+		states.clear();
+		commonItems::readInts(theStream, states);
 	});
-	registerKeyword(std::regex("[a-zA-Z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[a-zA-Z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
@@ -77,7 +75,7 @@ HoI4::SupplyZones::SupplyZones(const std::map<int, HoI4::State*>& defaultStates)
 	LOG(LogLevel::Info) << "Importing supply zones";
 	importStates(defaultStates);
 
-	registerKeyword(std::regex("supply_area"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("supply_area", [this](const std::string& unused, std::istream& theStream){
 		supplyArea area(theStream);
 		auto ID = area.getID();
 
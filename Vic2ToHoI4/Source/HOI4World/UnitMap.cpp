@@ -28,19 +28,19 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 HoI4::UnitMap::UnitMap(std::istream& theStream)
 {
-	registerKeyword(std::regex("category"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("category", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString categoryString(theStream);
 		category = categoryString.getString();
 	});
-	registerKeyword(std::regex("type"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("type", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString typeString(theStream);
 		type = typeString.getString();
 	});
-	registerKeyword(std::regex("equipment"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("equipment", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString equipmentString(theStream);
 		equipment = equipmentString.getString();
 	});
-	registerKeyword(std::regex("size"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("size", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt sizeInt(theStream);
 		size = sizeInt.getInt();
 	});
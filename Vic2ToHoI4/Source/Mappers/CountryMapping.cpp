@@ -45,11 +45,11 @@ class countryMappingRule: commonItems::parser
 
 countryMappingRule::countryMappingRule(std::istream& theStream)
 {
-	registerKeyword(std::regex("vic"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("vic", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString mapping(theStream);
 		Vic2Tag = mapping.getString();
 	});
-	registerKeyword(std::regex("hoi"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("hoi", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString mapping(theStream);
 		HoI4Tags.push_back(mapping.getString());
 	});
@@ -72,7 +72,7 @@ CountryMapper::CountryMapper(const Vic2::World* srcWorld):
 
 void CountryMapper::readRules()
 {
-	registerKeyword(std::regex("link"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("link", [this](const std::string& unused, std::istream& theStream){
 		countryMappingRule rule(theStream);
 		Vic2TagToHoI4TagsRules.insert(make_pair(rule.getVic2Tag(), rule.getHoI4Tags()));
 	});
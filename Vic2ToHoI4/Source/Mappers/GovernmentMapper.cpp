@@ -42,19 +42,19 @@ class aGovernmentMapping: commonItems::parser
 
 aGovernmentMapping::aGovernmentMapping(std::istream& theStream)
 {
-	registerKeyword(std::regex("vic"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("vic", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString vic2Government(theStream);
 		mapping.vic2Government = vic2Government.getString();
 	});
-	registerKeyword(std::regex("ruling_party"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("ruling_party", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString rulingParty(theStream);
 		mapping.rulingPartyRequired = rulingParty.getString();
 	});
-	registerKeyword(std::regex("hoi_gov"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("hoi_gov", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString hoi4Government(theStream);
 		mapping.HoI4GovernmentIdeology = hoi4Government.getString();
 	});
-	registerKeyword(std::regex("hoi_leader"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("hoi_leader", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString hoi4Leader(theStream);
 		mapping.HoI4LeaderIdeology = hoi4Leader.getString();
 	});
@@ -77,7 +77,7 @@ class governmentMappings: commonItems::parser
 
 governmentMappings::governmentMappings(std::istream& theStream)
 {
-	registerKeyword(std::regex("mapping"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("mapping", [this](const std::string& unused, std::istream& theStream){
 		aGovernmentMapping mapping(theStream);
 		governmentMap.push_back(mapping.getMapping());
 	});
@@ -100,15 +100,15 @@ class aPartyMapping: commonItems::parser
 
 aPartyMapping::aPartyMapping(std::istream& theStream)
 {
-	registerKeyword(std::regex("ruling_ideology"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("ruling_ideology", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString ideologyString(theStream);
 		mapping.rulingIdeology = ideologyString.getString();
 	});
-	registerKeyword(std::regex("vic2_ideology"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("vic2_ideology", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString ideologyString(theStream);
 		mapping.vic2Ideology = ideologyString.getString();
 	});
-	registerKeyword(std::regex("supported_ideology"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("supported_ideology", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString ideologyString(theStream);
 		mapping.supportedIdeology = ideologyString.getString();
 	});
@@ -131,7 +131,7 @@ class partyMappings: commonItems::parser
 
 partyMappings::partyMappings(std::istream& theStream)
 {
-	registerKeyword(std::regex("mapping"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("mapping", [this](const std::string& unused, std::istream& theStream){
 		aPartyMapping mapping(theStream);
 		partyMap.push_back(mapping.getMapping());
 	});
@@ -142,11 +142,11 @@ partyMappings::partyMappings(std::istream& theStream)
 
 governmentMapper::governmentMapper() noexcept
 {
-	registerKeyword(std::regex("government_mappings"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("government_mappings", [this](const std::string& unused, std::istream& theStream){
 		governmentMappings mappings(theStream);
 		governmentMap = mappings.getGovernmentMap();
 	});
-	registerKeyword(std::regex("party_mappings"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("party_mappings", [this](const std::string& unused, std::istream& theStream){
 		partyMappings mappings(theStream);
 		partyMap = mappings.getPartyMap();
 	});
@@ -41,7 +41,7 @@ class ideologyToPortraitsMapping: commonItems::parser
 
 ideologyToPortraitsMapping::ideologyToPortraitsMapping(std::istream& theStream)
 {
-	registerKeyword(std::regex("[a-zA-Z0-9_]+"), [this](const std::string& ideology, std::istream& theStream){
+	registerRegex("[a-zA-Z0-9_]+", [this](const std::string& ideology, std::istream& theStream){
 		commonItems::stringList portraits(theStream);
 		theMap.insert(make_pair(ideology, portraits.getStrings()));
 	});
@@ -71,19 +71,19 @@ class graphicsCultureGroup: commonItems::parser
 
 graphicsCultureGroup::graphicsCultureGroup(std::istream& theStream)
 {
-	registerKeyword(std::regex("leader_portraits"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("leader_portraits", [this](const std::string& unused, std::istream& theStream){
 		ideologyToPortraitsMapping mappings(theStream);
 		leaderPortraits = mappings.getMap();
 	});
-	registerKeyword(std::regex("ideology_minister_portraits"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("ideology_minister_portraits", [this](const std::string& unused, std::istream& theStream){
 		ideologyToPortraitsMapping mappings(theStream);
 		ideologyMinisterPortraits = mappings.getMap();
 	});
-	registerKeyword(std::regex("graphical_culture"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("graphical_culture", [this](const std::string& unused, std::istream& theStream){
 		commonItems::stringList graphicsString(theStream);
 		graphicalCulture = graphicsString.getStrings()[0];
 	});
-	registerKeyword(std::regex("graphical_culture_2d"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("graphical_culture_2d", [this](const std::string& unused, std::istream& theStream){
 		commonItems::stringList graphicsString(theStream);
 		graphicalCulture2D = graphicsString.getStrings()[0];
 	});
@@ -97,7 +97,7 @@ graphicsMapper::graphicsMapper() noexcept:
 {
 	LOG(LogLevel::Info) << "Reading graphics mappings";
 
-	registerKeyword(std::regex("[a-zA-Z0-9_]+"), [this](const std::string& cultureGroupName, std::istream& theStream){
+	registerRegex("[a-zA-Z0-9_]+", [this](const std::string& cultureGroupName, std::istream& theStream){
 		graphicsCultureGroup newCultureGroup(theStream);
 		graphicalCultureMap[cultureGroupName] = newCultureGroup.getGraphicalCulture();
 		graphicalCulture2dMap[cultureGroupName] = newCultureGroup.getGraphicalCulture2D();
@@ -44,7 +44,7 @@ class MergeRule: commonItems::parser
 
 MergeRules::MergeRules() noexcept
 {
-	registerKeyword(std::regex("[A-Za-z_]+"), [this](const std::string& ruleName, std::istream& theStream){
+	registerRegex("[A-Za-z_]+", [this](const std::string& ruleName, std::istream& theStream){
 		MergeRule theRule(theStream);
 		if (theRule.isEnabled())
 		{
@@ -58,15 +58,15 @@ MergeRules::MergeRules() noexcept
 
 MergeRule::MergeRule(std::istream& theStream)
 {
-	registerKeyword(std::regex("merge"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("merge", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString enabledString(theStream);
 		enabled = (enabledString.getString() == "yes");
 	});
-	registerKeyword(std::regex("master"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("master", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString masterString(theStream);
 		master = masterString.getString();
 	});
-	registerKeyword(std::regex("slave"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("slave", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString slaveString(theStream);
 		slaves.push_back(slaveString.getString());
 	});
@@ -29,11 +29,7 @@ using namespace std;
 
 
 
-provinceDefinitions* provinceDefinitions::instance = nullptr;
-
-
-
-provinceDefinitions::provinceDefinitions() noexcept:
+provinceDefinitions::provinceDefinitions(const Configuration& theConfiguration):
 	landProvinces(),
 	colorToProvinceMap()
 {
@@ -74,7 +70,7 @@ provinceDefinitions::provinceDefinitions() noexcept:
 
 		ConverterColor::Color provinceColor(red, green, blue);
 		int colorInt = getIntFromColor(provinceColor);
-		colorToProvinceMap.insert(make_pair(colorInt, provNum));
+		colorToProvinceMap.insert(colorInt, provNum);
 
 		pos = line.find_first_of(';');
 		line = line.substr(0, pos);
@@ -90,14 +86,17 @@ provinceDefinitions::provinceDefinitions() noexcept:
 }
 
 
-optional<int> provinceDefinitions::GetProvinceFromColor(const ConverterColor::Color& color) const
+optional<int> provinceDefinitions::getProvinceFromColor(const ConverterColor::Color& color) const
 {
-	int colorInt = getIntFromColor(color);
+	return getProvinceFromPackedColor(getIntFromColor(color));
+}
+
 
-	auto mapping = colorToProvinceMap.find(colorInt);
-	if (mapping != colorToProvinceMap.end())
+optional<int> provinceDefinitions::getProvinceFromPackedColor(int packedColor) const
+{
+	if (auto mapping = colorToProvinceMap.find(packedColor); mapping != nullptr)
 	{
-		return mapping->second;
+		return *mapping;
 	}
 	else
 	{
@@ -30,54 +30,38 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include <map>
 #include <set>
 #include "../Color.h"
+#include "FlatHashMap.h"
 using namespace std;
 
 
 
+class Configuration;
+
+
+
+// Which HoI4 provinces are land and sea, and which color marks each on the province map. Read once
+// from definition.csv, then only queried, so one instance can be shared between threads.
 class provinceDefinitions
 {
 	public:
-		static const set<int>& getLandProvinces()
-		{
-			return getInstance()->landProvinces;
-		}
-		static const bool isLandProvince(int province)
-		{
-			return (getInstance()->landProvinces.count(province) > 0);
-		}
-		static const bool isSeaProvince(int province)
-		{
-			return (getInstance()->seaProvinces.count(province) > 0);
-		}
-
-		static optional<int> getProvinceFromColor(const ConverterColor::Color& color)
-		{
-			return getInstance()->GetProvinceFromColor(color);
-		}
+		explicit provinceDefinitions(const Configuration& theConfiguration);
 
-	private:
-		static provinceDefinitions* instance;
-		static provinceDefinitions* getInstance()
-		{
-			if (instance == nullptr)
-			{
-				instance = new provinceDefinitions();
-			}
-
-			return instance;
-		}
-		provinceDefinitions() noexcept;
+		const set<int>& getLandProvinces() const { return landProvinces; }
+		bool isLandProvince(int province) const { return (landProvinces.count(province) > 0); }
+		bool isSeaProvince(int province) const { return (seaProvinces.count(province) > 0); }
 
+		optional<int> getProvinceFromColor(const ConverterColor::Color& color) const;
+		optional<int> getProvinceFromPackedColor(int packedColor) const; // packedColor is 0xRRGGBB
+
+	private:
 		provinceDefinitions(const provinceDefinitions&) = delete;
 		provinceDefinitions& operator=(const provinceDefinitions&) = delete;
 
-		optional<int> GetProvinceFromColor(const ConverterColor::Color& color) const;
-
 		int getIntFromColor(const ConverterColor::Color& color) const;
 
 		set<int> landProvinces;
 		set<int> seaProvinces;
-		map<int, int> colorToProvinceMap;	// colors are a packed integer to work around some issues. If you can get Colors to work directly, please replace this hack.
+		commonItems::flatHashMap<int, int> colorToProvinceMap;	// colors are a packed integer to work around some issues. If you can get Colors to work directly, please replace this hack.
 };
 
 
@@ -30,10 +30,6 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
-provinceMapper theProvinceMapper;
-
-
-
 class mapping: commonItems::parser
 {
 	public:
@@ -50,11 +46,11 @@ class mapping: commonItems::parser
 
 mapping::mapping(std::istream& theStream)
 {
-	registerKeyword(std::regex("vic2"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("vic2", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt provinceNum(theStream);
 		Vic2Nums.push_back(provinceNum.getInt());
 	});
-	registerKeyword(std::regex("hoi4"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("hoi4", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt provinceNum(theStream);
 		HoI4Nums.push_back(provinceNum.getInt());
 	});
@@ -91,7 +87,7 @@ class versionMappings: commonItems::parser
 
 versionMappings::versionMappings(std::istream& theStream)
 {
-	registerKeyword(std::regex("link"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("link", [this](const std::string& unused, std::istream& theStream){
 		mapping theMapping(theStream);
 		insertIntoHoI4ToVic2ProvinceMap(theMapping.getVic2Nums(), theMapping.getHoI4Nums());
 		insertIntoVic2ToHoI4ProvinceMap(theMapping.getVic2Nums(), theMapping.getHoI4Nums());
@@ -125,10 +121,10 @@ void versionMappings::insertIntoVic2ToHoI4ProvinceMap(const std::vector<int>& Vi
 }
 
 
-void provinceMapper::initialize()
+provinceMapper::provinceMapper(const Configuration& theConfiguration)
 {
 	bool gotMappings = false;
-	registerKeyword(std::regex("\\d\\.\\d\\.\\d"), [this, &gotMappings](const std::string& version, std::istream& theStream){
+	registerRegex("\\d\\.\\d\\.\\d", [this, &gotMappings, &theConfiguration](const std::string& version, std::istream& theStream){
 		HoI4::Version currentVersion(version);
 		if ((theConfiguration.getHOI4Version() >= currentVersion) && !gotMappings)
 		{
@@ -160,11 +156,11 @@ void provinceMapper::initialize()
 		parseFile("province_mappings.txt");
 	}
 
-	checkAllHoI4ProvinesMapped();
+	checkAllHoI4ProvinesMapped(theConfiguration);
 }
 
 
-void provinceMapper::checkAllHoI4ProvinesMapped() const
+void provinceMapper::checkAllHoI4ProvinesMapped(const Configuration& theConfiguration) const
 {
 	std::ifstream definitions(theConfiguration.getHoI4Path() + "/map/definition.csv");
 	if (!definitions.is_open())
@@ -38,11 +38,16 @@ typedef std::map<int, std::vector<int>> Vic2ToHoI4ProvinceMapping;
 
 
 
+class Configuration;
+
+
+
+// The links between Vic2 and HoI4 provinces for the configured HoI4 version. Built once, then only
+// queried, so one instance can be shared between threads.
 class provinceMapper: commonItems::parser
 {
 	public:
-		provinceMapper() = default;
-		void initialize();
+		explicit provinceMapper(const Configuration& theConfiguration);
 
 		std::optional<std::vector<int>> getVic2ToHoI4ProvinceMapping(int Vic2Province) const;
 		std::optional<std::vector<int>> getHoI4ToVic2ProvinceMapping(int HoI4Province) const;
@@ -51,7 +56,7 @@ class provinceMapper: commonItems::parser
 		provinceMapper(const provinceMapper&) = delete;
 		provinceMapper& operator=(const provinceMapper&) = delete;
 
-		void checkAllHoI4ProvinesMapped() const;
+		void checkAllHoI4ProvinesMapped(const Configuration& theConfiguration) const;
 		std::optional<int> getNextProvinceNumFromFile(std::ifstream& definitions) const;
 		void verifyProvinceIsMapped(int provNum) const;
 
@@ -60,8 +65,5 @@ class provinceMapper: commonItems::parser
 };
 
 
-extern provinceMapper theProvinceMapper;
-
-
 
 #endif // PROVINCE_MAPPER_H
@@ -41,11 +41,11 @@ class techMapping: commonItems::parser
 
 techMapping::techMapping(std::istream& theStream)
 {
-	registerKeyword(std::regex("vic2"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("vic2", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString theKey(theStream);
 		key = theKey.getString();
 	});
-	registerKeyword(std::regex("[a-z0-9_]+"), [this](const std::string& valueName, std::istream& theStream){
+	registerRegex("[a-z0-9_]+", [this](const std::string& valueName, std::istream& theStream){
 		commonItems::singleInt valueValue(theStream);
 		values.push_back(make_pair(valueName, valueValue.getInt()));
 	});
@@ -69,7 +69,7 @@ class map: commonItems::parser
 
 map::map(std::istream& theStream)
 {
-	registerKeyword(std::regex("link"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("link", [this](const std::string& unused, std::istream& theStream)
 	{
 		techMapping theMapping(theStream);
 		mappings.insert(make_pair(theMapping.getKey(), theMapping.getValues()));
@@ -81,11 +81,11 @@ map::map(std::istream& theStream)
 
 techMapper::techMapper() noexcept
 {
-	registerKeyword(std::regex("tech_map"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("tech_map", [this](const std::string& unused, std::istream& theStream){
 		map theTechMap(theStream);
 		techMap = theTechMap.getMappings();
 	});
-	registerKeyword(std::regex("bonus_map"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("bonus_map", [this](const std::string& unused, std::istream& theStream){
 		map theBonusMap(theStream);
 		researchBonusMap = theBonusMap.getMappings();
 	});
@@ -29,11 +29,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
-V2Localisations* V2Localisations::instance = NULL;
-
-
-
-V2Localisations::V2Localisations() noexcept:
+V2Localisations::V2Localisations(const Configuration& theConfiguration):
 	localisations(),
 	localisationToKeyMap()
 {
@@ -80,17 +76,18 @@ void V2Localisations::ReadFromFile(const string& fileName)
 
 
 const string languages[] = { "english", "french", "german", "polish", "spanish", "italian", "swedish", "czech", "hungarian", "dutch", "braz_por", "russian", "finnish" };
-void V2Localisations::processLine(string line)
+void V2Localisations::processLine(const string& line)
 {
 	int division = line.find_first_of(';');
 	string key = line.substr(0, division);
 
 	bool pause = false;
+	string UTF8Result;
 	for (auto language: languages)
 	{
 		pause = false;
-		string result = getNextLocalisation(line, division);
-		auto UTF8Result = Utils::convertWin1252ToUTF8(result);
+		UTF8Result.clear();
+		Utils::appendWin1252ToUTF8(getNextLocalisation(line, division), UTF8Result);
 
 		if (language == "english")
 		{
@@ -108,15 +105,15 @@ void V2Localisations::processLine(string line)
 }
 
 
-string V2Localisations::getNextLocalisation(string line, int& division)
+std::string_view V2Localisations::getNextLocalisation(const string& line, int& division)
 {
 	int frontDivision = division + 1;
 	division = line.find_first_of(';', frontDivision);
-	return line.substr(frontDivision, division - frontDivision);
+	return std::string_view(line).substr(frontDivision, division - frontDivision);
 }
 
 
-void V2Localisations::ActuallyUpdateDomainCountry(const string& tag, const string& domainName)
+map<string, string> V2Localisations::GetDomainCountryNames(const string& tag, const string& domainName) const
 {
 	LanguageToLocalisationMap regionLocalisations;
 	const auto domainKey = localisationToKeyMap.find(domainName);
@@ -135,7 +132,7 @@ void V2Localisations::ActuallyUpdateDomainCountry(const string& tag, const strin
 	const auto KeyToLocalisationsMappings = localisations.find(tag);
 	if (KeyToLocalisationsMappings == localisations.end())
 	{
-		return;
+		return {};
 	}
 	auto nameInAllLanguages = KeyToLocalisationsMappings->second;
 
@@ -156,13 +153,15 @@ void V2Localisations::ActuallyUpdateDomainCountry(const string& tag, const strin
 		if (regionPos != string::npos)
 		{
 			updatedName.replace(regionPos, 8, replacementName);
-			KeyToLocalisationsMappings->second[nameInLanguage.first] = updatedName;
+			nameInAllLanguages[nameInLanguage.first] = updatedName;
 		}
 	}
+
+	return nameInAllLanguages;
 }
 
 
-const optional<string> V2Localisations::ActuallyGetTextInLanguage(const string& key, const string& language) const
+optional<string> V2Localisations::GetTextInLanguage(const string& key, const string& language) const
 {
 	const auto KeyToLocalisationsMapping = localisations.find(key);
 	if (KeyToLocalisationsMapping == localisations.end())
@@ -180,7 +179,7 @@ const optional<string> V2Localisations::ActuallyGetTextInLanguage(const string&
 }
 
 
-const map<string, string> V2Localisations::ActuallyGetTextInEachLanguage(const string& key) const
+const map<string, string>& V2Localisations::GetTextInEachLanguage(const string& key) const
 {
 	static const map<string, string> noLocalisations;
 
@@ -29,51 +29,38 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include <optional>
 #include <map>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 using namespace std;
 
 
 
+class Configuration;
+
+
+
+// The Vic2 game and mod localisations, by key and then language. Read once, then only queried, so
+// one instance can be shared between threads.
 class V2Localisations
 {
 	public:
-		static const optional<string> GetTextInLanguage(const string& key, const string& language)
-		{
-			return getInstance()->ActuallyGetTextInLanguage(key, language);
-		}
-		static const map<string, string> GetTextInEachLanguage(const string& key)
-		{
-			return getInstance()->ActuallyGetTextInEachLanguage(key);
-		}
-		static void UpdateDomainCountry(const string& tag, const string& dominionName)
-		{
-			return getInstance()->ActuallyUpdateDomainCountry(tag, dominionName);
-		}
+		explicit V2Localisations(const Configuration& theConfiguration);
+
+		optional<string> GetTextInLanguage(const string& key, const string& language) const;
+		const map<string, string>& GetTextInEachLanguage(const string& key) const;
+
+		// A dominion's name in each language, with the $REGION$ in it filled in from its domain
+		map<string, string> GetDomainCountryNames(const string& tag, const string& domainName) const;
 
 	private:
-		static V2Localisations* instance;
-		static V2Localisations* getInstance()
-		{
-			if (instance == NULL)
-			{
-				instance = new V2Localisations();
-			}
-			return instance;
-		}
-
-		V2Localisations() noexcept;
 		void ReadFromAllFilesInFolder(const string& folderPath);
 		void ReadFromFile(const string& fileName);
-		void processLine(string line);
-		string getNextLocalisation(string line, int& division);
+		void processLine(const string& line);
+		std::string_view getNextLocalisation(const string& line, int& division);
 
 		V2Localisations(const V2Localisations&) = delete;
 		V2Localisations& operator=(const V2Localisations&) = delete;
 
-		const optional<string> ActuallyGetTextInLanguage(const string& key, const string& language) const;
-		const map<string, string> ActuallyGetTextInEachLanguage(const string& key) const;
-		void ActuallyUpdateDomainCountry(const string & tag, const string & dominionName);
-
 		typedef map<string, string> LanguageToLocalisationMap;
 		typedef unordered_map<string, LanguageToLocalisationMap> KeyToLocalisationsMap;
 		KeyToLocalisationsMap localisations;
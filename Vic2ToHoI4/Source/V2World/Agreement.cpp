@@ -29,7 +29,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 Vic2::Agreement::Agreement(const std::string& agreementType, std::istream& theStream):
 	type(agreementType)
 {
-	registerKeyword(std::regex("first"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("first", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString countryString(theStream);
 		country1 = countryString.getString();
 		if (country1.substr(0,1) == "\"")
@@ -37,7 +37,7 @@ Vic2::Agreement::Agreement(const std::string& agreementType, std::istream& theSt
 			country1 = country1.substr(1, country1.size()-2);
 		}
 	});
-	registerKeyword(std::regex("second"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("second", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString countryString(theStream);
 		country2 = countryString.getString();
 		if (country2.substr(0,1) == "\"")
@@ -45,11 +45,11 @@ Vic2::Agreement::Agreement(const std::string& agreementType, std::istream& theSt
 			country2 = country2.substr(1, country2.size()-2);
 		}
 	});
-	registerKeyword(std::regex("start_date"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("start_date", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString dateString(theStream);
 		startDate = date(dateString.getString());
 	});
-	registerKeyword(std::regex("[A-Za-z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
\ No newline at end of file
@@ -30,32 +30,32 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 Vic2::Regiment::Regiment(std::istream& theStream)
 {
-	registerKeyword(std::regex("name"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("name", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString nameString(theStream);
 		name = Utils::convertWin1252ToUTF8(nameString.getString());
 	});
-	registerKeyword(std::regex("type"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("type", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString typeString(theStream);
 		type = typeString.getString();
 	});
-	registerKeyword(std::regex("strength"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("strength", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleDouble strengthDouble(theStream);
 		strength = strengthDouble.getDouble();
 	});
-	registerKeyword(std::regex("organisation"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("organisation", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleDouble organizationDouble(theStream);
 		organization = organizationDouble.getDouble();
 	});
-	registerKeyword(std::regex("experience"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("experience", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleDouble experienceDouble(theStream);
 		experience = experienceDouble.getDouble();
 	});
-	registerKeyword(std::regex("pop"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("pop", [this](const std::string& unused, std::istream& theStream){
                 commonItems::simpleObject pop_def(theStream);
                 pop_id = pop_def.getValueAsInt("id");
 	});
 
-	registerKeyword(std::regex("[A-Za-z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 
@@ -82,35 +82,35 @@ bool Vic2::Regiment::isMobilised() const
 Vic2::Army::Army(const std::string& type, std::istream& theStream):
 	navy(type == "navy")
 {
-	registerKeyword(std::regex("name"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("name", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString nameString(theStream);
 		name = Utils::convertWin1252ToUTF8(nameString.getString());
 	});
-	registerKeyword(std::regex("location"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("location", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt locationInt(theStream);
 		location = locationInt.getInt();
 	});
-	registerKeyword(std::regex("regiment"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("regiment", [this](const std::string& unused, std::istream& theStream){
 		Regiment* newRegiment = new Regiment(theStream);
 		regiments.push_back(newRegiment);
 	});
-	registerKeyword(std::regex("ship"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("ship", [this](const std::string& unused, std::istream& theStream){
 		Regiment* newShip = new Regiment(theStream);
 		regiments.push_back(newShip);
 	});
-	registerKeyword(std::regex("supplies"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("supplies", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleDouble suppliesDouble(theStream);
 		supplies = suppliesDouble.getDouble();
 	});
-	registerKeyword(std::regex("at_sea"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("at_sea", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt locationInt(theStream);
 		atSea = locationInt.getInt();
 	});
-	registerKeyword(std::regex("army"), [this](const std::string& type, std::istream& theStream){
+	registerKeyword("army", [this](const std::string& type, std::istream& theStream){
 		Army* transportedArmy = new Army(type, theStream);
 		transportedArmies.push_back(transportedArmy);
 	});
-	registerKeyword(std::regex("[A-Za-z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 
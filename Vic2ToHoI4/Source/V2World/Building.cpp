@@ -28,11 +28,11 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 Vic2::Building::Building(std::istream& theStream)
 {
-	registerKeyword(std::regex("level"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("level", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt levelInt(theStream);
 		level = levelInt.getInt();
 	});
-	registerKeyword(std::regex("[A-Za-z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
\ No newline at end of file
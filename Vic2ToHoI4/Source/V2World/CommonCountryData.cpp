@@ -31,11 +31,11 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 Vic2::commonCountryData::commonCountryData(const std::string& filename, const std::string& mod)
 {
-	registerKeyword(std::regex("color"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("color", [this](const std::string& unused, std::istream& theStream){
 		commonItems::intList colorInts(theStream);
 		theColor = ConverterColor::Color(ConverterColor::red(colorInts.getInts()[0]), ConverterColor::green(colorInts.getInts()[1]), ConverterColor::blue(colorInts.getInts()[2]));
 	});
-	registerKeyword(std::regex("unit\\_names"), [this](const std::string& unused, std::istream& theStream){
+	registerRegex("unit\\_names", [this](const std::string& unused, std::istream& theStream){
 		auto equals = getNextTokenWithoutMatching(theStream);
 		auto bracket = getNextTokenWithoutMatching(theStream);
 		auto token = getNextTokenWithoutMatching(theStream);
@@ -54,11 +54,11 @@ Vic2::commonCountryData::commonCountryData(const std::string& filename, const st
 			token = getNextTokenWithoutMatching(theStream);
 		}
 	});
-	registerKeyword(std::regex("party"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("party", [this](const std::string& unused, std::istream& theStream){
 		auto party = Party(theStream);
 		parties.emplace_back(party);
 	});
-	registerKeyword(std::regex("[A-Za-z0-9\\_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9\\_]+", commonItems::ignoreItem);
 
 	bool parsedFile = false;
 	if (mod != "")
@@ -35,57 +35,58 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "State.h"
 #include "ParserHelpers.h"
 #include <functional>
+#include <unordered_map>
 
 
 
 Vic2::Country::Country(const std::string& theTag, std::istream& theStream, const inventions& theInventions, const cultureGroups& theCultureGroups):
 	tag(theTag)
 {
-	registerKeyword(std::regex("capital"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("capital", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt capitalInt(theStream);
 		capital = capitalInt.getInt();
 	});
-	registerKeyword(std::regex("civilized"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("civilized", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString civilizedString(theStream);
 		if (civilizedString.getString() == "yes")
 		{
 			civilized = true;
 		}
 	});
-	registerKeyword(std::regex("revanchism"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("revanchism", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleDouble revanchismDouble(theStream);
 		revanchism = revanchismDouble.getDouble();
 	});
-	registerKeyword(std::regex("war_exhaustion"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("war_exhaustion", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleDouble warExhaustionDouble(theStream);
 		warExhaustion = warExhaustionDouble.getDouble();
 	});
-	registerKeyword(std::regex("badboy"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("badboy", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleDouble badboyDouble(theStream);
 		badboy = badboyDouble.getDouble();
 	});
-	registerKeyword(std::regex("prestige"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("prestige", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleDouble prestigeDouble(theStream);
 		prestige = prestigeDouble.getDouble();
 	});
-	registerKeyword(std::regex("government"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("government", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString governmentString(theStream);
 		government = governmentString.getString();
 	});
-	registerKeyword(std::regex("last_election"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("last_election", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString lastElectionString(theStream);
 		lastElection = date(lastElectionString.getString());
 	});
-	registerKeyword(std::regex("domain_region"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("domain_region", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString regionString(theStream);
 		domainName = regionString.getString();
 		domainAdjective = regionString.getString();
 	});
-	registerKeyword(std::regex("human"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("human", [this](const std::string& unused, std::istream& theStream){
 		commonItems::ignoreItem(unused, theStream);
 		human = true;
 	});
-	registerKeyword(std::regex("primary_culture"), [this, &theCultureGroups](const std::string& unused, std::istream& theStream){
+	registerKeyword("primary_culture", [this, &theCultureGroups](const std::string& unused, std::istream& theStream){
 		commonItems::singleString cultureString(theStream);
 		primaryCulture = cultureString.getString();
 		if (primaryCulture.substr(0,1) == "\"")
@@ -104,7 +105,7 @@ Vic2::Country::Country(const std::string& theTag, std::istream& theStream, const
 			primaryCultureGroup = "";
 		}
 	});
-	registerKeyword(std::regex("culture"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("culture", [this](const std::string& unused, std::istream& theStream){
 		commonItems::stringList cultureString(theStream);
 		for (auto culture: cultureString.getStrings())
 		{
@@ -115,7 +116,7 @@ Vic2::Country::Country(const std::string& theTag, std::istream& theStream, const
 			acceptedCultures.insert(culture);
 		}
 	});
-	registerKeyword(std::regex("technology"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("technology", [this](const std::string& unused, std::istream& theStream){
 		auto equals = getNextTokenWithoutMatching(theStream);
 		auto openBrace = getNextTokenWithoutMatching(theStream);
 		auto token = getNextTokenWithoutMatching(theStream);
@@ -126,7 +127,7 @@ Vic2::Country::Country(const std::string& theTag, std::istream& theStream, const
 			token = getNextTokenWithoutMatching(theStream);
 		}
 	});
-	registerKeyword(std::regex("active_inventions"), [this, &theInventions](const std::string& unused, std::istream& theStream){
+	registerKeyword("active_inventions", [this, &theInventions](const std::string& unused, std::istream& theStream){
 		commonItems::intList inventionNums(theStream);
 		for (auto inventionNum: inventionNums.getInts())
 		{
@@ -137,7 +138,7 @@ Vic2::Country::Country(const std::string& theTag, std::istream& theStream, const
 			}
 		}
 	});
-	registerKeyword(std::regex("active_party"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("active_party", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt partyNum(theStream);
 		activePartyIDs.push_back(partyNum.getInt());
 		if (rulingPartyID == 0)
@@ -145,11 +146,11 @@ Vic2::Country::Country(const std::string& theTag, std::istream& theStream, const
 			rulingPartyID = partyNum.getInt();
 		}
 	});
-	registerKeyword(std::regex("ruling_party"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("ruling_party", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt partyNum(theStream);
 		rulingPartyID = partyNum.getInt();
 	});
-	registerKeyword(std::regex("upper_house"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("upper_house", [this](const std::string& unused, std::istream& theStream){
 		auto equals = getNextTokenWithoutMatching(theStream);
 		auto openBrace = getNextTokenWithoutMatching(theStream);
 		auto token = getNextTokenWithoutMatching(theStream);
@@ -160,22 +161,22 @@ Vic2::Country::Country(const std::string& theTag, std::istream& theStream, const
 			token = getNextTokenWithoutMatching(theStream);
 		}
 	});
-	registerKeyword(std::regex("[A-Z]{3}"), [this](const std::string& countryTag, std::istream& theStream)
+	registerRegex("[A-Z]{3}", [this](const std::string& countryTag, std::istream& theStream)
 	{
 		Relations* rel = new Relations(countryTag, theStream);
 		relations.insert(make_pair(rel->getTag(), rel));
 	});
-	registerKeyword(std::regex("[A-Z][0-9]{2}"), [this](const std::string& countryTag, std::istream& theStream)
+	registerRegex("[A-Z][0-9]{2}", [this](const std::string& countryTag, std::istream& theStream)
 	{
 		Relations* rel = new Relations(countryTag, theStream);
 		relations.insert(make_pair(rel->getTag(), rel));
 	});
-	registerKeyword(std::regex("army"), [this](const std::string& type, std::istream& theStream)
+	registerKeyword("army", [this](const std::string& type, std::istream& theStream)
 	{
 		Army* army = new Army(type, theStream);
 		armies.push_back(army);
 	});
-	registerKeyword(std::regex("navy"), [this](const std::string& type, std::istream& theStream)
+	registerKeyword("navy", [this](const std::string& type, std::istream& theStream)
 	{
 		Army* navy = new Army(type, theStream);
 		armies.push_back(navy);
@@ -185,17 +186,17 @@ Vic2::Country::Country(const std::string& theTag, std::istream& theStream, const
 			armies.push_back(transportedArmy);
 		}
 	});
-	registerKeyword(std::regex("leader"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("leader", [this](const std::string& unused, std::istream& theStream)
 	{
 		Leader* leader = new Leader(theStream);
 		leaders.push_back(leader);
 	});
-	registerKeyword(std::regex("state"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("state", [this](const std::string& unused, std::istream& theStream)
 	{
 		State* newState = new State(theStream, tag);
 		states.push_back(newState);
 	});
-	registerKeyword(std::regex("[A-Za-z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
@@ -269,13 +270,9 @@ void Vic2::Country::determineEmployedWorkers()
 }
 
 
-void Vic2::Country::setLocalisationNames()
+void Vic2::Country::setLocalisationNames(const V2Localisations& theVic2Localisations)
 {
-	if (domainName != "")
-	{
-		V2Localisations::UpdateDomainCountry(tag, domainName);
-	}
-	auto nameInAllLanguages = V2Localisations::GetTextInEachLanguage(tag);
+	auto nameInAllLanguages = theVic2Localisations.GetTextInEachLanguage(tag);
 	for (auto nameInLanguage : nameInAllLanguages)
 	{
 		setLocalisationName(nameInLanguage.first, nameInLanguage.second);
@@ -296,9 +293,9 @@ void Vic2::Country::setLocalisationName(const string& language, const string& na
 }
 
 
-void Vic2::Country::setLocalisationAdjectives()
+void Vic2::Country::setLocalisationAdjectives(const V2Localisations& theVic2Localisations)
 {
-	auto adjectiveInAllLanguages = V2Localisations::GetTextInEachLanguage(tag + "_ADJ");
+	auto adjectiveInAllLanguages = theVic2Localisations.GetTextInEachLanguage(tag + "_ADJ");
 	for (auto adjectiveinLanguage : adjectiveInAllLanguages)
 	{
 		setLocalisationAdjective(adjectiveinLanguage.first, adjectiveinLanguage.second);
@@ -327,23 +324,21 @@ void Vic2::Country::handleMissingCulture(const cultureGroups& theCultureGroups)
 
 map<string, int> Vic2::Country::determineCultureSizes()
 {
-	map<string, int> cultureSizes;
-
+	unordered_map<commonItems::symbol, int> cultureSymbolSizes;
 	for (auto province: provinces)
 	{
 		for (auto pop: province.second->getPops())
 		{
-			string popCulture = pop->getCulture();
-			auto cultureSize = cultureSizes.find(popCulture);
-			if (cultureSize == cultureSizes.end())
-			{
-				cultureSizes.insert(make_pair(popCulture, 0));
-				cultureSize = cultureSizes.find(popCulture);
-			}
-			cultureSize->second += pop->getSize();
+			cultureSymbolSizes[pop->getCultureSymbol()] += pop->getSize();
 		}
 	}
 
+	map<string, int> cultureSizes;
+	for (const auto& [culture, size]: cultureSymbolSizes)
+	{
+		cultureSizes.insert(make_pair(culture.str(), size));
+	}
+
 	return cultureSizes;
 }
 
@@ -520,6 +515,7 @@ double Vic2::Country::getAverageMilitancy() const
 
 float Vic2::Country::getAverageIssueSupport(const std::string& issueName) const
 {
+	const commonItems::symbol issue(issueName);
 	int totalPopulation = 0;
 	float totalSupport = 0.0;
 	for (auto province: provinces)
@@ -528,7 +524,7 @@ float Vic2::Country::getAverageIssueSupport(const std::string& issueName) const
 		for (auto pop: pops)
 		{
 			int size = pop->getSize();
-			totalSupport += pop->getIssue(issueName) * size;
+			totalSupport += pop->getIssue(issue) * size;
 			totalPopulation += size;
 		}
 	}
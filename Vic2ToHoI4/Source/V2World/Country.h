@@ -40,6 +40,10 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
+class V2Localisations;
+
+
+
 namespace Vic2
 {
 
@@ -67,8 +71,8 @@ class Country: commonItems::parser
 		void eatCountry(Country* target);
 		void putProvincesInStates();
 		void determineEmployedWorkers();
-		void setLocalisationNames();
-		void setLocalisationAdjectives();
+		void setLocalisationNames(const V2Localisations& theVic2Localisations);
+		void setLocalisationAdjectives(const V2Localisations& theVic2Localisations);
 		void handleMissingCulture(const cultureGroups& theCultureGroups);
 
 		std::map<std::string, const Relations*> getRelations() const { return relations; }
@@ -81,6 +85,7 @@ class Country: commonItems::parser
 		bool isAnAcceptedCulture(const std::string& culture) const { return (acceptedCultures.count(culture) > 0); }
 		std::set<std::string> getInventions() const { return discoveredInventions; }
 		std::string getGovernment() const { return government; }
+		const std::string& getDomainName() const { return domainName; }
 		date getLastElection() const { return lastElection; }
 		int getCapital() const { return capital; }
 		std::set<std::string> getTechs() const { return techs; }
@@ -30,27 +30,27 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 Vic2::Diplomacy::Diplomacy(std::istream& theStream)
 {
-	registerKeyword(std::regex("vassal"), [this](const std::string& agreementType, std::istream& theStream)
+	registerKeyword("vassal", [this](const std::string& agreementType, std::istream& theStream)
 	{
 		Agreement* agreement = new Agreement(agreementType, theStream);
 		agreements.push_back(agreement);
 	});
-	registerKeyword(std::regex("alliance"), [this](const std::string& agreementType, std::istream& theStream)
+	registerKeyword("alliance", [this](const std::string& agreementType, std::istream& theStream)
 	{
 		Agreement* agreement = new Agreement(agreementType, theStream);
 		agreements.push_back(agreement);
 	});
-	registerKeyword(std::regex("casus_belli"), [this](const std::string& agreementType, std::istream& theStream)
+	registerKeyword("casus_belli", [this](const std::string& agreementType, std::istream& theStream)
 	{
 		Agreement* agreement = new Agreement(agreementType, theStream);
 		agreements.push_back(agreement);
 	});
-	registerKeyword(std::regex("warsubsidy"), [this](const std::string& agreementType, std::istream& theStream)
+	registerKeyword("warsubsidy", [this](const std::string& agreementType, std::istream& theStream)
 	{
 		Agreement* agreement = new Agreement(agreementType, theStream);
 		agreements.push_back(agreement);
 	});
-	registerKeyword(std::regex("[A-Za-z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
\ No newline at end of file
@@ -64,7 +64,7 @@ void Vic2::inventions::generateNums(const std::string& path)
 
 void Vic2::inventions::processTechFile(const std::string& filename)
 {
-	registerKeyword(std::regex("[a-zA-Z0-9_\\.\\\\\\\\\\:]+"), [this](const std::string& inventionName, std::istream& theStream){
+	registerRegex("[a-zA-Z0-9_\\.\\\\\\\\\\:]+", [this](const std::string& inventionName, std::istream& theStream){
 		inventionNumsToNames.insert(make_pair(inventionNumsToNames.size() + 1, inventionName));
 		commonItems::ignoreItem(inventionName, theStream);
 	});
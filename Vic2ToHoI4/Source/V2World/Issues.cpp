@@ -60,24 +60,24 @@ void Vic2::issues::instantiate()
 {
 	int issueNum = 1;
 
-	registerKeyword(std::regex("party_issues"), [this, &issueNum](const std::string& category, std::istream& theStream)
+	registerKeyword("party_issues", [this, &issueNum](const std::string& category, std::istream& theStream)
 	{
 		partiesIssueHelper helperHelper(theStream);
 		for (auto helper: helperHelper.getIssues())
 		{
 			for (auto name: helper.getIssues())
 			{
-				issueNames.insert(make_pair(issueNum, name));
+				issueNames.insert(std::make_pair(issueNum, commonItems::symbol(name)));
 				issueNum++;
 			}
 		}
 	});
-	registerKeyword(std::regex("[A-Za-z_]+"), [this, &issueNum](const std::string& category, std::istream& theStream)
+	registerRegex("[A-Za-z_]+", [this, &issueNum](const std::string& category, std::istream& theStream)
 	{
 		issueHelper helper(theStream);
 		for (auto name: helper.getIssues())
 		{
-			issueNames.insert(make_pair(issueNum, name));
+			issueNames.insert(std::make_pair(issueNum, commonItems::symbol(name)));
 			issueNum++;
 		}
 	});
@@ -87,6 +87,12 @@ void Vic2::issues::instantiate()
 
 
 std::string Vic2::issues::getIssueName(int num) const
+{
+	return getIssueSymbol(num).str();
+}
+
+
+commonItems::symbol Vic2::issues::getIssueSymbol(int num) const
 {
 	auto name = issueNames.find(num);
 	if (name != issueNames.end())
@@ -95,14 +101,14 @@ std::string Vic2::issues::getIssueName(int num) const
 	}
 	else
 	{
-		return "";
+		return {};
 	}
 }
 
 
 issueHelper::issueHelper(std::istream& theStream)
 {
-	registerKeyword(std::regex("[A-Za-z_]+"), [this](const std::string& theIssue, std::istream& theStream)
+	registerRegex("[A-Za-z_]+", [this](const std::string& theIssue, std::istream& theStream)
 	{
 		issues.push_back(theIssue);
 		commonItems::ignoreObject(theIssue, theStream);
@@ -114,7 +120,7 @@ issueHelper::issueHelper(std::istream& theStream)
 
 partiesIssueHelper::partiesIssueHelper(std::istream& theStream)
 {
-	registerKeyword(std::regex("[A-Za-z_]+"), [this](const std::string& theIssue, std::istream& theStream)
+	registerRegex("[A-Za-z_]+", [this](const std::string& theIssue, std::istream& theStream)
 	{
 		issueHelper helper(theStream);
 		issues.push_back(helper);
@@ -26,6 +26,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 #include "newParser.h"
+#include "Symbol.h"
 #include <map>
 #include <memory>
 #include <string>
@@ -39,9 +40,10 @@ namespace Vic2
 		public:
 			void instantiate();
 			std::string getIssueName(int num) const;
+			commonItems::symbol getIssueSymbol(int num) const;
 
 		private:
-			std::map<int, std::string> issueNames;
+			std::map<int, commonItems::symbol> issueNames;
 	};
 
 	extern issues issuesInstance;
@@ -28,7 +28,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 Vic2::Leader::Leader(std::istream& theStream)
 {
-	registerKeyword(std::regex("name"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("name", [this](const std::string& unused, std::istream& theStream)
 	{
 		commonItems::singleString nameString(theStream);
 		name = nameString.getString();
@@ -37,7 +37,7 @@ Vic2::Leader::Leader(std::istream& theStream)
 			name	= name.substr(1, name.length() - 2);
 		}
 	});
-	registerKeyword(std::regex("type"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("type", [this](const std::string& unused, std::istream& theStream)
 	{
 		commonItems::singleString typeString(theStream);
 		type = typeString.getString();
@@ -46,7 +46,7 @@ Vic2::Leader::Leader(std::istream& theStream)
 			type	= type.substr(1, type.length() - 2);
 		}
 	});
-	registerKeyword(std::regex("personality"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("personality", [this](const std::string& unused, std::istream& theStream)
 	{
 		commonItems::singleString personalityString(theStream);
 		personality = personalityString.getString();
@@ -55,7 +55,7 @@ Vic2::Leader::Leader(std::istream& theStream)
 			personality	= personality.substr(1, personality.length() - 2);
 		}
 	});
-	registerKeyword(std::regex("background"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("background", [this](const std::string& unused, std::istream& theStream)
 	{
 		commonItems::singleString backgroundString(theStream);
 		background = backgroundString.getString();
@@ -64,12 +64,12 @@ Vic2::Leader::Leader(std::istream& theStream)
 			background	= background.substr(1, background.length() - 2);
 		}
 	});
-	registerKeyword(std::regex("prestige"), [this](const std::string& unused, std::istream& theStream)
+	registerKeyword("prestige", [this](const std::string& unused, std::istream& theStream)
 	{
 		commonItems::singleDouble prestigeString(theStream);
 		prestige = prestigeString.getDouble();
 	});
-	registerKeyword(std::regex("[A-Za-z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
\ No newline at end of file
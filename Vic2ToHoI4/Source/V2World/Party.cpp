@@ -28,35 +28,35 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 Vic2::Party::Party(std::istream& theStream)
 {
-	registerKeyword(std::regex("name"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("name", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString nameString(theStream);
 		name = nameString.getString();
 	});
-	registerKeyword(std::regex("ideology"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("ideology", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString ideologyString(theStream);
 		ideology = ideologyString.getString();
 	});
-	registerKeyword(std::regex("economic_policy"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("economic_policy", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString policyString(theStream);
 		economic_policy = policyString.getString();
 	});
-	registerKeyword(std::regex("trade_policy"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("trade_policy", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString policyString(theStream);
 		trade_policy = policyString.getString();
 	});
-	registerKeyword(std::regex("religious_policy"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("religious_policy", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString policyString(theStream);
 		religious_policy = policyString.getString();
 	});
-	registerKeyword(std::regex("citizenship_policy"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("citizenship_policy", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString policyString(theStream);
 		citizenship_policy = policyString.getString();
 	});
-	registerKeyword(std::regex("war_policy"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("war_policy", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString policyString(theStream);
 		warPolicy = policyString.getString();
 	});
-	registerKeyword(std::regex("[A-Za-z0-9\\_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9\\_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
@@ -25,85 +25,175 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "Log.h"
 #include "ParserHelpers.h"
 #include "Issues.h"
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
 
 std::map<int, Vic2::Pop*> Vic2::Pop::pop_map;
+std::mutex Vic2::Pop::popMapMutex;
+
+// Pops are most of a save, so they are read as a flat stream of events rather than through a parser
+class Vic2::Pop::reader: public commonItems::scriptEventHandler
+{
+	public:
+		explicit reader(Pop& pop): pop(pop) {}
+
+		void onKey(std::string_view key, int depth);
+		void onScalar(std::string_view value, int depth);
+		void onBeginBlock(int depth);
+		void onEndBlock(int depth);
+
+	private:
+		enum class field { size, literacy, consciousness, militancy, issues, id, religion, other };
+
+		static field identifyField(std::string_view key);
+
+		Pop& pop;
+		field currentField = field::other;
+		bool inIssues = false;
+		int currentIssue = 0;
+};
+
 
 Vic2::Pop::Pop(const std::string& typeString, std::istream& theStream):
 	type(typeString)
 {
-	registerKeyword(std::regex("size"), [this](const std::string& unused, std::istream& theStream)
+	reader popReader(*this);
+	commonItems::parseItemEvents(theStream, popReader);
+	if (culture.empty())
 	{
-		commonItems::singleInt sizeInt(theStream);
-		size = sizeInt.getInt();
-	});
-	registerKeyword(std::regex("literacy"), [this](const std::string& unused, std::istream& theStream)
+		culture = commonItems::symbol("no_culture");
+	}
+
+	std::lock_guard<std::mutex> popMapLock(popMapMutex); // provinces, and so pops, are parsed in parallel
+	pop_map[id] = this;
+}
+
+
+Vic2::Pop::reader::field Vic2::Pop::reader::identifyField(std::string_view key)
+{
+	static const std::unordered_map<std::string_view, field> fields = {
+		{ "size", field::size },
+		{ "literacy", field::literacy },
+		{ "con", field::consciousness },
+		{ "mil", field::militancy },
+		{ "issues", field::issues },
+		{ "id", field::id }
+	};
+
+	if (auto theField = fields.find(key); theField != fields.end())
 	{
-		commonItems::singleDouble sizeInt(theStream);
-		literacy = sizeInt.getDouble();
-	});
-	registerKeyword(std::regex("con"), [this](const std::string& unused, std::istream& theStream)
+		return theField->second;
+	}
+	return field::other;
+}
+
+
+void Vic2::Pop::reader::onKey(std::string_view key, int depth)
+{
+	if (depth == 2 && inIssues)
 	{
-		commonItems::singleDouble sizeInt(theStream);
-		consciousness = sizeInt.getDouble();
-	});
-	registerKeyword(std::regex("mil"), [this](const std::string& unused, std::istream& theStream)
+		currentIssue = commonItems::readInt(key);
+		return;
+	}
+	if (depth != 1)
 	{
-		commonItems::singleDouble sizeInt(theStream);
-		militancy = sizeInt.getDouble();
-	});
-	registerKeyword(std::regex("issues"), [this](const std::string& unused, std::istream& theStream)
+		return;
+	}
+
+	currentField = identifyField(key);
+	if (currentField != field::other)
 	{
-		auto equals = getNextTokenWithoutMatching(theStream);
-		auto openBrace = getNextTokenWithoutMatching(theStream);
+		return;
+	}
 
-		auto possibleIssue = getNextTokenWithoutMatching(theStream);
-		while (possibleIssue != "}")
-		{
-			auto equals = getNextTokenWithoutMatching(theStream);
-			auto issueSupport = getNextTokenWithoutMatching(theStream);
+	// the first other lower case key is the culture, assigned the religion
+	bool isLowerCase = std::all_of(key.begin(), key.end(), [](char character)
+	{
+		return ((character >= 'a') && (character <= 'z')) || (character == '_');
+	});
+	if (isLowerCase && !key.empty() && pop.culture.empty())
+	{
+		pop.culture = commonItems::symbol(key);
+		currentField = field::religion;
+	}
+}
 
-			std::string issueName = issuesInstance.getIssueName(std::stoi(*possibleIssue));
-			popIssues.insert(std::make_pair(issueName, std::stof(*issueSupport)));
 
-			possibleIssue = getNextTokenWithoutMatching(theStream);
-		}
-	});
-	registerKeyword(std::regex("id"), [this](const std::string& unused, std::istream& theStream)
+void Vic2::Pop::reader::onScalar(std::string_view value, int depth)
+{
+	if (depth == 2 && inIssues)
 	{
-		commonItems::singleInt idInt(theStream);
-		id = idInt.getInt();
-	});
-	registerKeyword(std::regex("[a-z\\_]+"), [this](const std::string& cultureString, std::istream& theStream)
+		pop.popIssues.emplace_back(issuesInstance.getIssueSymbol(currentIssue), static_cast<float>(commonItems::readDouble(value)));
+		return;
+	}
+	if (depth != 1)
 	{
-		if (culture == "no_culture")
-		{
-			culture = cultureString;
-			commonItems::singleString religionString(theStream);
-			religion = religionString.getString();
-		}
-		else
-		{
-			commonItems::ignoreItem(cultureString, theStream);
-		}
-	});
-	registerKeyword(std::regex("[A-Za-z0-9\\_]+"), commonItems::ignoreItem);
+		return;
+	}
 
-	parseStream(theStream);
-        pop_map[id] = this;
+	switch (currentField)
+	{
+		case field::size:
+			pop.size = commonItems::readInt(value);
+			break;
+		case field::literacy:
+			pop.literacy = commonItems::readDouble(value);
+			break;
+		case field::consciousness:
+			pop.consciousness = commonItems::readDouble(value);
+			break;
+		case field::militancy:
+			pop.militancy = commonItems::readDouble(value);
+			break;
+		case field::id:
+			pop.id = commonItems::readInt(value);
+			break;
+		case field::religion:
+			pop.religion = commonItems::symbol(commonItems::unquote(value));
+			break;
+		default:
+			break;
+	}
 }
 
 
-float Vic2::Pop::getIssue(const std::string& issueName) const
+void Vic2::Pop::reader::onBeginBlock(int depth)
 {
-	auto issue = popIssues.find(issueName);
-	if (issue != popIssues.end())
+	if (depth == 2)
 	{
-		return issue->second;
+		inIssues = (currentField == field::issues);
 	}
-	else
+}
+
+
+void Vic2::Pop::reader::onEndBlock(int depth)
+{
+	if (depth == 2)
 	{
-		return 0.0f;
+		inIssues = false;
 	}
 }
 
-Vic2::Pop* Vic2::Pop::getByID(int idx) { return pop_map[idx]; }
+
+float Vic2::Pop::getIssue(commonItems::symbol issueName) const
+{
+	for (const auto& [issue, support]: popIssues)
+	{
+		if (issue == issueName)
+		{
+			return support;
+		}
+	}
+	return 0.0f;
+}
+
+Vic2::Pop* Vic2::Pop::getByID(int idx)
+{
+	std::lock_guard<std::mutex> popMapLock(popMapMutex);
+	if (auto pop = pop_map.find(idx); pop != pop_map.end())
+	{
+		return pop->second;
+	}
+	return nullptr;
+}
@@ -27,15 +27,19 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 #include "newParser.h"
+#include "Symbol.h"
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 
 
 namespace Vic2
 {
-	class Pop: commonItems::parser
+	class Pop
 	{
 		public:
 			explicit Pop(const std::string& typeString, std::istream& theStream);
@@ -43,30 +47,34 @@ namespace Vic2
 			static Pop* getByID(const int idx);
 
 			int getSize() const { return size; }
-			std::string getType() const { return type; }
-			std::string getCulture() const { return culture; }
+			const std::string& getType() const { return type.str(); }
+			commonItems::symbol getTypeSymbol() const { return type; }
+			const std::string& getCulture() const { return culture.str(); }
+			commonItems::symbol getCultureSymbol() const { return culture; }
 			double getLiteracy() const { return literacy; }
 			double getMilitancy() const { return militancy; }
-			std::map<std::string, float> getIssues() const { return popIssues; }
 
-			float getIssue(const std::string& issueName) const;
+			float getIssue(commonItems::symbol issueName) const;
 			int getID() const {return id;}
 
 		private:
 			Pop(const Pop&) = delete;
 			Pop& operator=(const Pop&) = delete;
 
+			class reader;
+
 			int size = 0;
-			std::string type = "";
-			std::string culture = "no_culture";
-			std::string religion = "";
+			commonItems::symbol type;
+			commonItems::symbol culture;	// empty until the culture = religion entry is read
+			commonItems::symbol religion;
 			double literacy = 0.0;
 			double consciousness = 0.0;
 			double militancy = 0.0;
                         int id = 0;
-			std::map<std::string, float> popIssues;
+			std::vector<std::pair<commonItems::symbol, float>> popIssues;	// in the order of the save, which is short
 
 			static std::map<int, Pop*> pop_map;
+			static std::mutex popMapMutex;
         };
 }
 
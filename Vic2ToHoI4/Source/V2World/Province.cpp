@@ -23,6 +23,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 #include "Province.h"
 #include "Pop.h"
+#include "World.h"
 #include "Log.h"
 #include "ParserHelpers.h"
 #include <memory>
@@ -32,154 +33,113 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 Vic2::Province::Province(const std::string& numberString, std::istream& theStream):
 	number(stoi(numberString))
 {
-	registerKeyword(std::regex("owner"), [this](const std::string& unused, std::istream& theStream)
+	getSchema().parseStream(*this, theStream);
+        identifier = name + " (" + std::to_string(number) + ")";
+}
+
+
+const commonItems::parserSchema<Vic2::Province>& Vic2::Province::getSchema()
+{
+	static const auto theSchema = []()
 	{
-		commonItems::singleString ownerSingleString(theStream);
-		ownerString = ownerSingleString.getString();
-		if (ownerString.substr(0,1) == "\"")
+		commonItems::parserSchema<Province> schema;
+		schema.registerKeyword("owner", [](Province& province, const std::string& unused, std::istream& theStream)
 		{
-			ownerString = ownerString.substr(1, ownerString.size() - 2);
-		}
-	});
-	registerKeyword(std::regex("core"), [this](const std::string& unused, std::istream& theStream)
-	{
-		commonItems::singleString coreString(theStream);
-		auto newCoreString = coreString.getString();
-		if (newCoreString.substr(0,1) == "\"")
+			commonItems::singleString ownerSingleString(theStream);
+			province.ownerString = ownerSingleString.getString();
+			if (province.ownerString.substr(0,1) == "\"")
+			{
+				province.ownerString = province.ownerString.substr(1, province.ownerString.size() - 2);
+			}
+		});
+		schema.registerKeyword("core", [](Province& province, const std::string& unused, std::istream& theStream)
 		{
-			newCoreString = newCoreString.substr(1, newCoreString.size() - 2);
-		}
-		coreStrings.insert(newCoreString);
-	});
-	registerKeyword(std::regex("fort"), [this](const std::string& unused, std::istream& theStream)
-	{
-		commonItems::doubleList fortSizeList(theStream);
-		fortLevel = static_cast<int>(fortSizeList.getDoubles()[0]);
-	});
-	registerKeyword(std::regex("naval_base"), [this](const std::string& unused, std::istream& theStream)
-	{
-		commonItems::doubleList navalBaseSizeList(theStream);
-		navalBaseLevel = static_cast<int>(navalBaseSizeList.getDoubles()[0]);
-	});
-	registerKeyword(std::regex("railroad"), [this](const std::string& unused, std::istream& theStream)
-	{
-		commonItems::doubleList railSizeList(theStream);
-		railLevel = static_cast<int>(railSizeList.getDoubles()[0]);
-	});
-	registerKeyword(std::regex("aristocrats"), [this](const std::string& popType, std::istream& theStream)
-	{
-		std::shared_ptr<Pop> pop = std::make_shared<Pop>(popType, theStream);
-		pops.push_back(pop);
-	});
-	registerKeyword(std::regex("artisans"), [this](const std::string& popType, std::istream& theStream)
-	{
-		std::shared_ptr<Pop> pop = std::make_shared<Pop>(popType, theStream);
-		pops.push_back(pop);
-	});
-	registerKeyword(std::regex("bureaucrats"), [this](const std::string& popType, std::istream& theStream)
-	{
-		std::shared_ptr<Pop> pop = std::make_shared<Pop>(popType, theStream);
-		pops.push_back(pop);
-	});
-	registerKeyword(std::regex("capitalists"), [this](const std::string& popType, std::istream& theStream)
-	{
-		std::shared_ptr<Pop> pop = std::make_shared<Pop>(popType, theStream);
-		pops.push_back(pop);
-	});
-	registerKeyword(std::regex("clergymen"), [this](const std::string& popType, std::istream& theStream)
-	{
-		std::shared_ptr<Pop> pop = std::make_shared<Pop>(popType, theStream);
-		pops.push_back(pop);
-	});
-	registerKeyword(std::regex("craftsmen"), [this](const std::string& popType, std::istream& theStream)
-	{
-		std::shared_ptr<Pop> pop = std::make_shared<Pop>(popType, theStream);
-		pops.push_back(pop);
-	});
-	registerKeyword(std::regex("clerks"), [this](const std::string& popType, std::istream& theStream)
-	{
-		std::shared_ptr<Pop> pop = std::make_shared<Pop>(popType, theStream);
-		pops.push_back(pop);
-	});
-	registerKeyword(std::regex("farmers"), [this](const std::string& popType, std::istream& theStream)
-	{
-		std::shared_ptr<Pop> pop = std::make_shared<Pop>(popType, theStream);
-		pops.push_back(pop);
-	});
-	registerKeyword(std::regex("soldiers"), [this](const std::string& popType, std::istream& theStream)
-	{
-		std::shared_ptr<Pop> pop = std::make_shared<Pop>(popType, theStream);
-		pops.push_back(pop);
-	});
-	registerKeyword(std::regex("officers"), [this](const std::string& popType, std::istream& theStream)
-	{
-		std::shared_ptr<Pop> pop = std::make_shared<Pop>(popType, theStream);
-		pops.push_back(pop);
-	});
-	registerKeyword(std::regex("labourers"), [this](const std::string& popType, std::istream& theStream)
-	{
-		std::shared_ptr<Pop> pop = std::make_shared<Pop>(popType, theStream);
-		pops.push_back(pop);
-	});
-	registerKeyword(std::regex("slaves"), [this](const std::string& popType, std::istream& theStream)
-	{
-		std::shared_ptr<Pop> pop = std::make_shared<Pop>(popType, theStream);
-		pops.push_back(pop);
-	});
-	registerKeyword(std::regex("serfs"), [this](const std::string& popType, std::istream& theStream)
-	{
-		std::shared_ptr<Pop> pop = std::make_shared<Pop>(popType, theStream);
-		pops.push_back(pop);
-	});	
-	registerKeyword(std::regex("goods_type"),  [this](const std::string& unused, std::istream& theStream)
-	{
-		commonItems::singleString rgoString(theStream);
-		rgo = rgoString.getString();
-		if (rgo.substr(0, 1) == "\"")
+			commonItems::singleString coreString(theStream);
+			auto newCoreString = coreString.getString();
+			if (newCoreString.substr(0,1) == "\"")
+			{
+				newCoreString = newCoreString.substr(1, newCoreString.size() - 2);
+			}
+			province.coreStrings.insert(newCoreString);
+		});
+		schema.registerKeyword("fort", [](Province& province, const std::string& unused, std::istream& theStream)
+		{
+			commonItems::doubleList fortSizeList(theStream);
+			province.fortLevel = static_cast<int>(fortSizeList.getDoubles()[0]);
+		});
+		schema.registerKeyword("naval_base", [](Province& province, const std::string& unused, std::istream& theStream)
+		{
+			commonItems::doubleList navalBaseSizeList(theStream);
+			province.navalBaseLevel = static_cast<int>(navalBaseSizeList.getDoubles()[0]);
+		});
+		schema.registerKeyword("railroad", [](Province& province, const std::string& unused, std::istream& theStream)
+		{
+			commonItems::doubleList railSizeList(theStream);
+			province.railLevel = static_cast<int>(railSizeList.getDoubles()[0]);
+		});
+		auto addPop = [](Province& province, const std::string& popType, std::istream& theStream)
 		{
-			rgo = rgo.substr(1, rgo.size() - 2);
+			std::shared_ptr<Pop> pop = std::make_shared<Pop>(popType, theStream);
+			province.pops.push_back(pop);
+		};
+		for (auto popType: {
+			"aristocrats", "artisans", "bureaucrats", "capitalists", "clergymen", "craftsmen", "clerks",
+			"farmers", "soldiers", "officers", "labourers", "slaves", "serfs"
+		})
+		{
+			schema.registerKeyword(popType, addPop);
 		}
-	});
-        registerKeyword(std::regex("name"),  [this](const std::string& unused, std::istream& theStream)
-	{
-		commonItems::singleString nameString(theStream);
-		name = nameString.getString();
-		if (name.substr(0, 1) == "\"")
+		schema.registerKeyword("goods_type",  [](Province& province, const std::string& unused, std::istream& theStream)
 		{
-                        name = name.substr(1, name.size() - 2);
-                }
-	});
-
-	// ignored items
-	registerKeyword(std::regex("controller"), commonItems::ignoreItem);
-	registerKeyword(std::regex("garrison"), commonItems::ignoreItem);
-	registerKeyword(std::regex("building_construction"), commonItems::ignoreItem);
-	registerKeyword(std::regex("life_rating"), commonItems::ignoreItem);
-	registerKeyword(std::regex("infrastructure"), commonItems::ignoreItem);
-	registerKeyword(std::regex("last_imigration"), commonItems::ignoreItem);
-	registerKeyword(std::regex("last_controller_change"), commonItems::ignoreItem);
-	registerKeyword(std::regex("unit_names"), commonItems::ignoreItem);
-	registerKeyword(std::regex("party_loyalty"), commonItems::ignoreItem);
-	registerKeyword(std::regex("modifier"), commonItems::ignoreItem);
-	registerKeyword(std::regex("military_construction"), commonItems::ignoreItem);
-	registerKeyword(std::regex("crime"), commonItems::ignoreItem);
-	registerKeyword(std::regex("nationalism"), commonItems::ignoreItem);
-	registerKeyword(std::regex("colonial"), commonItems::ignoreItem);
-	registerKeyword(std::regex("flags"), commonItems::ignoreItem);
-	registerKeyword(std::regex("rgo"), commonItems::ignoreItem);
-
-	parseStream(theStream);
-        identifier = name + " (" + std::to_string(number) + ")";
+			commonItems::singleString rgoString(theStream);
+			province.rgo = rgoString.getString();
+			if (province.rgo.substr(0, 1) == "\"")
+			{
+				province.rgo = province.rgo.substr(1, province.rgo.size() - 2);
+			}
+		});
+		schema.registerKeyword("name", [](Province& province, const std::string& unused, std::istream& theStream)
+		{
+			commonItems::singleString nameString(theStream);
+			province.name = nameString.getString();
+			if (province.name.substr(0, 1) == "\"")
+			{
+				province.name = province.name.substr(1, province.name.size() - 2);
+			}
+		});
+
+		// ignored items
+		schema.registerKeyword("controller", commonItems::ignoreItem);
+		schema.registerKeyword("garrison", commonItems::ignoreItem);
+		schema.registerKeyword("building_construction", commonItems::ignoreItem);
+		schema.registerKeyword("life_rating", commonItems::ignoreItem);
+		schema.registerKeyword("infrastructure", commonItems::ignoreItem);
+		schema.registerKeyword("last_imigration", commonItems::ignoreItem);
+		schema.registerKeyword("last_controller_change", commonItems::ignoreItem);
+		schema.registerKeyword("unit_names", commonItems::ignoreItem);
+		schema.registerKeyword("party_loyalty", commonItems::ignoreItem);
+		schema.registerKeyword("modifier", commonItems::ignoreItem);
+		schema.registerKeyword("military_construction", commonItems::ignoreItem);
+		schema.registerKeyword("crime", commonItems::ignoreItem);
+		schema.registerKeyword("nationalism", commonItems::ignoreItem);
+		schema.registerKeyword("colonial", commonItems::ignoreItem);
+		schema.registerKeyword("flags", commonItems::ignoreItem);
+		schema.registerKeyword("rgo", commonItems::ignoreItem);
+
+		return schema;
+	}();
+
+	return theSchema;
 }
 
 
-void Vic2::Province::setCores(const std::map<std::string, Vic2::Country*>& countries)
+void Vic2::Province::setCores(const World& theWorld)
 {
 	for (auto coreString: coreStrings)
 	{
-		if (auto countryItr = countries.find(coreString); countryItr != countries.end())
+		if (auto country = theWorld.getCountry(coreString); country)
 		{
-			cores.insert(countryItr->second);
+			cores.insert(*country);
 		}
 		else
 		{
@@ -195,12 +155,12 @@ int Vic2::Province::getTotalPopulation() const
 }
 
 
-int Vic2::Province::getPopulation(std::optional<std::string> type) const
+int Vic2::Province::getPopulation(std::optional<commonItems::symbol> type) const
 {
 	int totalPopulation = 0;
 	for (auto pop: pops)
 	{
-		if (!type || *type == pop->getType())
+		if (!type || (*type == pop->getTypeSymbol()))
 		{
 			totalPopulation += pop->getSize();
 		}
@@ -210,12 +170,12 @@ int Vic2::Province::getPopulation(std::optional<std::string> type) const
 }
 
 
-int Vic2::Province::getLiteracyWeightedPopulation(std::optional<std::string> type) const
+int Vic2::Province::getLiteracyWeightedPopulation(std::optional<commonItems::symbol> type) const
 {
 	int totalPopulation = 0;
 	for (auto pop: pops)
 	{
-		if (!type || *type == pop->getType())
+		if (!type || (*type == pop->getTypeSymbol()))
 		{
 			totalPopulation += calculateLiteracyWeightedPop(pop);
 		}
@@ -28,6 +28,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 #include "../Configuration.h"
 #include "newParser.h"
+#include "Symbol.h"
 #include <map>
 #include <memory>
 #include <optional>
@@ -42,17 +43,19 @@ namespace Vic2
 
 class Country;
 class Pop;
+class World;
 
 
-class Province: commonItems::parser
+class Province
 {
 	public:
 		explicit Province(const std::string& numberString, std::istream& theStream);
-		void setCores(const std::map<std::string, Country*>& countries);
+		void setCores(const World& theWorld);
 
 		int getTotalPopulation() const;
-		int getPopulation(std::optional<std::string> type = {}) const;
-		int getLiteracyWeightedPopulation(std::optional<std::string> type = {}) const;
+		// pop types are passed as symbols, so callers can intern them once rather than on every call
+		int getPopulation(std::optional<commonItems::symbol> type = {}) const;
+		int getLiteracyWeightedPopulation(std::optional<commonItems::symbol> type = {}) const;
 		double getPercentageWithCultures(const std::set<std::string>& cultures) const;
 
 		void setOwner(const Country* _owner) { owner = _owner; }
@@ -77,6 +80,8 @@ class Province: commonItems::parser
 		Province(const Province&) = delete;
 		Province& operator=(const Province&) = delete;
 
+		static const commonItems::parserSchema<Province>& getSchema();
+
 		int calculateLiteracyWeightedPop(const std::shared_ptr<const Pop> thePop) const;
 
 		int number;
@@ -29,31 +29,31 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 Vic2::Relations::Relations(const std::string& theTag, std::istream& theStream):
 	tag(theTag)
 {
-	registerKeyword(std::regex("value"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("value", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt valueInt(theStream);
 		value = valueInt.getInt();
 	});
-	registerKeyword(std::regex("level"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("level", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleInt levelInt(theStream);
 		level = levelInt.getInt();
 	});
-	registerKeyword(std::regex("military_access"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("military_access", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString stateString(theStream);
 		militaryAccess = (stateString.getString() == "yes");
 	});
-	registerKeyword(std::regex("last_send_diplomat"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("last_send_diplomat", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString dateString(theStream);
 		lastSentDiplomat = date(dateString.getString());
 	});
-	registerKeyword(std::regex("last_war"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("last_war", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString dateString(theStream);
 		lastWar = date(dateString.getString());
 	});
-	registerKeyword(std::regex("truce_until"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("truce_until", [this](const std::string& unused, std::istream& theStream){
 		commonItems::singleString dateString(theStream);
 		truceUntil = date(dateString.getString());
 	});
-	registerKeyword(std::regex("[A-Za-z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 }
\ No newline at end of file
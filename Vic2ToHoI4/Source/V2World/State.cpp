@@ -35,18 +35,18 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 Vic2::State::State(std::istream& theStream, const std::string& ownerTag):
 	owner(ownerTag)
 {
-	registerKeyword(std::regex("provinces"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("provinces", [this](const std::string& unused, std::istream& theStream){
 		commonItems::intList provinceList(theStream);
 		for (auto province: provinceList.getInts())
 		{
 			provinceNums.insert(province);
 		}
 	});
-	registerKeyword(std::regex("state_buildings"), [this](const std::string& unused, std::istream& theStream){
+	registerKeyword("state_buildings", [this](const std::string& unused, std::istream& theStream){
 		Building theBuilding(theStream);
 		factoryLevel += theBuilding.getLevel();
 	});
-	registerKeyword(std::regex("[A-Za-z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9_]+", commonItems::ignoreItem);
 
 	parseStream(theStream);
 	setID();
@@ -97,14 +97,19 @@ void Vic2::State::determineEmployedWorkers()
 
 Vic2::workerStruct Vic2::State::countEmployedWorkers() const
 {
+	static const commonItems::symbol craftsmen("craftsmen");
+	static const commonItems::symbol clerks("clerks");
+	static const commonItems::symbol artisans("artisans");
+	static const commonItems::symbol capitalists("capitalists");
+
 	workerStruct workers;
 
 	for (auto province: provinces)
 	{
-		workers.craftsmen += province->getPopulation("craftsmen");
-		workers.clerks += province->getPopulation("clerks");
-		workers.artisans += province->getPopulation("artisans");
-		workers.capitalists += province->getLiteracyWeightedPopulation("capitalists");
+		workers.craftsmen += province->getPopulation(craftsmen);
+		workers.clerks += province->getPopulation(clerks);
+		workers.artisans += province->getPopulation(artisans);
+		workers.capitalists += province->getLiteracyWeightedPopulation(capitalists);
 	}
 
 	return workers;
@@ -35,7 +35,7 @@ Vic2::StateDefinitions Vic2::theStateDefinitions;
 
 void Vic2::StateDefinitions::initialize()
 {
-	registerKeyword(std::regex("[A-Z0-9\\_]+"), [this](const std::string& stateID, std::istream& theStream){
+	registerRegex("[A-Z0-9\\_]+", [this](const std::string& stateID, std::istream& theStream){
 		commonItems::intList provinceNumbers(theStream);
 
 		std::set<int> neighbors;
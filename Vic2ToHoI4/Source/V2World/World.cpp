@@ -25,7 +25,10 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include <fstream>
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
+#include "ParallelFor.h"
 #include "ParserHelpers.h"
+#include "ParserProfiling.h"
+#include "PhaseTimer.h"
 #include "CommonCountryData.h"
 #include "Country.h"
 #include "Diplomacy.h"
@@ -37,54 +40,95 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "StateDefinitions.h"
 #include "../Mappers/CountryMapping.h"
 #include "../Mappers/MergeRules.h"
-#include "../Mappers/ProvinceMapper.h"
+#include "../ConversionContext.h"
 
 
 
-Vic2::World::World(const std::string& filename)
+Vic2::World::World(const std::string& filename, const ConversionContext& context)
 {
+	commonItems::phaseTimer phase("Reading Vic2 game data");
 	issuesInstance.instantiate();
 	theStateDefinitions.initialize();
 	inventions theInventions;
 
 	std::vector<int> GPIndexes;
-	registerKeyword(std::regex("great_nations"), [&GPIndexes, this](const std::string& unused, std::istream& theStream)
+	registerKeyword("great_nations", [&GPIndexes, this](const std::string& unused, std::istream& theStream)
 	{
 		commonItems::intList indexList(theStream);
 		GPIndexes = indexList.getInts();
 	});
 
-	registerKeyword(std::regex("\\d+"), [this](const std::string& provinceID, std::istream& theStream)
+	// Provinces and countries are most of the save. Their text is set aside during a quick first pass
+	// over the file, then parsed on every core and added to the world in file order.
+	std::vector<std::pair<std::string, std::string_view>> provinceItems;
+	registerRegex("\\d+", [&provinceItems](const std::string& provinceID, std::istream& theStream)
 	{
-		provinces[stoi(provinceID)] = new Vic2::Province(provinceID, theStream);
+		provinceItems.push_back(std::make_pair(provinceID, *commonItems::getItemText(theStream)));
 	});
 
-	std::vector<std::string> tagsInOrder;
-	tagsInOrder.push_back(""); // REB (first country is index 1
-	registerKeyword(std::regex("[A-Z]{3}"), [&tagsInOrder, &theInventions, this](const std::string& countryTag, std::istream& theStream)
+	std::vector<std::pair<std::string, std::string_view>> countryItems;
+	registerRegex("[A-Z]{3}", [&countryItems](const std::string& countryTag, std::istream& theStream)
 	{
-		countries[countryTag] = new Country(countryTag, theStream, theInventions, theCultureGroups);
-		tagsInOrder.push_back(countryTag);
+		countryItems.push_back(std::make_pair(countryTag, *commonItems::getItemText(theStream)));
 	});
-	registerKeyword(std::regex("[A-Z][0-9]{2}"), [&tagsInOrder, &theInventions, this](const std::string& countryTag, std::istream& theStream)
+	registerRegex("[A-Z][0-9]{2}", [&countryItems](const std::string& countryTag, std::istream& theStream)
 	{
-		countries[countryTag] = new Country(countryTag, theStream, theInventions, theCultureGroups);
-		tagsInOrder.push_back(countryTag);
+		countryItems.push_back(std::make_pair(countryTag, *commonItems::getItemText(theStream)));
 	});
 
-	registerKeyword(std::regex("diplomacy"), [this](const std::string& top, std::istream& theStream)
+	registerKeyword("diplomacy", [this](const std::string& top, std::istream& theStream)
 	{
 		diplomacy = new Vic2::Diplomacy(theStream);
 	});
 
-	registerKeyword(std::regex("[A-Za-z0-9_]+"), commonItems::ignoreItem);
+	registerRegex("[A-Za-z0-9_]+", commonItems::ignoreItem);
 
 
 	LOG(LogLevel::Info) << "* Importing V2 save *";
-	parseFile(filename);
+	phase.next("Parsing save");
+	Utils::mappedFile saveFile(filename);
+	if (!saveFile.isOpen())
+	{
+		LOG(LogLevel::Error) << "Could not open " << filename << " for parsing.";
+	}
+	parseBuffer(commonItems::removeByteOrderMark(saveFile.getContents()));
+
+	phase.next("Parsing countries and provinces");
+	std::vector<Country*> parsedCountries(countryItems.size());
+	std::vector<Province*> parsedProvinces(provinceItems.size());
+	commonItems::parallelFor(countryItems.size() + provinceItems.size(), [&](size_t index)
+	{
+		if (index < countryItems.size())
+		{
+			auto& [countryTag, countryText] = countryItems[index];
+			commonItems::bufferStream countryStream(countryText);
+			parsedCountries[index] = new Country(countryTag, countryStream, theInventions, theCultureGroups);
+		}
+		else
+		{
+			index -= countryItems.size();
+			auto& [provinceID, provinceText] = provinceItems[index];
+			commonItems::bufferStream provinceStream(provinceText);
+			parsedProvinces[index] = new Vic2::Province(provinceID, provinceStream);
+		}
+	});
+
+	std::vector<std::string> tagsInOrder;
+	tagsInOrder.push_back(""); // REB (first country is index 1
+	for (size_t i = 0; i < countryItems.size(); i++)
+	{
+		countries[countryItems[i].first] = parsedCountries[i];
+		tagsInOrder.push_back(countryItems[i].first);
+	}
+	indexCountries();
+	for (size_t i = 0; i < provinceItems.size(); i++)
+	{
+		provinces[stoi(provinceItems[i].first)] = parsedProvinces[i];
+	}
 
 
 	LOG(LogLevel::Info) << "Building world";
+	phase.next("Building world");
 	setGreatPowerStatus(GPIndexes, tagsInOrder);
 	setProvinceOwners();
 	addProvinceCoreInfoToCountries();
@@ -99,12 +143,18 @@ Vic2::World::World(const std::string& filename)
 	{
 		diplomacy = new Vic2::Diplomacy();
 	}
+	phase.next("Reading country files");
 	readCountryFiles();
-	setLocalisations();
+	phase.next("Setting localisations");
+	setLocalisations(context.getVic2Localisations());
+	phase.next("Handling missing country cultures");
 	handleMissingCountryCultures();
 
+	phase.next("Merging nations");
 	overallMergeNations();
-	checkAllProvincesMapped();
+	checkAllProvincesMapped(context.getProvinceMapper());
+
+	commonItems::logParserProfile("the Vic2 save and game data");
 }
 
 
@@ -114,9 +164,9 @@ void Vic2::World::setGreatPowerStatus(const std::vector<int>& GPIndexes, const s
 	{
 		auto tag = tagsInOrder.at(index);
 		greatPowers.push_back(tag);
-		if (auto country = countries.find(tag); country != countries.end())
+		if (auto country = getCountry(tag); country)
 		{
-			country->second->setAsGreatNation();
+			(*country)->setAsGreatNation();
 		}
 	}
 }
@@ -131,10 +181,10 @@ void Vic2::World::setProvinceOwners()
 			continue;
 		}
 
-		if (auto country = countries.find(province.second->getOwnerString()); country != countries.end())
+		if (auto country = getCountry(province.second->getOwnerString()); country)
 		{
-			country->second->addProvince(province);
-			province.second->setOwner(country->second);
+			(*country)->addProvince(province);
+			province.second->setOwner(*country);
 		}
 		else
 		{
@@ -152,7 +202,7 @@ void Vic2::World::addProvinceCoreInfoToCountries()
 {
 	for (auto province: provinces)
 	{
-		province.second->setCores(countries);
+		province.second->setCores(*this);
 		auto provinceCores = province.second->getCores();
 		for (auto coreCountry: provinceCores)
 		{
@@ -242,6 +292,21 @@ void Vic2::World::removeEmptyNations()
 	}
 
 	countries.swap(newCountries);
+	indexCountries();
+}
+
+
+void Vic2::World::indexCountries()
+{
+	countriesByTag.clear();
+	countriesByTag.reserve(countries.size());
+	for (auto country: countries)
+	{
+		if (commonItems::countryTag tag(country.first); tag)
+		{
+			countriesByTag.insert(tag, country.second);
+		}
+	}
 }
 
 
@@ -299,10 +364,10 @@ bool Vic2::World::processCountriesDotTxt(const std::string& countryListFile, con
 		std::string tag = line.substr(0, 3);
 		std::string countryFileName = extractCountryFileName(line);
 		commonCountryData countryData(countryFileName, mod);
-		if (countries.find(tag) != countries.end())
+		if (auto country = getCountry(tag); country)
 		{
-			countries[tag]->setColor(countryData.getColor());
-			countries[tag]->setShipNames(countryData.getUnitNames());
+			(*country)->setColor(countryData.getColor());
+			(*country)->setShipNames(countryData.getUnitNames());
 		}
 		for (auto party: countryData.getParties())
 		{
@@ -356,6 +421,10 @@ void Vic2::World::mergeNations(const std::string& masterTag, const std::vector<s
 				(*master)->eatCountry(*slave);
 			}
 			countries.erase(slaveTag);
+			if (commonItems::countryTag tag(slaveTag); tag)
+			{
+				countriesByTag.erase(tag);
+			}
 		}
 	}
 }
@@ -363,24 +432,29 @@ void Vic2::World::mergeNations(const std::string& masterTag, const std::vector<s
 
 std::optional<Vic2::Country*> Vic2::World::getCountry(const std::string& tag) const
 {
-	auto countryItr = countries.find(tag);
-	if (countryItr != countries.end())
+	if (commonItems::countryTag packedTag(tag); packedTag)
 	{
-		return countryItr->second;
+		if (auto country = countriesByTag.find(packedTag); country)
+		{
+			return *country;
+		}
+		return {};
 	}
-	else
+
+	if (auto country = countries.find(tag); country != countries.end())
 	{
-		return {};
+		return country->second;
 	}
+	return {};
 }
 
 
-void Vic2::World::setLocalisations()
+void Vic2::World::setLocalisations(const V2Localisations& theVic2Localisations)
 {
 	for (auto country: countries)
 	{
-		country.second->setLocalisationNames();
-		country.second->setLocalisationAdjectives();
+		country.second->setLocalisationNames(theVic2Localisations);
+		country.second->setLocalisationAdjectives(theVic2Localisations);
 	}
 }
 
@@ -408,7 +482,7 @@ std::optional<const Vic2::Province*> Vic2::World::getProvince(int provNum) const
 }
 
 
-void Vic2::World::checkAllProvincesMapped() const
+void Vic2::World::checkAllProvincesMapped(const provinceMapper& theProvinceMapper) const
 {
 	for (auto province: provinces)
 	{
@@ -26,6 +26,8 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
+#include "CountryTag.h"
+#include "FlatHashMap.h"
 #include "newParser.h"
 #include "CultureGroups.h"
 #include "Party.h"
@@ -36,6 +38,12 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
+class ConversionContext;
+class provinceMapper;
+class V2Localisations;
+
+
+
 namespace Vic2
 {
 
@@ -48,11 +56,12 @@ class Province;
 class World: commonItems::parser
 {
 	public:
-		explicit World(const std::string& filename);
+		World(const std::string& filename, const ConversionContext& context);
 
 		std::optional<const Province*> getProvince(int provNum) const;
+		std::optional<Country*> getCountry(const std::string& tag) const;
 		
-		std::map<std::string, Country*> getCountries() const { return countries; }
+		const std::map<std::string, Country*>& getCountries() const { return countries; }
 		const Diplomacy* getDiplomacy() const { return diplomacy; }
 		std::vector<std::string> getGreatPowers() const	{ return greatPowers; }
 		std::vector<Party> getParties() const { return parties; }
@@ -62,7 +71,7 @@ class World: commonItems::parser
 		World(const World&) = delete;
 		World& operator=(const World&) = delete;
 
-		void setLocalisations();
+		void setLocalisations(const V2Localisations& theVic2Localisations);
 		void handleMissingCountryCultures();
 
 		void setGreatPowerStatus(const std::vector<int>& GPIndexes, const std::vector<std::string>& tagsInOrder);
@@ -73,23 +82,23 @@ class World: commonItems::parser
 		bool shouldCoreBeRemoved(const Province* core, const Country* country) const;
 		void determineEmployedWorkers();
 		void removeEmptyNations();
+		void indexCountries();
 		void determinePartialStates();
 
 		void overallMergeNations();
 		void mergeNations(const std::string& masterTag, const std::vector<std::string>& slaveTags);
 
-		void checkAllProvincesMapped() const;
+		void checkAllProvincesMapped(const provinceMapper& theProvinceMapper) const;
 
 		void readCountryFiles();
 		bool processCountriesDotTxt(const std::string& countryListFile, const std::string& mod);
 		bool shouldLineBeSkipped(const std::string& line) const;
 		std::string extractCountryFileName(const std::string& countryFileLine) const;
 
-		std::optional<Country*> getCountry(const std::string& tag) const;
-
 
 		std::map<int, Province*> provinces;
 		std::map<std::string, Country*> countries;
+		commonItems::flatHashMap<commonItems::countryTag, Country*> countriesByTag; // the countries with valid tags, for lookups
 		const Diplomacy* diplomacy = nullptr;
 		std::vector<Party> parties;
 		std::vector<std::string> greatPowers;
@@ -24,39 +24,30 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include <algorithm>
 #include <fstream>
 #include <stdexcept>
+#include "CommandLine.h"
 #include "Configuration.h"
+#include "ConversionContext.h"
 #include "Flags.h"
 #include "Log.h"
 #include "HOI4World/HoI4World.h"
 #include "V2World/World.h"
-#include "Mappers/ProvinceMapper.h"
 #include "OSCompatibilityLayer.h"
+#include "PhaseTimer.h"
 
 
 
-void ConvertV2ToHoI4(const string& V2SaveFileName);
+void ConvertV2ToHoI4(const string& V2SaveFileName, const string& commandLineLogLevel);
 int main(const int argc, const char* argv[])
 {
 	try
 	{
+		string commandLineLogLevel = commonItems::getCommandLineLogLevel(argc, argv);
 		LOG(LogLevel::Info) << "Converter version 0.2H";
 		LOG(LogLevel::Info) << "Built on " << __DATE__ << " at " << __TIME__;
 		LOG(LogLevel::Info) << "Current directory is " << Utils::getCurrentDirectory();
 
-		const char* const defaultV2SaveFileName = "input.v2";
-		string V2SaveFileName;
-		if (argc >= 2)
-		{
-			V2SaveFileName = argv[1];
-			LOG(LogLevel::Info) << "Using input file " << V2SaveFileName;
-		}
-		else
-		{
-			V2SaveFileName = defaultV2SaveFileName;
-			LOG(LogLevel::Info) << "No input file given, defaulting to " << defaultV2SaveFileName;
-		}
-
-		ConvertV2ToHoI4(V2SaveFileName);
+		string V2SaveFileName = commonItems::getCommandLineSaveFileName(argc, argv, "input.v2");
+		ConvertV2ToHoI4(V2SaveFileName, commandLineLogLevel);
 
 		return 0;
 	}
@@ -73,19 +64,34 @@ void checkMods();
 void setOutputName(const string& V2SaveFileName);
 void clearOutputFolder();
 void output(HoI4::World& destWorld);
-void ConvertV2ToHoI4(const string& V2SaveFileName)
+void ConvertV2ToHoI4(const string& V2SaveFileName, const string& commandLineLogLevel)
 {
-	ConfigurationFile("configuration.txt");
-	checkMods();
-	setOutputName(V2SaveFileName);
-	clearOutputFolder();
+	{
+		commonItems::phaseTimer conversionPhase("Conversion");
+		commonItems::phaseTimer phase("Reading configuration");
+		ConfigurationFile("configuration.txt");
+		if (!commandLineLogLevel.empty())
+		{
+			Log::setLevel(commandLineLogLevel);	// the command line wins over configuration.txt
+		}
+		checkMods();
+		setOutputName(V2SaveFileName);
+		clearOutputFolder();
 
-	theProvinceMapper.initialize();
+		phase.next("Reading game data");
+		const ConversionContext context(theConfiguration);
 
-	Vic2::World sourceWorld(V2SaveFileName);
-	HoI4::World destWorld(&sourceWorld);
+		phase.next("Importing Vic2 save");
+		Vic2::World sourceWorld(V2SaveFileName, context);
+		phase.next("Converting world");
+		HoI4::World destWorld(&sourceWorld, context);
+
+		phase.next("Outputting mod");
+		output(destWorld);
+	}
 
-	output(destWorld);
+	commonItems::logPhaseSummary();
+	commonItems::writePhaseTrace("output/" + theConfiguration.getOutputName() + "_trace.json");
 	LOG(LogLevel::Info) << "* Conversion complete *";
 }
 
@@ -0,0 +1,134 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../common_items/CountryTag.h"
+#include "../common_items/FlatHashMap.h"
+#include <sstream>
+
+
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+
+namespace CommonItemsTests
+{
+
+TEST_CLASS(CountryTagTests)
+{
+	public:
+		TEST_METHOD(DefaultTagIsInvalid)
+		{
+			Assert::IsFalse(commonItems::countryTag().isValid());
+			Assert::AreEqual(std::string(""), commonItems::countryTag().toString());
+		}
+		TEST_METHOD(TagKeepsItsText)
+		{
+			Assert::AreEqual(std::string("ENG"), commonItems::countryTag("ENG").toString());
+			Assert::AreEqual(std::string("X01"), commonItems::countryTag("X01").toString());
+		}
+		TEST_METHOD(QuotedTagMatchesUnquotedTag)
+		{
+			Assert::IsTrue(commonItems::countryTag("\"FRA\"") == commonItems::countryTag("FRA"));
+		}
+		TEST_METHOD(TextOfWrongLengthIsInvalid)
+		{
+			Assert::IsFalse(commonItems::countryTag("").isValid());
+			Assert::IsFalse(commonItems::countryTag("EN").isValid());
+			Assert::IsFalse(commonItems::countryTag("ENGL").isValid());
+			Assert::IsFalse(commonItems::countryTag("E G").isValid());
+		}
+		TEST_METHOD(TagsOrderAsTheirText)
+		{
+			Assert::IsTrue(commonItems::countryTag("A01") < commonItems::countryTag("AAA"));
+			Assert::IsTrue(commonItems::countryTag("ENG") < commonItems::countryTag("FRA"));
+			Assert::IsFalse(commonItems::countryTag("FRA") < commonItems::countryTag("ENG"));
+		}
+		TEST_METHOD(TagPrintsAsText)
+		{
+			std::ostringstream output;
+			output << commonItems::countryTag("PRU");
+			Assert::AreEqual(std::string("PRU"), output.str());
+		}
+};
+
+TEST_CLASS(FlatHashMapTests)
+{
+	public:
+		TEST_METHOD(MissingKeyIsNotFound)
+		{
+			commonItems::flatHashMap<int, int> theMap;
+			Assert::IsTrue(theMap.find(42) == nullptr);
+			Assert::IsFalse(theMap.contains(42));
+		}
+		TEST_METHOD(InsertedValueIsFound)
+		{
+			commonItems::flatHashMap<commonItems::countryTag, int> theMap;
+			Assert::IsTrue(theMap.insert(commonItems::countryTag("ENG"), 5));
+			Assert::AreEqual(5, *theMap.find(commonItems::countryTag("ENG")));
+			Assert::IsTrue(theMap.find(commonItems::countryTag("FRA")) == nullptr);
+		}
+		TEST_METHOD(InsertDoesNotReplaceExistingValue)
+		{
+			commonItems::flatHashMap<int, int> theMap;
+			theMap.insert(1, 10);
+			Assert::IsFalse(theMap.insert(1, 20));
+			Assert::AreEqual(10, *theMap.find(1));
+			Assert::AreEqual(size_t(1), theMap.size());
+		}
+		TEST_METHOD(ManyKeysSurviveGrowth)
+		{
+			commonItems::flatHashMap<int, int> theMap;
+			for (int i = 0; i < 10000; i++)
+			{
+				theMap[i * 7] = i;
+			}
+			Assert::AreEqual(size_t(10000), theMap.size());
+			for (int i = 0; i < 10000; i++)
+			{
+				Assert::AreEqual(i, *theMap.find(i * 7));
+			}
+		}
+		TEST_METHOD(ErasedKeyIsGoneAndOthersRemain)
+		{
+			commonItems::flatHashMap<int, int> theMap;
+			for (int i = 0; i < 100; i++)
+			{
+				theMap[i] = i;
+			}
+			for (int i = 0; i < 100; i += 2)
+			{
+				Assert::IsTrue(theMap.erase(i));
+			}
+			Assert::IsFalse(theMap.erase(0));
+			Assert::AreEqual(size_t(50), theMap.size());
+			for (int i = 0; i < 100; i++)
+			{
+				Assert::AreEqual(i % 2 == 1, theMap.contains(i));
+			}
+		}
+};
+
+}
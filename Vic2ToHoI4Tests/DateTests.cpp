@@ -0,0 +1,97 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../common_items/Date.h"
+
+
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+
+namespace CommonItemsTests
+{
+
+TEST_CLASS(DateTests)
+{
+	public:
+		TEST_METHOD(DefaultDateIsFirstOfJanuaryYearOne)
+		{
+			Assert::AreEqual(std::string("1.1.1"), date().toString());
+			Assert::IsFalse(date().isSet());
+		}
+		TEST_METHOD(DateIsReadFromText)
+		{
+			const date theDate("1836.11.15");
+			Assert::AreEqual(1836, theDate.getYear());
+			Assert::AreEqual(11, theDate.getMonth());
+			Assert::AreEqual(15, theDate.getDay());
+		}
+		TEST_METHOD(QuotesAndLeadingZerosAreAccepted)
+		{
+			Assert::IsTrue(date("\"1937.01.01\"") == date(1937, 1, 1));
+		}
+		TEST_METHOD(MissingPartsDefaultToOne)
+		{
+			Assert::IsTrue(date("1444") == date(1444, 1, 1));
+			Assert::IsTrue(date("1444.11") == date(1444, 11, 1));
+		}
+		TEST_METHOD(TextThatIsNotADateGivesZeroDate)
+		{
+			Assert::AreEqual(std::string("0.0.0"), date("not a date").toString());
+			Assert::AreEqual(std::string("0.0.0"), date("1821.13.1").toString());
+		}
+		TEST_METHOD(DatesCompareInCalendarOrder)
+		{
+			Assert::IsTrue(date("1836.1.31") < date("1836.2.1"));
+			Assert::IsTrue(date("1835.12.31") < date("1836.1.1"));
+			Assert::IsTrue(date("-1.12.31") < date("0.1.1"));
+			Assert::IsTrue(date("1836.1.1") >= date(1836, 1, 1));
+		}
+		TEST_METHOD(ConstantDatesAreBuiltAtCompileTime)
+		{
+			constexpr date theDate("2000.1.1");
+			static_assert(theDate.getYear() == 2000, "constexpr date");
+			Assert::IsTrue(theDate.isSet());
+		}
+		TEST_METHOD(DiffInYearsCountsPartialYears)
+		{
+			Assert::AreEqual(64.5f, date("1900.7.2").diffInYears(date("1836.1.1")), 0.01f);
+		}
+		TEST_METHOD(IncreaseByMonthsWrapsTheYear)
+		{
+			date theDate(1836, 11, 15);
+			theDate.increaseByMonths(3);
+			Assert::AreEqual(std::string("1837.2.15"), theDate.toString());
+		}
+		TEST_METHOD(SubtractYearsKeepsMonthAndDay)
+		{
+			date theDate(1836, 11, 15);
+			theDate.subtractYears(200);
+			Assert::AreEqual(std::string("1636.11.15"), theDate.toString());
+		}
+};
+
+}
@@ -27,6 +27,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include "../Vic2ToHoI4/Source/Mappers/ProvinceMapper.h"
 #include "../Vic2ToHoI4/Source/HoI4World/HoI4Army.h"
 #include "../Vic2ToHoI4/Source/V2World/Army.h"
+#include <memory>
 
 
 
@@ -37,13 +38,16 @@ using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 namespace HoI4WorldTests
 {
 
+static std::unique_ptr<provinceMapper> theProvinceMapper;
+
+
 TEST_CLASS(HoI4ArmyTests)
 {
 	public:
 		TEST_CLASS_INITIALIZE(HoI4ArmyTestsInitialization)
 		{
 			ConfigurationFile("configuration.txt");
-			theProvinceMapper.initialize();
+			theProvinceMapper = std::make_unique<provinceMapper>(theConfiguration);
 		}
 
 		TEST_METHOD(ArmyStartsEmpty)
@@ -60,7 +64,7 @@ TEST_CLASS(HoI4ArmyTests)
 
 			std::stringstream mappingsInput;
 			HoI4::militaryMappings theMilitaryMappings(std::string("default"), mappingsInput);
-			theArmy.convertArmies(theMilitaryMappings, 0);
+			theArmy.convertArmies(theMilitaryMappings, 0, *theProvinceMapper);
 
 			std::ostringstream output;
 			output << theArmy;
@@ -93,7 +97,7 @@ TEST_CLASS(HoI4ArmyTests)
 												 "}"
 			);
 			HoI4::militaryMappings theMilitaryMappings(std::string("default"), mappingsInput);
-			theArmy.convertArmies(theMilitaryMappings, 0);
+			theArmy.convertArmies(theMilitaryMappings, 0, *theProvinceMapper);
 
 			std::ostringstream output;
 			output << theArmy;
@@ -141,7 +145,7 @@ TEST_CLASS(HoI4ArmyTests)
 													  "}"
 			);
 			HoI4::militaryMappings theMilitaryMappings(std::string("default"), mappingsInput);
-			theArmy.convertArmies(theMilitaryMappings, 0);
+			theArmy.convertArmies(theMilitaryMappings, 0, *theProvinceMapper);
 
 			std::ostringstream output;
 			output << theArmy;
@@ -211,7 +215,7 @@ TEST_CLASS(HoI4ArmyTests)
 													  "}"
 			);
 			HoI4::militaryMappings theMilitaryMappings(std::string("default"), mappingsInput);
-			theArmy.convertArmies(theMilitaryMappings, 0);
+			theArmy.convertArmies(theMilitaryMappings, 0, *theProvinceMapper);
 
 			std::ostringstream output;
 			output << theArmy;
@@ -288,7 +292,7 @@ TEST_CLASS(HoI4ArmyTests)
 													  "}"
 			);
 			HoI4::militaryMappings theMilitaryMappings(std::string("default"), mappingsInput);
-			theArmy.convertArmies(theMilitaryMappings, 0);
+			theArmy.convertArmies(theMilitaryMappings, 0, *theProvinceMapper);
 
 			std::ostringstream output;
 			output << theArmy;
@@ -372,7 +376,7 @@ TEST_CLASS(HoI4ArmyTests)
 													  "}"
 			);
 			HoI4::militaryMappings theMilitaryMappings(std::string("default"), mappingsInput);
-			theArmy.convertArmies(theMilitaryMappings, 0);
+			theArmy.convertArmies(theMilitaryMappings, 0, *theProvinceMapper);
 
 			std::ostringstream output;
 			output << theArmy;
@@ -442,7 +446,7 @@ TEST_CLASS(HoI4ArmyTests)
 													  "}"
 			);
 			HoI4::militaryMappings theMilitaryMappings(std::string("default"), mappingsInput);
-			theArmy.convertArmies(theMilitaryMappings, 1);
+			theArmy.convertArmies(theMilitaryMappings, 1, *theProvinceMapper);
 
 			std::ostringstream output;
 			output << theArmy;
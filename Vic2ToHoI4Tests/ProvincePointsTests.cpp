@@ -0,0 +1,116 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../Vic2ToHoI4/Source/HoI4World/MapData.h"
+
+
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+
+namespace HoI4WorldTests
+{
+
+TEST_CLASS(ProvincePointsTests)
+{
+	public:
+		TEST_METHOD(CentermostPointIsCenterWhenCenterIsInProvince)
+		{
+			HoI4::provincePoints thePoints;
+			thePoints.addRun(0, 0, 2);
+			thePoints.addRun(1, 0, 2);
+			thePoints.addRun(2, 0, 2);
+
+			const point centermostPoint = thePoints.getCentermostPoint();
+			Assert::AreEqual(1, centermostPoint.first);
+			Assert::AreEqual(1, centermostPoint.second);
+		}
+		TEST_METHOD(CentermostPointIsNearestProvincePointWhenCenterIsOutsideProvince)
+		{
+			HoI4::provincePoints thePoints;
+			thePoints.addRun(0, 0, 0);
+			thePoints.addRun(0, 4, 4);
+			thePoints.addRun(1, 0, 0);
+			thePoints.addRun(1, 4, 4);
+			thePoints.addRun(2, 0, 4);
+
+			const point centermostPoint = thePoints.getCentermostPoint();
+			Assert::AreEqual(2, centermostPoint.first);
+			Assert::AreEqual(2, centermostPoint.second);
+		}
+		TEST_METHOD(CentermostPointTieGoesToLeftmostPoint)
+		{
+			HoI4::provincePoints thePoints;
+			thePoints.addPoint({ 0, 0 });
+			thePoints.addPoint({ 2, 0 });
+
+			const point centermostPoint = thePoints.getCentermostPoint();
+			Assert::AreEqual(0, centermostPoint.first);
+			Assert::AreEqual(0, centermostPoint.second);
+		}
+		TEST_METHOD(CentermostPointTieGoesToLowestPoint)
+		{
+			HoI4::provincePoints thePoints;
+			thePoints.addPoint({ 0, 0 });
+			thePoints.addPoint({ 0, 2 });
+
+			const point centermostPoint = thePoints.getCentermostPoint();
+			Assert::AreEqual(0, centermostPoint.first);
+			Assert::AreEqual(0, centermostPoint.second);
+		}
+		TEST_METHOD(CentermostPointTieDoesNotDependOnRunOrder)
+		{
+			HoI4::provincePoints thePoints;
+			thePoints.addPoint({ 2, 0 });
+			HoI4::provincePoints otherPoints;
+			otherPoints.addPoint({ 0, 0 });
+			thePoints.addPoints(std::move(otherPoints));
+
+			const point centermostPoint = thePoints.getCentermostPoint();
+			Assert::AreEqual(0, centermostPoint.first);
+			Assert::AreEqual(0, centermostPoint.second);
+		}
+		TEST_METHOD(AddedPointsFromAnotherBandWidenCenter)
+		{
+			HoI4::provincePoints thePoints;
+			for (int y = 0; y < 4; y++)
+			{
+				thePoints.addRun(y, 0, 1);
+			}
+			HoI4::provincePoints otherPoints;
+			for (int y = 4; y < 8; y++)
+			{
+				otherPoints.addRun(y, 6, 7);
+			}
+			thePoints.addPoints(std::move(otherPoints));
+
+			const point centermostPoint = thePoints.getCentermostPoint();
+			Assert::AreEqual(1, centermostPoint.first);
+			Assert::AreEqual(3, centermostPoint.second);
+		}
+};
+
+}
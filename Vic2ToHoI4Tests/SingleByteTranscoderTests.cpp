@@ -0,0 +1,171 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../common_items/SingleByteTranscoder.h"
+
+
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+
+namespace CommonItemsTests
+{
+
+// What the Unicode consortium's mapping tables, and so iconv, give for bytes 0x80 - 0xFF. Zero marks
+// a byte that is not defined in the code page.
+const char32_t win1252CodePoints[128] = {
+	0x20AC, 0x0000, 0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,  // 0x80
+	0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0x0000, 0x017D, 0x0000,  // 0x88
+	0x0000, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,  // 0x90
+	0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0x0000, 0x017E, 0x0178,  // 0x98
+	0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,  // 0xA0
+	0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,  // 0xA8
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,  // 0xB0
+	0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,  // 0xB8
+	0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,  // 0xC0
+	0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,  // 0xC8
+	0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,  // 0xD0
+	0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,  // 0xD8
+	0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,  // 0xE0
+	0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,  // 0xE8
+	0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,  // 0xF0
+	0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF   // 0xF8
+};
+
+const char32_t iso8859_15CodePoints[128] = {
+	0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,  // 0x80
+	0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,  // 0x88
+	0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,  // 0x90
+	0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,  // 0x98
+	0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x20AC, 0x00A5, 0x0160, 0x00A7,  // 0xA0
+	0x0161, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,  // 0xA8
+	0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x017D, 0x00B5, 0x00B6, 0x00B7,  // 0xB0
+	0x017E, 0x00B9, 0x00BA, 0x00BB, 0x0152, 0x0153, 0x0178, 0x00BF,  // 0xB8
+	0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,  // 0xC0
+	0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,  // 0xC8
+	0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,  // 0xD0
+	0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,  // 0xD8
+	0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,  // 0xE0
+	0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,  // 0xE8
+	0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,  // 0xF0
+	0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF   // 0xF8
+};
+
+
+std::string toUTF8(char32_t codePoint)
+{
+	std::string UTF8;
+	if (codePoint < 0x80)
+	{
+		UTF8 += static_cast<char>(codePoint);
+	}
+	else if (codePoint < 0x800)
+	{
+		UTF8 += static_cast<char>(0xC0 | (codePoint >> 6));
+		UTF8 += static_cast<char>(0x80 | (codePoint & 0x3F));
+	}
+	else
+	{
+		UTF8 += static_cast<char>(0xE0 | (codePoint >> 12));
+		UTF8 += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+		UTF8 += static_cast<char>(0x80 | (codePoint & 0x3F));
+	}
+	return UTF8;
+}
+
+
+void checkEveryByte(commonItems::singleByteEncoding encoding, const char32_t (&highCodePoints)[128])
+{
+	for (int byte = 0; byte < 256; byte++)
+	{
+		const char32_t codePoint = (byte < 0x80) ? byte : highCodePoints[byte - 0x80];
+		const std::wstring message = L"byte " + std::to_wstring(byte);
+
+		std::string output = "prefix";
+		const bool converted = commonItems::appendAsUTF8(std::string(1, static_cast<char>(byte)), encoding, output);
+		if ((byte != 0) && (codePoint == 0))
+		{
+			Assert::IsFalse(converted, message.c_str());
+			Assert::AreEqual(std::string("prefix"), output, message.c_str());
+		}
+		else
+		{
+			Assert::IsTrue(converted, message.c_str());
+			Assert::AreEqual("prefix" + toUTF8(codePoint), output, message.c_str());
+		}
+	}
+}
+
+
+void checkLongMixedText(commonItems::singleByteEncoding encoding, const char32_t (&highCodePoints)[128])
+{
+	std::string input;
+	std::string expected;
+	for (int repeat = 0; repeat < 40; repeat++)
+	{
+		const std::string ASCIIRun(repeat, static_cast<char>('a' + repeat % 26));
+		input += ASCIIRun;
+		expected += ASCIIRun;
+
+		const int byte = 0xA0 + repeat;
+		input += static_cast<char>(byte);
+		expected += toUTF8(highCodePoints[byte - 0x80]);
+	}
+
+	std::string output;
+	Assert::IsTrue(commonItems::appendAsUTF8(input, encoding, output));
+	Assert::AreEqual(expected, output);
+}
+
+
+TEST_CLASS(SingleByteTranscoderTests)
+{
+	public:
+		TEST_METHOD(EveryWin1252ByteMatchesTheCodePage)
+		{
+			checkEveryByte(commonItems::singleByteEncoding::Win1252, win1252CodePoints);
+		}
+		TEST_METHOD(EveryISO8859_15ByteMatchesTheCodePage)
+		{
+			checkEveryByte(commonItems::singleByteEncoding::ISO8859_15, iso8859_15CodePoints);
+		}
+		TEST_METHOD(LongWin1252TextMatchesTheCodePage)
+		{
+			checkLongMixedText(commonItems::singleByteEncoding::Win1252, win1252CodePoints);
+		}
+		TEST_METHOD(LongISO8859_15TextMatchesTheCodePage)
+		{
+			checkLongMixedText(commonItems::singleByteEncoding::ISO8859_15, iso8859_15CodePoints);
+		}
+		TEST_METHOD(UndefinedByteLeavesOutputUnchanged)
+		{
+			std::string output = "kept";
+			Assert::IsFalse(commonItems::appendAsUTF8("abc\x81" "def", commonItems::singleByteEncoding::Win1252, output));
+			Assert::AreEqual(std::string("kept"), output);
+		}
+};
+
+}
@@ -0,0 +1,74 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+#include "stdafx.h"
+#include "CppUnitTest.h"
+#include "../common_items/Symbol.h"
+#include <map>
+
+
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+
+
+
+namespace CommonItemsTests
+{
+
+TEST_CLASS(SymbolTests)
+{
+	public:
+		TEST_METHOD(DefaultSymbolIsEmptyString)
+		{
+			Assert::IsTrue(commonItems::symbol().empty());
+			Assert::AreEqual(std::string(""), commonItems::symbol().str());
+			Assert::IsTrue(commonItems::symbol("") == commonItems::symbol());
+		}
+		TEST_METHOD(SameTextGivesSameSymbol)
+		{
+			const commonItems::symbol first("english");
+			const commonItems::symbol second(std::string("eng") + "lish");
+			Assert::IsTrue(first == second);
+			Assert::AreEqual(first.getHandle(), second.getHandle());
+		}
+		TEST_METHOD(DifferentTextGivesDifferentSymbols)
+		{
+			Assert::IsTrue(commonItems::symbol("english") != commonItems::symbol("french"));
+		}
+		TEST_METHOD(SymbolKeepsItsText)
+		{
+			Assert::AreEqual(std::string("north_german"), commonItems::symbol("north_german").str());
+		}
+		TEST_METHOD(SymbolsOrderByText)
+		{
+			const commonItems::symbol zulu("zulu_symbol_test");
+			const commonItems::symbol alpha("alpha_symbol_test");
+			std::map<commonItems::symbol, int> ordered{ { zulu, 1 }, { alpha, 2 } };
+			Assert::IsTrue(ordered.begin()->first == alpha);
+			Assert::IsTrue(alpha < zulu);
+			Assert::IsFalse(zulu < alpha);
+			Assert::IsFalse(alpha < alpha);
+		}
+};
+
+}
@@ -0,0 +1,74 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+#include "CommandLine.h"
+#include "Log.h"
+
+
+
+namespace
+{
+
+const std::string logLevelOption = "--log-level=";
+
+
+bool isLogLevelOption(const std::string& argument)
+{
+	return argument.compare(0, logLevelOption.size(), logLevelOption) == 0;
+}
+
+}
+
+
+std::string commonItems::getCommandLineLogLevel(int argc, const char* argv[])
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const std::string argument = argv[i];
+		if (isLogLevelOption(argument))
+		{
+			std::string levelName = argument.substr(logLevelOption.size());
+			if (Log::setLevel(levelName))
+			{
+				return levelName;
+			}
+			LOG(LogLevel::Warning) << "Unknown log level " << levelName << " on the command line";
+		}
+	}
+
+	return "";
+}
+
+
+std::string commonItems::getCommandLineSaveFileName(int argc, const char* argv[], const std::string& defaultSaveFileName)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		if (!isLogLevelOption(argv[i]))
+		{
+			LOG(LogLevel::Info) << "Using input file " << argv[i];
+			return argv[i];
+		}
+	}
+
+	LOG(LogLevel::Info) << "No input file given, defaulting to " << defaultSaveFileName;
+	return defaultSaveFileName;
+}
@@ -0,0 +1,45 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+#ifndef COMMAND_LINE_H
+#define COMMAND_LINE_H
+
+
+#include <string>
+
+
+
+// The converters take an optional --log-level=<level> and the save to convert, in either order
+namespace commonItems
+{
+
+// Applies the log level given on the command line, if any, and returns it so it can be applied again
+// after the configuration has been read. An unknown level is warned about and ignored.
+std::string getCommandLineLogLevel(int argc, const char* argv[]);
+
+// The first argument that isn't an option, or defaultSaveFileName if there is none
+std::string getCommandLineSaveFileName(int argc, const char* argv[], const std::string& defaultSaveFileName);
+
+}
+
+
+
+#endif // COMMAND_LINE_H
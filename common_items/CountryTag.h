@@ -0,0 +1,118 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+
+#ifndef COUNTRY_TAG_H
+#define COUNTRY_TAG_H
+
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+
+
+namespace commonItems
+{
+
+// A three character country tag such as ENG or X01, packed into one integer so that tags copy,
+// compare and hash as cheaply as an int. The first character is in the high byte, so tags order
+// exactly as their strings do. Text that is not three letters or digits gives the invalid tag,
+// which is never equal to a real one.
+class countryTag
+{
+	public:
+		constexpr countryTag() noexcept = default;
+		explicit constexpr countryTag(std::string_view text) noexcept: packed(pack(text)) {}
+
+		constexpr bool isValid() const noexcept { return packed != 0; }
+		explicit constexpr operator bool() const noexcept { return isValid(); }
+		constexpr uint32_t getPacked() const noexcept { return packed; }
+
+		std::string toString() const
+		{
+			if (!isValid())
+			{
+				return "";
+			}
+			return std::string{ static_cast<char>(packed >> 16), static_cast<char>(packed >> 8), static_cast<char>(packed) };
+		}
+
+		constexpr bool operator==(countryTag other) const noexcept { return packed == other.packed; }
+		constexpr bool operator!=(countryTag other) const noexcept { return packed != other.packed; }
+		constexpr bool operator<(countryTag other) const noexcept { return packed < other.packed; }
+		constexpr bool operator>(countryTag other) const noexcept { return packed > other.packed; }
+		constexpr bool operator<=(countryTag other) const noexcept { return packed <= other.packed; }
+		constexpr bool operator>=(countryTag other) const noexcept { return packed >= other.packed; }
+
+	private:
+		static constexpr bool isTagCharacter(char c) noexcept
+		{
+			return ((c >= 'A') && (c <= 'Z')) || ((c >= 'a') && (c <= 'z')) || ((c >= '0') && (c <= '9'));
+		}
+
+		static constexpr uint32_t pack(std::string_view text) noexcept
+		{
+			if ((text.size() == 5) && (text.front() == '"') && (text.back() == '"'))
+			{
+				text = text.substr(1, 3);
+			}
+			if ((text.size() != 3) || !isTagCharacter(text[0]) || !isTagCharacter(text[1]) || !isTagCharacter(text[2]))
+			{
+				return 0;
+			}
+			return (static_cast<uint32_t>(static_cast<unsigned char>(text[0])) << 16) |
+				(static_cast<uint32_t>(static_cast<unsigned char>(text[1])) << 8) |
+				static_cast<uint32_t>(static_cast<unsigned char>(text[2]));
+		}
+
+		uint32_t packed = 0;
+};
+
+
+inline std::ostream& operator<<(std::ostream& out, countryTag tag)
+{
+	if (tag.isValid())
+	{
+		const uint32_t packed = tag.getPacked();
+		out << static_cast<char>(packed >> 16) << static_cast<char>(packed >> 8) << static_cast<char>(packed);
+	}
+	return out;
+}
+
+}
+
+
+namespace std
+{
+template<> struct hash<commonItems::countryTag>
+{
+	size_t operator()(commonItems::countryTag tag) const noexcept { return tag.getPacked(); }
+};
+}
+
+
+
+#endif // COUNTRY_TAG_H
@@ -22,139 +22,40 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 #include "Date.h"
-#include <array>
-#include <vector>
-#include "OSCompatibilityLayer.h"
+#include <sstream>
+#include "Log.h"
 
 
 
-date::date(std::string _init):
-	year(1),
-	month(1),
-	day(1)
+void date::warnInvalid(std::string_view text)
 {
-	if (_init.length() < 1)
-	{
-		return;
-	}
-
-	if (_init[0] == '\"')
-	{
-		_init = _init.substr(1, _init.length() - 2);
-	}
-	const int first_dot	= _init.find_first_of('.');	// the position of the first period in the date
-	const int last_dot	= _init.find_last_of('.');		// the position of the second period in the date
-
-	try
-	{
-		year						= stoi( _init.substr(0, first_dot) );
-		month						= stoi( _init.substr(first_dot + 1, last_dot - first_dot) );
-		day						= stoi( _init.substr(last_dot + 1, 2) );
-	}
-	catch (const std::exception& e)
-	{
-		LOG(LogLevel::Warning) << "Problem inputting date: " << e.what();
-		year = 0;
-		month = 0;
-		day = 0;
-	}
-}
-
-
-bool date::operator==(const date& _rhs) const noexcept
-{
-	return ((year == _rhs.year)
-		 && (month == _rhs.month)
-		 && (day == _rhs.day));
-}
-
-
-bool date::operator!=(const date& _rhs) const noexcept
-{
-	return !(*this == _rhs);
-}
-
-
-bool date::operator<(const date& _rhs) const noexcept
-{
-	return ((year < _rhs.year)
-		|| ((year == _rhs.year) && (month < _rhs.month))
-		|| ((year == _rhs.year) && (month == _rhs.month) && (day < _rhs.day)));
-}
-
-
-bool date::operator>(const date& _rhs) const noexcept
-{
-	return ((year > _rhs.year)
-		|| ((year == _rhs.year) && (month > _rhs.month))
-		|| ((year == _rhs.year) && (month == _rhs.month) && (day > _rhs.day)));
-}
-
-
-bool date::operator<=(const date& _rhs) const noexcept
-{
-	return ((*this == _rhs) || (*this < _rhs));
-}
-
-
-bool date::operator>=(const date& _rhs) const noexcept
-{ 
-	return ((*this == _rhs) || (*this > _rhs));
+	LOG(LogLevel::Warning) << "Problem inputting date: " << text;
 }
 
 
 std::ostream& operator<<(std::ostream& out, const date& d)
 {
-	out << d.year << '.' << d.month << '.' << d.day;
+	out << d.getYear() << '.' << d.getMonth() << '.' << d.getDay();
 	return out;
 }
 
 
-float date::diffInYears(const date& _rhs) const noexcept
-{
-	float years = static_cast<float>(year - _rhs.year);	// the difference in years
-	years += static_cast<float>(calculateDayInYear() - _rhs.calculateDayInYear()) / 365;
-
-	return years;
-}
-
-
-const std::array<int, 12> daysByMonth = { 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
-int date::calculateDayInYear() const noexcept
-{
-	return day + daysByMonth[month - 1];
-}
-
-
 void date::increaseByMonths(const int _months) noexcept
 {
-	year += _months / 12;
-	month += _months % 12;
+	int year = getYear() + _months / 12;
+	int month = getMonth() + _months % 12;
 	if (month > 12)
 	{
 		year++;
 		month -= 12;
 	}
-	return;
-}
-
-
-void date::subtractYears(const int _years) noexcept
-{
-	year -= _years;
-}
-
-
-bool date::isSet() const noexcept
-{
-	const date default_date;	// an instance with the default date
-	return (*this != default_date);
+	packed = pack(year, month, getDay());
 }
 
 
 std::string date::toString() const
 {
 	std::stringstream buf;
-	buf << year << '.' << month << '.' << day;
+	buf << *this;
 	return buf.str();
-}
\ No newline at end of file
+}
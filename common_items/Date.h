@@ -26,48 +26,146 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
+#include <array>
+#include <cstdint>
 #include <iostream>
-#include <memory>
 #include <string>
+#include <string_view>
 
 
 
+// A day as year.month.day, packed into one integer so that copying and comparing dates costs no more
+// than for an int. Dates can be read from text without allocating, and constant dates such as
+// date("1836.1.1") are built at compile time when declared constexpr.
 struct date
 {
 	public:
-		explicit date(std::string _init);
+		constexpr date() noexcept = default;
+		constexpr date(int year, int month, int day) noexcept: packed(pack(year, month, day)) {}
 
-		date() = default; 
-		date(const date&) = default;
-		date(date&&) = default;
-		~date() = default;
-		date& operator=(const date&) = default;
+		// Reads year.month.day as found in game files, quoted or not. Missing parts default to 1.
+		// Logs a warning and gives 0.0.0 for text that is not a date.
+		explicit constexpr date(std::string_view text);
 
-		bool operator==(const date& _rhs) const noexcept;
-		bool operator!=(const date& _rhs) const noexcept;
-		bool operator<(const date& _rhs) const noexcept;
-		bool operator>(const date& _rhs) const noexcept;
-		bool operator<=(const date& _rhs) const noexcept;
-		bool operator>=(const date& _rhs) const noexcept;
+		constexpr bool operator==(const date& _rhs) const noexcept { return packed == _rhs.packed; }
+		constexpr bool operator!=(const date& _rhs) const noexcept { return packed != _rhs.packed; }
+		constexpr bool operator<(const date& _rhs) const noexcept { return packed < _rhs.packed; }
+		constexpr bool operator>(const date& _rhs) const noexcept { return packed > _rhs.packed; }
+		constexpr bool operator<=(const date& _rhs) const noexcept { return packed <= _rhs.packed; }
+		constexpr bool operator>=(const date& _rhs) const noexcept { return packed >= _rhs.packed; }
 
 		friend std::ostream& operator<<(std::ostream&, const date&);
-	
-		float diffInYears(const date& _rhs) const noexcept;
+
+		constexpr float diffInYears(const date& _rhs) const noexcept
+		{
+			float years = static_cast<float>(getYear() - _rhs.getYear());
+			years += static_cast<float>(calculateDayInYear() - _rhs.calculateDayInYear()) / 365;
+			return years;
+		}
 
 		void increaseByMonths(const int _months) noexcept;
-		void subtractYears(const int _years) noexcept;
+		constexpr void subtractYears(const int _years) noexcept { packed -= _years * yearUnit; }
 
-		bool isSet() const noexcept;
+		constexpr bool isSet() const noexcept { return *this != date(); }
 		std::string toString() const;
 
-	private:
-		int calculateDayInYear() const noexcept;
+		constexpr int getYear() const noexcept { return packed >> yearShift; }
+		constexpr int getMonth() const noexcept { return (packed >> monthShift) & 15; }
+		constexpr int getDay() const noexcept { return packed & 31; }
 
-		int year = 1;
-		int month = 1;
-		int day = 1;
+	private:
+		// the day in the low five bits and the month in the four above, so packed order is date order
+		static constexpr int monthShift = 5;
+		static constexpr int yearShift = 9;
+		static constexpr int32_t yearUnit = 1 << yearShift;
+		static constexpr std::array<int, 13> daysBeforeMonth = { 0, 0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334 };
+
+		static constexpr int32_t pack(int year, int month, int day) noexcept
+		{
+			return year * yearUnit + (month << monthShift) + day;
+		}
+
+		static constexpr bool readNumber(std::string_view& text, int& number) noexcept
+		{
+			bool negative = false;
+			if (!text.empty() && (text.front() == '-'))
+			{
+				negative = true;
+				text.remove_prefix(1);
+			}
+			if (text.empty() || (text.front() < '0') || (text.front() > '9'))
+			{
+				return false;
+			}
+			number = 0;
+			while (!text.empty() && (text.front() >= '0') && (text.front() <= '9'))
+			{
+				number = number * 10 + (text.front() - '0');
+				text.remove_prefix(1);
+			}
+			if (negative)
+			{
+				number = -number;
+			}
+			return true;
+		}
+
+		static void warnInvalid(std::string_view text);
+
+		constexpr int calculateDayInYear() const noexcept
+		{
+			return getDay() + daysBeforeMonth[getMonth() <= 12 ? getMonth() : 0];
+		}
+
+		int32_t packed = pack(1, 1, 1);
 };
 
 
+constexpr date::date(std::string_view text):
+	packed(pack(1, 1, 1))
+{
+	if (text.empty())
+	{
+		return;
+	}
+	if (text.front() == '"')
+	{
+		text.remove_prefix(1);
+		if (!text.empty() && (text.back() == '"'))
+		{
+			text.remove_suffix(1);
+		}
+	}
+	const std::string_view original = text;
+	while (!text.empty() && ((text.front() == ' ') || (text.front() == '\t')))
+	{
+		text.remove_prefix(1);
+	}
+
+	int year = 1;
+	int month = 1;
+	int day = 1;
+	bool valid = readNumber(text, year);
+	if (valid && !text.empty() && (text.front() == '.'))
+	{
+		text.remove_prefix(1);
+		valid = readNumber(text, month);
+		if (valid && !text.empty() && (text.front() == '.'))
+		{
+			text.remove_prefix(1);
+			valid = readNumber(text, day);
+		}
+	}
+	if (!valid || (month < 0) || (month > 12) || (day < 0) || (day > 31))
+	{
+		warnInvalid(original);
+		packed = 0;
+		return;
+	}
+
+	packed = pack(year, month, day);
+}
+
+
 
 #endif // _DATE_H
\ No newline at end of file
@@ -0,0 +1,220 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+
+#ifndef FLAT_HASH_MAP_H
+#define FLAT_HASH_MAP_H
+
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+
+
+namespace commonItems
+{
+
+// A hash map for small integer-like keys (province numbers, country tags) that keeps its entries in
+// one flat array and resolves collisions by probing the following slots, so a lookup is a multiply,
+// a shift and usually a single compare. Keys are hashed with std::hash, whose result is spread over
+// the table by Fibonacci hashing. Values must be default constructible. Pointers returned by find()
+// and references from operator[] are invalidated by any later insertion.
+template<typename Key, typename Value> class flatHashMap
+{
+	public:
+		flatHashMap() = default;
+		explicit flatHashMap(size_t expectedSize) { reserve(expectedSize); }
+
+		size_t size() const noexcept { return entryCount; }
+		bool empty() const noexcept { return entryCount == 0; }
+
+		void clear()
+		{
+			slots.clear();
+			used.clear();
+			entryCount = 0;
+			shift = 64;
+		}
+
+		// Makes room for expectedSize entries without further rehashing
+		void reserve(size_t expectedSize)
+		{
+			size_t capacity = minimumCapacity;
+			while (capacity * maxLoadNumerator < expectedSize * maxLoadDenominator)
+			{
+				capacity *= 2;
+			}
+			if (capacity > slots.size())
+			{
+				rehash(capacity);
+			}
+		}
+
+		Value* find(const Key& key) noexcept
+		{
+			const size_t slot = locate(key);
+			return (slot != notFound) ? &slots[slot].second : nullptr;
+		}
+
+		const Value* find(const Key& key) const noexcept
+		{
+			const size_t slot = locate(key);
+			return (slot != notFound) ? &slots[slot].second : nullptr;
+		}
+
+		bool contains(const Key& key) const noexcept { return locate(key) != notFound; }
+
+		// Like std::map::insert, leaves an existing entry alone and returns false
+		bool insert(const Key& key, Value value)
+		{
+			auto [slot, inserted] = claimSlot(key);
+			if (inserted)
+			{
+				slots[slot].second = std::move(value);
+			}
+			return inserted;
+		}
+
+		Value& operator[](const Key& key) { return slots[claimSlot(key).first].second; }
+
+		bool erase(const Key& key)
+		{
+			size_t hole = locate(key);
+			if (hole == notFound)
+			{
+				return false;
+			}
+
+			// shift back any later entries of the same probe run, so that no lookup stops at the hole
+			const size_t mask = slots.size() - 1;
+			for (size_t slot = (hole + 1) & mask; used[slot]; slot = (slot + 1) & mask)
+			{
+				const size_t home = homeSlot(slots[slot].first);
+				if (((slot - home) & mask) >= ((slot - hole) & mask))
+				{
+					slots[hole] = std::move(slots[slot]);
+					hole = slot;
+				}
+			}
+			slots[hole] = std::pair<Key, Value>{};
+			used[hole] = false;
+			entryCount--;
+			return true;
+		}
+
+	private:
+		static constexpr size_t minimumCapacity = 16;
+		static constexpr size_t maxLoadNumerator = 3;	// rehash when more than 3/4 full
+		static constexpr size_t maxLoadDenominator = 4;
+		static constexpr size_t notFound = static_cast<size_t>(-1);
+
+		size_t homeSlot(const Key& key) const noexcept
+		{
+			const uint64_t hash = static_cast<uint64_t>(std::hash<Key>{}(key));
+			return static_cast<size_t>((hash * 11400714819323198485ull) >> shift);
+		}
+
+		size_t locate(const Key& key) const noexcept
+		{
+			if (entryCount == 0)
+			{
+				return notFound;
+			}
+
+			const size_t mask = slots.size() - 1;
+			for (size_t slot = homeSlot(key); used[slot]; slot = (slot + 1) & mask)
+			{
+				if (slots[slot].first == key)
+				{
+					return slot;
+				}
+			}
+			return notFound;
+		}
+
+		std::pair<size_t, bool> claimSlot(const Key& key)
+		{
+			if ((entryCount + 1) * maxLoadDenominator > slots.size() * maxLoadNumerator)
+			{
+				rehash(slots.empty() ? minimumCapacity : slots.size() * 2);
+			}
+
+			const size_t mask = slots.size() - 1;
+			size_t slot = homeSlot(key);
+			for (; used[slot]; slot = (slot + 1) & mask)
+			{
+				if (slots[slot].first == key)
+				{
+					return { slot, false };
+				}
+			}
+			slots[slot].first = key;
+			used[slot] = true;
+			entryCount++;
+			return { slot, true };
+		}
+
+		void rehash(size_t capacity)
+		{
+			std::vector<std::pair<Key, Value>> oldSlots(capacity);
+			std::vector<bool> oldUsed(capacity, false);
+			oldSlots.swap(slots);
+			oldUsed.swap(used);
+
+			shift = 64;
+			for (size_t bits = capacity; bits > 1; bits >>= 1)
+			{
+				shift--;
+			}
+
+			const size_t mask = capacity - 1;
+			for (size_t oldSlot = 0; oldSlot < oldSlots.size(); oldSlot++)
+			{
+				if (!oldUsed[oldSlot])
+				{
+					continue;
+				}
+				size_t slot = homeSlot(oldSlots[oldSlot].first);
+				while (used[slot])
+				{
+					slot = (slot + 1) & mask;
+				}
+				slots[slot] = std::move(oldSlots[oldSlot]);
+				used[slot] = true;
+			}
+		}
+
+		std::vector<std::pair<Key, Value>> slots;
+		std::vector<bool> used;
+		size_t entryCount = 0;
+		unsigned int shift = 64;	// 64 - log2(capacity), taking the top bits of the product
+};
+
+}
+
+
+
+#endif // FLAT_HASH_MAP_H
@@ -23,16 +23,20 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 #include "OSCompatibilityLayer.h"
 #include "Log.h"
+#include "SingleByteTranscoder.h"
 #include <cstdarg>
 #include <cstring>
 #include <iostream>
 #include <algorithm>
 #include <set>
+#include <vector>
 
 #include <unistd.h>
 #include <errno.h>
 #include <dirent.h>
 #include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/sendfile.h>
@@ -783,242 +787,272 @@ namespace Utils
                }
 	}
 
-	/*
-	* Forward declarations for conversion helper function and types
-	*/
-	class ConversionInputBuffer;
-
-	class ConversionOutputBuffer;
-
-	bool ConvertString(const char *toCode, const char *fromCode, ConversionInputBuffer &in, ConversionOutputBuffer &out);
-
-	/*	
-	* helper class to copy buffer from string and keep track of remainder and current position
-	*/
-	class ConversionInputBuffer
+	mappedFile::mappedFile(const std::string& filename)
 	{
-        	char *data;
-		char *in_buffer;
-		std::size_t remainder;
-	public:
-		explicit ConversionInputBuffer(const std::string &input) : data(new char[input.length()]), in_buffer(data), remainder(input.length())
+		int fileDescriptor = ::open(filename.c_str(), O_RDONLY);
+		if (fileDescriptor == -1)
 		{
-			using namespace std;
-			//POSIX iconv expects a pointer to char *, not to const char * and consequently does not guarantee that the input sequence is not modified so we copy it into the buffer before attempting conversion
-			copy(input.begin(), input.end(), data);
-		};
-		
-		template<typename String> explicit ConversionInputBuffer(const String &input){
-			typedef typename String::value_type Char;
-			using namespace std;
-			remainder = sizeof(Char) * input.length();
-			data = new char[remainder];
-			in_buffer = data;
-			const char *input_str = reinterpret_cast<const char *>(input.c_str());
-			copy(input_str, input_str + remainder, data);
-		};
+			return;
+		}
 
-		~ConversionInputBuffer()
+		struct stat fileStatus;
+		if ((fstat(fileDescriptor, &fileStatus) != 0) || !S_ISREG(fileStatus.st_mode))
 		{
-			delete[] data;
-		};
+			::close(fileDescriptor);
+			return;
+		}
 
-		bool has_remaining_bytes() const
+		if (fileStatus.st_size > 0)
 		{
-			return remainder != 0;
-		};
-
-		friend bool ConvertBuffer(const char *, const char *, ConversionInputBuffer &, ConversionOutputBuffer &); 
-	private:
-		//declared private to avoid copy of buffer
-		//unsure if versions pre c++11  should be supported, if not, copy constructors can be explicitly deleted
-		ConversionInputBuffer(const ConversionInputBuffer &); 
-		ConversionInputBuffer &operator=(const ConversionInputBuffer &); 
+			void* mapping = mmap(nullptr, fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+			if (mapping == MAP_FAILED)
+			{
+				::close(fileDescriptor);
+				return;
+			}
+			madvise(mapping, fileStatus.st_size, MADV_SEQUENTIAL);
+			data = static_cast<const char*>(mapping);
+			size = fileStatus.st_size;
+		}
 
-	};
+		::close(fileDescriptor);
+		open = true;
+	}
 
-	/*
-	* helper class to manage buffer pointers and sizes while providing access to internal buffers for use in iconv functions
-	*/
-	class ConversionOutputBuffer
-	{   
-		std::size_t size;
-		std::size_t block_size;
-		std::size_t remainder;
-		char *data = nullptr;
-		char *out_buffer = nullptr;
-
-		template<typename String> struct OutputStrHelper{
-			
-			typedef typename String::value_type Char;
-			
-			static void str(String &output, char *buffer, std::size_t length){
-				using namespace std;
-				const Char *output_buffer = reinterpret_cast<const Char *>(buffer);
-				size_t output_length = length / sizeof(Char);
-				output.assign(output_buffer,output_length);
-			};
-		
-		};
-		
-		template<typename Traits, typename Alloc> struct OutputStrHelper<std::basic_string<char, Traits, Alloc> >{
-			
-			static void str(std::basic_string<char, Traits, Alloc> &output, char *buffer, std::size_t length){
-				using namespace std;
-				output.assign(buffer, length);
-			};
-		};
-		
-	public:
-		explicit ConversionOutputBuffer(std::size_t initial_size = 0, std::size_t increment_block_size = 1024*1024) : size(initial_size), remainder(initial_size), block_size(increment_block_size)
+	mappedFile::~mappedFile()
+	{
+		if (data != nullptr)
 		{
-			if(size != 0)
-			{ 
-				data = new char[size];
-				out_buffer = data;
-			}
-		};
+			munmap(const_cast<char*>(data), size);
+		}
+	}
 
-		~ConversionOutputBuffer()
+	std::optional<fileStamp> getFileStamp(const std::string& path)
+	{
+		struct stat fileStatus;
+		if ((stat(path.c_str(), &fileStatus) != 0) || !S_ISREG(fileStatus.st_mode))
 		{
-			delete[] data;
-		};
+			return std::nullopt;
+		}
 
-		bool full() const
-		{
-			return remainder != 0;
-		};
+		fileStamp stamp;
+		stamp.size = static_cast<uint64_t>(fileStatus.st_size);
+		stamp.lastWriteTime = static_cast<uint64_t>(fileStatus.st_mtim.tv_sec) * 1000000000 + fileStatus.st_mtim.tv_nsec;
+		return stamp;
+	}
 
-		size_t length() const
+	uint64_t getCurrentProcessID()
+	{
+		return static_cast<uint64_t>(getpid());
+	}
+
+	uint64_t getProcessCPUMicroseconds()
+	{
+		rusage usage;
+		if (getrusage(RUSAGE_SELF, &usage) != 0)
 		{
-			return size-remainder;
+			return 0;
+		}
+		auto toMicroseconds = [](const timeval& time) {
+			return static_cast<uint64_t>(time.tv_sec) * 1000000 + time.tv_usec;
 		};
+		return toMicroseconds(usage.ru_utime) + toMicroseconds(usage.ru_stime);
+	}
 
-		std::string str() const
+	uint64_t getPeakResidentBytes()
+	{
+		rusage usage;
+		if (getrusage(RUSAGE_SELF, &usage) != 0)
 		{
-			using namespace std;
-			return string(data, data+length());
-		};
+			return 0;
+		}
+		return static_cast<uint64_t>(usage.ru_maxrss) * 1024;	// Linux reports kilobytes
+	}
 
-		template<typename String> void str(String &output) const{
-			OutputStrHelper<String>::str(output, data, length());
-		};
+	/*
+	* iconv descriptors, opened once per thread for each pair of encodings and reused, as opening
+	* one costs far more than converting a typical string
+	*/
+	class ConversionDescriptors
+	{
+	public:
+		ConversionDescriptors() = default;
+		ConversionDescriptors(const ConversionDescriptors&) = delete;
+		ConversionDescriptors& operator=(const ConversionDescriptors&) = delete;
 
-		bool ensure_capacity(std::size_t capacity)
+		~ConversionDescriptors()
 		{
-			using namespace std;
-			if(size < capacity)
+			for (auto& cached: descriptors)
 			{
-				size_t len = length();
-				char *ndata = new char[capacity];
-				copy(data, data+len, ndata);
-				delete[] data;
-				data = ndata;
-				out_buffer = data+len;
-				remainder+=(capacity-size);
-				size = capacity;
-				return true;
-			}else{
-				return false;
+				iconv_close(cached.descriptor);
 			}
-		};
+		}
 
-		bool grow()
+		// a descriptor in its initial state, or (iconv_t)(-1) if the conversion isn't supported
+		iconv_t get(const char *fromCode, const char *toCode)
 		{
-			return ensure_capacity(size+block_size);
-		};
+			for (auto& cached: descriptors)
+			{
+				if ((cached.fromCode == fromCode) && (cached.toCode == toCode))
+				{
+					iconv(cached.descriptor, nullptr, nullptr, nullptr, nullptr);
+					return cached.descriptor;
+				}
+			}
+
+			iconv_t descriptor = iconv_open(toCode, fromCode);
+			if (descriptor != ((iconv_t)(-1)))
+			{
+				descriptors.push_back({ fromCode, toCode, descriptor });
+			}
+			return descriptor;
+		}
 
-		friend bool ConvertBuffer(const char *, const char *, ConversionInputBuffer &, ConversionOutputBuffer &);
 	private:
-		//declared private to avoid copy of buffer
-		//unsure if versions pre c++11  should be supported, if not, copy constructors can be explicitly deleted
-		ConversionOutputBuffer(const ConversionOutputBuffer &);
-		ConversionOutputBuffer &operator=(const ConversionOutputBuffer &);
+		struct CachedDescriptor
+		{
+			std::string fromCode;
+			std::string toCode;
+			iconv_t descriptor;
+		};
+
+		std::vector<CachedDescriptor> descriptors;
 	};
 
-	bool ConvertBuffer(const char *fromCode, const char *toCode, ConversionInputBuffer &from, ConversionOutputBuffer &to)
+	thread_local ConversionDescriptors conversionDescriptors;
+
+	/*
+	* Converts from and appends the result to to. On failure to is left as it was.
+	*/
+	bool ConvertBuffer(const char *fromCode, const char *toCode, std::string_view from, std::string &to)
 	{
 		using namespace std;
-		iconv_t descriptor = iconv_open(toCode, fromCode);
+		iconv_t descriptor = conversionDescriptors.get(fromCode, toCode);
 		if(descriptor == ((iconv_t)(-1)))
 		{
 			LOG(LogLevel::Error) << "unable to recode string from '" << fromCode << "' to '" << toCode << ": not supported on this system";
 			return false;
 		}
-		while(from.has_remaining_bytes())
+
+		//POSIX iconv takes a char * input, but only ever reads through it
+		char *in_buffer = const_cast<char *>(from.data());
+		size_t in_remainder = from.size();
+
+		const size_t original_length = to.size();
+		size_t written = original_length;
+		to.resize(original_length + from.size() + from.size() / 2 + 16);
+		while(in_remainder != 0)
 		{
-			if(iconv(descriptor, &from.in_buffer, &from.remainder, &to.out_buffer, &to.remainder) == ((size_t)(-1)))
+			char *out_buffer = &to[written];
+			size_t out_remainder = to.size() - written;
+			const size_t result = iconv(descriptor, &in_buffer, &in_remainder, &out_buffer, &out_remainder);
+			written = to.size() - out_remainder;
+			if(result == ((size_t)(-1)))
 			{
 				switch(errno)
 				{
 					case E2BIG:
-						to.grow();
+						to.resize(to.size() * 2);
 						break;
 					case EILSEQ:
 						LOG(LogLevel::Error) << "invalid input sequence encountered during conversion from " << fromCode << " to " << toCode;
+						to.resize(original_length);
 						return false;
 					case EINVAL:
 						LOG(LogLevel::Error) << "incomplete input sequence encountered during conversion from " << fromCode << " to " << toCode;
+						to.resize(original_length);
+						return false;
+					default:
+						LOG(LogLevel::Error) << "unable to recode string from '" << fromCode << "' to '" << toCode << "'";
+						to.resize(original_length);
 						return false;
 				}
 			}
 		}
-		iconv_close(descriptor);
+		to.resize(written);
+		return true;
+	}
+
+	bool isASCII(std::string_view text)
+	{
+		size_t position = 0;
+		for (; position + sizeof(uint64_t) <= text.size(); position += sizeof(uint64_t))
+		{
+			uint64_t block;
+			memcpy(&block, text.data() + position, sizeof(block));
+			if ((block & 0x8080808080808080ULL) != 0)
+			{
+				return false;
+			}
+		}
+		for (; position < text.size(); position++)
+		{
+			if (static_cast<unsigned char>(text[position]) >= 0x80)
+			{
+				return false;
+			}
+		}
 		return true;
 	}
 
 	/*
-	* InputString and OutputString should be instantiations of basic_string, or have a similar API
-	* InputString should implement:
-	* member type value_type
-	* member function value_type begin() const
-	* member function value_type end() const
-	* member function size_t length() const
-	*
+	* For conversions between encodings that all agree with ASCII, where ASCII text needs no conversion at all
 	*/
-	template<typename InputString, typename OutputString> bool ConvertString(const char *fromCode, const char *toCode, const InputString &from, OutputString &to, std::size_t to_buffer_size = 0)
+	void AppendConvertedBytes(const char *fromCode, const char *toCode, std::string_view from, std::string &to)
 	{
-		using namespace std;
-		if(to_buffer_size == 0)
+		if (isASCII(from))
 		{
-			to_buffer_size = from.length();
+			to.append(from);
+			return;
 		}
-		ConversionInputBuffer from_buffer(from);
-		ConversionOutputBuffer to_buffer(to_buffer_size);
-		if(ConvertBuffer(fromCode, toCode, from_buffer, to_buffer))
+		ConvertBuffer(fromCode, toCode, from, to);
+	}
+
+	std::string ConvertBytes(const char *fromCode, const char *toCode, std::string_view from)
+	{
+		if (isASCII(from))
 		{
-			to_buffer.str(to);
-			return true;
-		}else{
-			return false;
+			return std::string(from);
 		}
+		std::string to;
+		ConvertBuffer(fromCode, toCode, from, to);
+		return to;
 	}
-	
-	template<typename InputString, typename OutputString> OutputString ConvertString(const char *fromCode, const char *toCode, const InputString &from, std::size_t to_buffer_size = 0)
+
+	/*
+	* The system dependent wchar_t encoding is handled as raw bytes either side of iconv
+	*/
+	std::wstring ConvertToWide(const char *fromCode, std::string_view from)
 	{
-		using namespace std;
-		OutputString to;
-		ConvertString(fromCode, toCode, from, to, to_buffer_size);
+		std::string bytes;
+		if (!ConvertBuffer(fromCode, "wchar_t", from, bytes))
+		{
+			return std::wstring();
+		}
+		return std::wstring(reinterpret_cast<const wchar_t *>(bytes.data()), bytes.size() / sizeof(wchar_t));
+	}
+
+	std::string ConvertFromWide(const char *toCode, const std::wstring &from)
+	{
+		std::string to;
+		ConvertBuffer("wchar_t", toCode, std::string_view(reinterpret_cast<const char *>(from.data()), from.size() * sizeof(wchar_t)), to);
 		return to;
 	}
 
 	std::string convertUTF8ToASCII(const std::string& UTF8)
 	{
-	        using namespace std;
-		return ConvertString<string, string>("UTF-8", "ASCII", UTF8);
+		return ConvertBytes("UTF-8", "ASCII", UTF8);
 	}
 
 	std::string convertUTF8To8859_15(const std::string& UTF8)
 	{
-		using namespace std;
-		return ConvertString<string, string>("UTF−8", "ISO−8859−15", UTF8);
+		return ConvertBytes("UTF-8", "ISO-8859-15", UTF8);
 	}
 	
 
 	std::string convertUTF8ToWin1252(const std::string& UTF8)
 	{
-		using namespace std;
-		return ConvertString<string, string>("UTF−8", "CP1252", UTF8);
+		return ConvertBytes("UTF-8", "CP1252", UTF8);
 	}
 
 
@@ -1028,14 +1062,14 @@ namespace Utils
 	*/
 	std::string convertUTF16ToUTF8(const std::wstring& UTF16)
 	{
-		using namespace std;
-		return ConvertString<wstring, string>("wchar_t", "UTF-8", UTF16);
+		return ConvertFromWide("UTF-8", UTF16);
 	}
 
 	std::string convert8859_15ToUTF8(const std::string& input)
 	{
-		using namespace std;
-		return ConvertString<string, string>("ISO−8859−15", "UTF-8", input);
+		std::string UTF8;
+		commonItems::appendAsUTF8(input, commonItems::singleByteEncoding::ISO8859_15, UTF8);
+		return UTF8;
 	}
 
 	/*
@@ -1045,21 +1079,20 @@ namespace Utils
 	*/
 	std::wstring convert8859_15ToUTF16(const std::string& UTF8)
 	{
-		using namespace std;
-		return ConvertString<string, wstring>("ISO−8859−15", "wchar_t", UTF8);
+		return ConvertToWide("ISO-8859-15", UTF8);
 	}
 	
 	std::string convertWin1252ToUTF8(const std::string& Win1252)
 	{
-		using namespace std;
-		return ConvertString<string, string>("CP1252", "UTF-8", Win1252);
+		std::string UTF8;
+		commonItems::appendAsUTF8(Win1252, commonItems::singleByteEncoding::Win1252, UTF8);
+		return UTF8;
 	}
 
 
 	std::wstring convertWin1252ToUTF16(const std::string& Win1252)
 	{
-		using namespace std;
-		return ConvertString<string, wstring>("CP1252", "wchar_t", Win1252);
+		return ConvertToWide("CP1252", Win1252);
 	}
 
 	/*
@@ -1069,15 +1102,33 @@ namespace Utils
 	*/
 	std::wstring convertUTF8ToUTF16(const std::string& UTF8)
 	{
-		using namespace std;
-		return ConvertString<string, wstring>("UTF-8", "wchar_t",UTF8);
+		return ConvertToWide("UTF-8", UTF8);
 	}
 
 	
 	std::string convertToUTF8(const std::wstring& input)
 	{
-		using namespace std;
-		return ConvertString<wstring, string>("wchar_t", "UTF-8",input);
+		return ConvertFromWide("UTF-8", input);
+	}
+
+	void appendUTF8To8859_15(std::string_view UTF8, std::string& output)
+	{
+		AppendConvertedBytes("UTF-8", "ISO-8859-15", UTF8, output);
+	}
+
+	void appendUTF8ToWin1252(std::string_view UTF8, std::string& output)
+	{
+		AppendConvertedBytes("UTF-8", "CP1252", UTF8, output);
+	}
+
+	void append8859_15ToUTF8(std::string_view input, std::string& output)
+	{
+		commonItems::appendAsUTF8(input, commonItems::singleByteEncoding::ISO8859_15, output);
+	}
+
+	void appendWin1252ToUTF8(std::string_view Win1252, std::string& output)
+	{
+		commonItems::appendAsUTF8(Win1252, commonItems::singleByteEncoding::Win1252, output);
 	}
 
 	std::string normalizeUTF8Path(const std::string& utf_8_path){
@@ -23,10 +23,15 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 #include "Log.h"
 #include "OSCompatibilityLayer.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
 #include <ctime>
 #include <fstream>
 #include <iostream>
-#include <map>
+#include <mutex>
+#include <thread>
 
 
 
@@ -34,52 +39,269 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
-Log::Log(LogLevel level)
-: logLevel(level)
+namespace
+{
+
+// a function rather than a map, so it still works for messages logged as statics are destroyed
+const char* getLogLevelString(LogLevel level)
 {
-	static bool logFileCreated = false;	// whether or not the log file has been created this run of the converter
-	if (!logFileCreated)
+	switch (level)
 	{
-		std::ofstream logFile("log.txt", std::ofstream::trunc);
-		logFileCreated = true;
-		logFile.close();
+		case LogLevel::Error:
+			return "  [ERROR] ";
+		case LogLevel::Warning:
+			return "[WARNING] ";
+		case LogLevel::Info:
+			return "   [INFO] ";
+		case LogLevel::Debug:
+		default:
+			return "  [DEBUG]     ";
 	}
 }
 
 
-Log::~Log()
+// Messages are handed to a background thread that owns the log file and the console, so logging
+// from a busy loop or a worker thread never waits on either. Producers push onto a lock-free stack,
+// and the writer takes everything queued at once and writes it as one batch with a single flush.
+// An Error waits until it has been written, in case the converter is about to stop. Everything
+// still queued is written at exit, after which messages are written directly.
+class logWriter
 {
-	logMessageStream << std::endl;
-	std::string logMessage = logMessageStream.str();
-	Utils::WriteToConsole(logLevel, logMessage);
-	WriteToFile(logLevel, logMessage);
-}
+	public:
+		static logWriter& get()
+		{
+			static logWriter* theWriter = []()	// never destroyed, so objects logging from their destructors are safe
+			{
+				auto writer = new logWriter;
+				std::atexit([]() { get().stop(); });
+				return writer;
+			}();
+			return *theWriter;
+		}
+
+		void write(LogLevel level, std::string message)
+		{
+			bool written = false;
+			auto entry = new queuedMessage{ level, time(nullptr), std::move(message), nullptr, (level == LogLevel::Error) ? &written : nullptr };
+
+			if (stopped)
+			{
+				std::lock_guard<std::mutex> lock(writeMutex);
+				writeMessage(*entry);
+				flush();
+				delete entry;
+				return;
+			}
+
+			entry->next = queue.load(std::memory_order_relaxed);
+			while (!queue.compare_exchange_weak(entry->next, entry))
+			{
+			}
+			if (stopped)	// the writer stopped while this was being queued
+			{
+				writeQueue();
+			}
+			else if (writerWaiting)
+			{
+				std::lock_guard<std::mutex> lock(wakeMutex);
+				wakeup.notify_one();
+			}
+
+			if (level == LogLevel::Error)
+			{
+				std::unique_lock<std::mutex> lock(wakeMutex);
+				messageWritten.wait(lock, [&written]() { return written; });
+			}
+		}
+
+	private:
+		struct queuedMessage
+		{
+			LogLevel level;
+			time_t time;
+			std::string text;
+			queuedMessage* next;
+			bool* written;	// set once written, for a producer waiting on it
+		};
+
+		logWriter():
+			logFile("log.txt", std::ofstream::trunc),	// the log file is created once per run of the converter
+			writerThread([this]() { writeQueuedMessages(); })
+		{
+		}
+
+		void stop()
+		{
+			{
+				std::lock_guard<std::mutex> lock(wakeMutex);
+				stopping = true;
+				wakeup.notify_one();
+			}
+			writerThread.join();
+			stopped = true;
+			writeQueue();
+		}
+
+		void writeQueuedMessages()
+		{
+			while (true)
+			{
+				if (writeQueue())
+				{
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock(wakeMutex);
+				if (stopping)
+				{
+					if (queue == nullptr)
+					{
+						return;
+					}
+					continue;
+				}
+				writerWaiting = true;
+				wakeup.wait_for(lock, std::chrono::milliseconds(100), [this]() { return stopping || (queue != nullptr); });
+				writerWaiting = false;
+			}
+		}
+
+		bool writeQueue()
+		{
+			if (auto batch = takeQueue())
+			{
+				writeBatch(batch);
+				return true;
+			}
+			return false;
+		}
+
+		// the queued messages, oldest first
+		queuedMessage* takeQueue()
+		{
+			queuedMessage* newestFirst = queue.exchange(nullptr);
+			queuedMessage* oldestFirst = nullptr;
+			while (newestFirst != nullptr)
+			{
+				auto next = newestFirst->next;
+				newestFirst->next = oldestFirst;
+				oldestFirst = newestFirst;
+				newestFirst = next;
+			}
+			return oldestFirst;
+		}
+
+		void writeBatch(queuedMessage* batch)
+		{
+			bool hasWaiters = false;
+			{
+				std::lock_guard<std::mutex> lock(writeMutex);
+				for (auto entry = batch; entry != nullptr; entry = entry->next)
+				{
+					writeMessage(*entry);
+					hasWaiters |= (entry->written != nullptr);
+				}
+				flush();
+			}
+
+			std::lock_guard<std::mutex> lock(wakeMutex);
+			while (batch != nullptr)
+			{
+				auto next = batch->next;
+				if (batch->written != nullptr)
+				{
+					*batch->written = true;
+				}
+				delete batch;
+				batch = next;
+			}
+			if (hasWaiters)
+			{
+				messageWritten.notify_all();
+			}
+		}
+
+		void writeMessage(const queuedMessage& entry)
+		{
+			Utils::WriteToConsole(entry.level, entry.text);
+			writeTheTime(entry.time);
+			logFile << getLogLevelString(entry.level);
+			logFile << entry.text;
+		}
+
+		void writeTheTime(time_t rawtime)
+		{
+			if (rawtime != formattedTime)
+			{
+				formattedTime = rawtime;
+				const tm* timeInfo = localtime(&rawtime);
+				char timeBuffer[64];
+				const size_t bytesWritten = strftime(timeBuffer, sizeof(timeBuffer), "%Y-%m-%d %H:%M:%S ", timeInfo);
+				timeString.assign(timeBuffer, bytesWritten);
+			}
+			logFile << timeString;
+		}
+
+		void flush()
+		{
+			logFile.flush();
+			std::cout.flush();
+		}
 
+		std::ofstream logFile;
+		time_t formattedTime = 0;
+		std::string timeString;
+		std::mutex writeMutex;	// the file and console, for messages written directly after stopping
 
-static const std::map<LogLevel, std::string> logLevelStrings = {
-	{LogLevel::Error, "  [ERROR] "},
-	{LogLevel::Warning, "[WARNING] "},
-	{LogLevel::Info, "   [INFO] "},
-	{LogLevel::Debug, "  [DEBUG]     "}
+		std::atomic<queuedMessage*> queue{ nullptr };
+		std::mutex wakeMutex;
+		std::condition_variable wakeup;
+		std::condition_variable messageWritten;
+		std::atomic<bool> writerWaiting{ false };
+		bool stopping = false;
+		std::atomic<bool> stopped{ false };
+
+		std::thread writerThread;	// last, so everything it uses exists before it starts
 };
-void Log::WriteToFile(LogLevel level, const std::string& logMessage)
+
+}
+
+
+
+Log::Log(LogLevel level)
+: logLevel(level)
+{
+}
+
+
+Log::~Log()
 {
-	std::ofstream logFile("log.txt", std::ofstream::app);
-	WriteTheTime(logFile);
-	logFile << logLevelStrings.find(level)->second;
-	logFile << logMessage;
+	logMessageStream << std::endl;
+	logWriter::get().write(logLevel, logMessageStream.str());
 }
 
 
-void Log::WriteTheTime(std::ofstream& logFile)
+bool Log::setLevel(const std::string& levelName)
 {
-	time_t rawtime;
-	time(&rawtime);
-	const tm* timeInfo = localtime(&rawtime);
-	char timeBuffer[64];
-	const size_t bytesWritten = strftime(timeBuffer, sizeof(timeBuffer), "%Y-%m-%d %H:%M:%S ", timeInfo);
-	if (bytesWritten != 0)
+	if (levelName == "error")
+	{
+		setLevel(LogLevel::Error);
+	}
+	else if (levelName == "warning")
+	{
+		setLevel(LogLevel::Warning);
+	}
+	else if (levelName == "info")
+	{
+		setLevel(LogLevel::Info);
+	}
+	else if (levelName == "debug")
+	{
+		setLevel(LogLevel::Debug);
+	}
+	else
 	{
-		logFile << timeBuffer;
+		return false;
 	}
+	return true;
 }
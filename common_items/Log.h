@@ -26,12 +26,20 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
+#include <atomic>
 #include <sstream>
 #include <string>
 
 
 
-#define LOG(LOG_LEVEL) Log(LOG_LEVEL)
+// Messages more verbose than this level are compiled out entirely. The Release configurations define
+// it as LogLevel::Info to strip every Debug message; by default everything is compiled in.
+#ifndef LOG_COMPILED_LEVEL
+#define LOG_COMPILED_LEVEL LogLevel::Debug
+#endif
+
+// A disabled level short-circuits here, so neither the Log object nor any of the << arguments are evaluated
+#define LOG(LOG_LEVEL) if (!Log::isEnabled(LOG_LEVEL)) {} else Log(LOG_LEVEL)
 
 
 
@@ -55,6 +63,13 @@ class Log
 		Log(Log&&) = delete;
 		Log operator=(Log&&) = delete;
 
+		static bool isEnabled(LogLevel level)
+		{
+			return (level <= LOG_COMPILED_LEVEL) && (level <= currentLevel.load(std::memory_order_relaxed));
+		}
+		static void setLevel(LogLevel level) { currentLevel.store(level, std::memory_order_relaxed); }
+		static bool setLevel(const std::string& levelName); // returns false and leaves the level alone for an unknown name
+
 		template<class T>	Log& operator<<(T t)
 		{
 			logMessageStream << t;
@@ -62,8 +77,7 @@ class Log
 		}
 
 	private:
-		static void WriteToFile(LogLevel, const std::string& logMessage);
-		static void WriteTheTime(std::ofstream& logFile);
+		static inline std::atomic<LogLevel> currentLevel{ LogLevel::Debug };
 
 		LogLevel logLevel;
 		std::ostringstream logMessageStream;
@@ -22,19 +22,13 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 #include "NewParserToOldParserConverters.h"
+#include "newParser.h"
 #include "ParadoxParser8859_15.h"
 #include "ParadoxParserUTF8.h"
 #include <sstream>
 
 
 
-namespace commonItems
-{
-	std::string getNextLexeme(std::istream& theStream);
-}
-
-
-
 std::shared_ptr<Object> commonItems::convert8859Object(const std::string& top, std::istream& theStream)
 {
 	std::stringstream objectStream;
@@ -31,6 +31,7 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 #include <stdint.h>
 #include <set>
 #include <string>
+#include <string_view>
 #include "Log.h"
 
 
@@ -104,6 +105,47 @@ namespace Utils
 
 	bool deleteFolder(const std::string& folder);
 
+	// A read-only view of a file's contents, mapped into memory rather than read through a stream.
+	// The contents stay valid for the lifetime of the object. Reports !isOpen() if the file could
+	// not be mapped.
+	class mappedFile
+	{
+		public:
+			explicit mappedFile(const std::string& filename);
+			~mappedFile();
+			mappedFile(const mappedFile&) = delete;
+			mappedFile& operator=(const mappedFile&) = delete;
+			mappedFile(mappedFile&&) = delete;
+			mappedFile& operator=(mappedFile&&) = delete;
+
+			bool isOpen() const noexcept { return open; }
+			std::string_view getContents() const noexcept { return std::string_view(data, size); }
+
+		private:
+			const char* data = nullptr;
+			size_t size = 0;
+			bool open = false;
+	};
+
+
+	// A file's size and last write time, which between them show whether it has changed since an earlier run
+	struct fileStamp
+	{
+		uint64_t size = 0;
+		uint64_t lastWriteTime = 0;	// in platform-specific units
+	};
+	// Reports nullopt if the file does not exist or cannot be examined
+	std::optional<fileStamp> getFileStamp(const std::string& path);
+
+	// The ID of this process, which no other running process shares, so it can name temporary files
+	uint64_t getCurrentProcessID();
+
+
+	// The CPU time (user and kernel, across all threads) the process has used so far, in microseconds
+	uint64_t getProcessCPUMicroseconds();
+	// The most physical memory the process has held at any one time, in bytes
+	uint64_t getPeakResidentBytes();
+
 
 	std::optional<std::string> GetFileFromTag(const std::string& directoryPath, const std::string& tag);
 
@@ -122,6 +164,13 @@ namespace Utils
 	// converts a string in the system dependent wchar_t encoding to UTF-8
 	std::string convertToUTF8(const std::wstring &input);
 
+	// As the conversions above, but appending to output, so a caller converting many strings can
+	// reuse one buffer. Text that is pure ASCII is copied across unconverted.
+	void appendUTF8To8859_15(std::string_view UTF8, std::string& output);
+	void appendUTF8ToWin1252(std::string_view UTF8, std::string& output);
+	void append8859_15ToUTF8(std::string_view input, std::string& output);
+	void appendWin1252ToUTF8(std::string_view Win1252, std::string& output);
+
 	//converts an UTF8 path to the system dependent filesystem path encoding
 	std::string normalizeUTF8Path(const std::string &utf_8_path);
 
@@ -57,6 +57,20 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
+namespace
+{
+
+struct keyOrder
+{
+	bool operator()(const std::shared_ptr<Object>& lhs, const std::shared_ptr<Object>& rhs) const { return lhs->getKeyView() < rhs->getKeyView(); }
+	bool operator()(const std::shared_ptr<Object>& lhs, const std::string& rhs) const { return lhs->getKeyView() < rhs; }
+	bool operator()(const std::string& lhs, const std::shared_ptr<Object>& rhs) const { return lhs < rhs->getKeyView(); }
+};
+
+}
+
+
+
 Object::~Object()
 {
 }
@@ -68,7 +82,9 @@ Object::Object(std::shared_ptr<Object> other):
 	objects(),
 	leaf(other->leaf),
 	isObjList(other->isObjList),
-	tokens()
+	tokens(),
+	keyIndex(),
+	keyIndexBuilt(false)
 {
 	for (auto i: other->objects)
 	{
@@ -88,6 +104,7 @@ void Object::setValue(std::shared_ptr<Object> val)
 {
 	objects.push_back(val);
 	leaf = false;
+	invalidateKeyIndex();
 }
 
 
@@ -102,6 +119,7 @@ void Object::unsetValue(const std::string& val)
 		i = objects.back();
 		objects.pop_back();
 	}
+	invalidateKeyIndex();
 }
 
 
@@ -116,6 +134,7 @@ void Object::setLeaf(std::string key, std::string val)
 void Object::setValue(const std::vector<std::shared_ptr<Object>>& val)
 {
 	objects = val;
+	invalidateKeyIndex();
 }
 
 
@@ -158,17 +177,28 @@ void Object::addToList(std::vector<std::string>::iterator begin, std::vector<std
 
 std::vector<std::shared_ptr<Object>> Object::getValue(const std::string& key) const
 {
-	std::vector<std::shared_ptr<Object>> ret;
+	objectRange values = getValueRange(key);
+	return std::vector<std::shared_ptr<Object>>(values.begin(), values.end());
+}
 
-	for (auto i: objects)
+
+objectRange Object::getValueRange(const std::string& key) const
+{
+	if (!keyIndexBuilt)
 	{
-		if (i->getKey() != key)
-		{
-			continue;
-		}
-		ret.push_back(i);
+		buildKeyIndex();
 	}
-	return ret;
+
+	auto values = std::equal_range(keyIndex.begin(), keyIndex.end(), key, keyOrder());
+	return objectRange(values.first, values.second);
+}
+
+
+void Object::buildKeyIndex() const
+{
+	keyIndex = objects;
+	std::stable_sort(keyIndex.begin(), keyIndex.end(), keyOrder());
+	keyIndexBuilt = true;
 }
 
 
@@ -218,8 +248,8 @@ std::vector<std::string> Object::getKeys()
 
 std::optional<std::string> Object::getLeaf(const std::string& leaf) const
 {
-	std::vector<std::shared_ptr<Object>> leaves = getValue(leaf); // the objects to return
-	if (0 == leaves.size())
+	objectRange leaves = getValueRange(leaf); // the objects to return
+	if (leaves.empty())
 	{
 		LOG(LogLevel::Warning) << "Error: Cannot find leaf " << leaf << " in object\n" << *this;
 		return {};
@@ -345,12 +375,14 @@ void Object::removeObject(std::shared_ptr<Object> target)
 		return;
 	}
 	objects.erase(pos);
+	invalidateKeyIndex();
 }
 
 
 void Object::addObject(std::shared_ptr<Object> target)
 {
 	objects.push_back(target);
+	invalidateKeyIndex();
 }
 
 
@@ -371,6 +403,7 @@ void Object::addObjectAfter(std::shared_ptr<Object> target, const std::string& k
 	{
 		objects.push_back(target);
 	}
+	invalidateKeyIndex();
 }
 
 
@@ -418,16 +451,16 @@ void setFlt(std::string name, const double val, std::shared_ptr<Object> branch)
 
 double Object::safeGetFloat(const std::string& k, const double def)
 {
-	objvec vec = getValue(k);	// the objects with the keys to be returned
-	if (0 == vec.size()) return def;
+	objectRange vec = getValueRange(k);	// the objects with the keys to be returned
+	if (vec.empty()) return def;
 	return stof(vec[0]->getLeaf());
 }
 
 
 std::string Object::safeGetString(const std::string& k, std::string def)
 {
-	objvec vec = getValue(k);	// the objects with the strings to be returned
-	if (0 == vec.size())
+	objectRange vec = getValueRange(k);	// the objects with the strings to be returned
+	if (vec.empty())
 	{
 		return def;
 	}
@@ -437,8 +470,8 @@ std::string Object::safeGetString(const std::string& k, std::string def)
 
 int Object::safeGetInt(const std::string& k, const int def)
 {
-	objvec vec = getValue(k);	// the objects with the ints to be returned
-	if (0 == vec.size())
+	objectRange vec = getValueRange(k);	// the objects with the ints to be returned
+	if (vec.empty())
 	{
 		return def;
 	}
@@ -448,8 +481,8 @@ int Object::safeGetInt(const std::string& k, const int def)
 
 std::shared_ptr<Object> Object::safeGetObject(const std::string& k, std::shared_ptr<Object> def)
 {
-	objvec vec = getValue(k);	// the objects with the objects to be returned 
-	if (0 == vec.size())
+	objectRange vec = getValueRange(k);	// the objects with the objects to be returned 
+	if (vec.empty())
 	{
 		return def;
 	}
@@ -56,19 +56,44 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
+class Object;
+
+
+// A view of consecutive children sharing one key, valid until the owning Object is next modified
+class objectRange
+{
+	public:
+		using iterator = std::vector<std::shared_ptr<Object>>::const_iterator;
+
+		objectRange() = default;
+		objectRange(iterator first, iterator last): first(first), last(last) {}
+
+		iterator begin() const { return first; }
+		iterator end() const { return last; }
+		size_t size() const { return static_cast<size_t>(last - first); }
+		bool empty() const { return first == last; }
+		const std::shared_ptr<Object>& operator[](size_t index) const { return first[index]; }
+
+	private:
+		iterator first;
+		iterator last;
+};
+
+
 class Object
 {
 	  friend std::ostream& operator<< (std::ostream& o, const Object& i);
 
 	public:
-	  explicit Object(const std::string& k): key(k), strVal(), objects(), leaf(false), isObjList(false), tokens() {};
+	  explicit Object(const std::string& k): key(k), strVal(), objects(), leaf(false), isObjList(false), tokens(), keyIndex(), keyIndexBuilt(false) {};
 	  ~Object(); 
 	  explicit Object(std::shared_ptr<Object> other);
 
 	  std::string getKey() const { return key; }
+	  const std::string& getKeyView() const { return key; }
 	  std::string getLeaf() const { return strVal; }
-	  std::vector<std::shared_ptr<Object>> getLeaves() { return objects; }
-	  std::vector<std::string> getTokens() { return tokens; }
+	  const std::vector<std::shared_ptr<Object>>& getLeaves() const { return objects; }
+	  const std::vector<std::string>& getTokens() const { return tokens; }
 	  inline bool isLeaf() { return leaf; }
 
 	  void setObjList(const bool l = true) { isObjList = l; }
@@ -76,6 +101,7 @@ class Object
 	  std::optional<std::string> getLeaf(const std::string& leaf) const;
 	  std::vector<std::string> getKeys();
 	  std::vector<std::shared_ptr<Object>> getValue(const std::string& key) const;
+	  objectRange getValueRange(const std::string& key) const;
 	  std::optional<std::string> getToken(int index);
 	  int numTokens();
 	  double safeGetFloat(const std::string& k, double def = 0.0);
@@ -106,6 +132,12 @@ class Object
 		bool leaf;						// whether or not this is a leaf object
 		bool isObjList;					// whether or not this is an object list object
 		std::vector<std::string> tokens;		// The tokens if this is a list object 
+
+		void buildKeyIndex() const;
+		void invalidateKeyIndex() { keyIndex.clear(); keyIndexBuilt = false; }
+
+		mutable std::vector<std::shared_ptr<Object>> keyIndex;	// the sub-objects stably sorted by key, built on the first keyed lookup
+		mutable bool keyIndexBuilt;	// whether keyIndex reflects the current sub-objects
 };
 
 
@@ -0,0 +1,596 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+
+
+#include "ObjectTree.h"
+#include "Log.h"
+#include "newParser.h"
+#include "OSCompatibilityLayer.h"
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <sstream>
+#include <type_traits>
+
+
+
+static_assert(std::is_trivially_destructible_v<commonItems::objectNode>, "objectTree frees its nodes without destroying them");
+
+
+namespace
+{
+
+const size_t arenaBlockSize = 64 * 1024;
+
+
+bool isASCII(std::string_view text)
+{
+	return std::all_of(text.begin(), text.end(), [](const char character) { return (character & 0x80) == 0; });
+}
+
+
+std::string_view removeQuotes(std::string_view text)
+{
+	if (!text.empty() && (text.front() == '"'))
+	{
+		text.remove_prefix(1);
+		if (!text.empty() && (text.back() == '"'))
+		{
+			text.remove_suffix(1);
+		}
+	}
+	return text;
+}
+
+}
+
+
+
+// Reads the text for a tree with the new lexer, arranging it as the old parser's grammar would:
+// key = value, key = { key = value ... }, key = { token token ... } and key = { { ... } { ... } }
+class commonItems::objectTree::builder
+{
+	public:
+		builder(objectTree& theTree, std::istream& theStream):
+			tree(theTree),
+			stream(theStream),
+			textIsStable(dynamic_cast<bufferStreamBuffer*>(theStream.rdbuf()) != nullptr)
+		{
+			stream >> std::noskipws;
+		}
+
+		void readValue(objectNode& node);
+
+		std::string_view next();
+
+	private:
+		std::string_view peek();
+		std::string_view readLexeme();
+		std::string_view keep(std::string_view text);
+
+		void readBlock(objectNode& node);
+		void readObject(objectNode& node, std::optional<std::string_view> firstKey);
+		void readObjectList(objectNode& node);
+		void readTokens(objectNode& node, std::string_view firstToken);
+		void skipBlock();
+
+		objectNode* makeNode(std::string_view key);
+		template<typename Item> const Item* keepItems(std::vector<Item>& items, size_t start);
+
+		objectTree& tree;
+		std::istream& stream;
+		bool textIsStable;	// lexemes from a bufferStream point into its buffer, rather than into storage
+		std::string storage;
+		std::optional<std::string_view> peeked;
+
+		// the children and tokens of every block being read, innermost last
+		std::vector<const objectNode*> children;
+		std::vector<std::string_view> tokens;
+};
+
+
+std::string_view commonItems::objectTree::builder::readLexeme()
+{
+	if (stream.eof())
+	{
+		return {};
+	}
+	return keep(getNextLexemeView(stream, storage));
+}
+
+
+std::string_view commonItems::objectTree::builder::keep(std::string_view text)
+{
+	if (!isASCII(text))
+	{
+		return tree.copyText(Utils::convert8859_15ToUTF8(std::string(text)));
+	}
+	else if (!textIsStable)
+	{
+		return tree.copyText(text);
+	}
+	return text;
+}
+
+
+std::string_view commonItems::objectTree::builder::next()
+{
+	if (peeked)
+	{
+		auto lexeme = *peeked;
+		peeked.reset();
+		return lexeme;
+	}
+	return readLexeme();
+}
+
+
+std::string_view commonItems::objectTree::builder::peek()
+{
+	if (!peeked)
+	{
+		peeked = readLexeme();
+	}
+	return *peeked;
+}
+
+
+commonItems::objectNode* commonItems::objectTree::builder::makeNode(std::string_view key)
+{
+	auto node = tree.allocate<objectNode>(1);
+	return new (node) objectNode(tree, tree.internKey(key));
+}
+
+
+template<typename Item> const Item* commonItems::objectTree::builder::keepItems(std::vector<Item>& items, size_t start)
+{
+	auto kept = tree.allocate<Item>(items.size() - start);
+	std::copy(items.begin() + start, items.end(), kept);
+	items.resize(start);
+	return kept;
+}
+
+
+void commonItems::objectTree::builder::readValue(objectNode& node)
+{
+	auto value = next();
+	if (value == "{")
+	{
+		readBlock(node);
+	}
+	else
+	{
+		node.leaf = true;
+		node.value = removeQuotes(value);
+	}
+}
+
+
+void commonItems::objectTree::builder::readBlock(objectNode& node)
+{
+	auto first = peek();
+	if (first == "}")
+	{
+		next();
+	}
+	else if (first == "{")
+	{
+		readObjectList(node);
+	}
+	else if (!first.empty())
+	{
+		next();
+		if (peek() == "=")
+		{
+			readObject(node, first);
+		}
+		else
+		{
+			readTokens(node, first);
+		}
+	}
+}
+
+
+void commonItems::objectTree::builder::readObject(objectNode& node, std::optional<std::string_view> firstKey)
+{
+	const size_t start = children.size();
+	while (true)
+	{
+		std::string_view key;
+		if (firstKey)
+		{
+			key = *firstKey;
+			firstKey.reset();
+		}
+		else
+		{
+			key = next();
+		}
+
+		if (key.empty() || (key == "}"))
+		{
+			break;
+		}
+		else if (key == "{")
+		{
+			skipBlock();
+		}
+		else if ((key != "=") && (peek() == "="))
+		{
+			next();
+			auto child = makeNode(removeQuotes(key));
+			readValue(*child);
+			children.push_back(child);
+		}
+	}
+
+	node.childCount = children.size() - start;
+	node.children = keepItems(children, start);
+}
+
+
+void commonItems::objectTree::builder::readObjectList(objectNode& node)
+{
+	const size_t start = children.size();
+	while (true)
+	{
+		auto lexeme = next();
+		if (lexeme.empty() || (lexeme == "}"))
+		{
+			break;
+		}
+		else if (lexeme == "{")
+		{
+			auto element = makeNode("objlist");
+			element->isObjList = true;
+			readObject(*element, {});
+			children.push_back(element);
+		}
+	}
+
+	node.childCount = children.size() - start;
+	node.children = keepItems(children, start);
+}
+
+
+void commonItems::objectTree::builder::readTokens(objectNode& node, std::string_view firstToken)
+{
+	const size_t start = tokens.size();
+	tokens.push_back(removeQuotes(firstToken));
+	while (true)
+	{
+		auto token = next();
+		if (token.empty() || (token == "}"))
+		{
+			break;
+		}
+		else if (token == "{")
+		{
+			skipBlock();
+		}
+		else if (token != "=")
+		{
+			tokens.push_back(removeQuotes(token));
+		}
+	}
+
+	node.isObjList = true;
+	node.tokenCount = tokens.size() - start;
+	node.tokens = keepItems(tokens, start);
+}
+
+
+void commonItems::objectTree::builder::skipBlock()
+{
+	int braceDepth = 1;
+	while (braceDepth > 0)
+	{
+		auto lexeme = next();
+		if (lexeme.empty())
+		{
+			return;
+		}
+		else if (lexeme == "{")
+		{
+			braceDepth++;
+		}
+		else if (lexeme == "}")
+		{
+			braceDepth--;
+		}
+	}
+}
+
+
+commonItems::objectTree::objectTree(const std::string& top, std::istream& theStream)
+{
+	builder theBuilder(*this, theStream);
+
+	auto root = new (allocate<objectNode>(1)) objectNode(*this, internKey("topLevel"));
+	auto node = new (allocate<objectNode>(1)) objectNode(*this, internKey(copyText(top)));
+	if (theBuilder.next() == "=")
+	{
+		theBuilder.readValue(*node);
+	}
+
+	auto children = allocate<const objectNode*>(1);
+	children[0] = node;
+	root->children = children;
+	root->childCount = 1;
+	topLevel = root;
+}
+
+
+template<typename Type> Type* commonItems::objectTree::allocate(size_t count)
+{
+	const size_t size = sizeof(Type) * count;
+	auto padding = (alignof(Type) - (reinterpret_cast<uintptr_t>(blockPosition) % alignof(Type))) % alignof(Type);
+	if ((blockPosition == nullptr) || (padding + size > blockRemaining))
+	{
+		const size_t blockSize = std::max(arenaBlockSize, size + alignof(Type));
+		blocks.push_back(std::make_unique<char[]>(blockSize));
+		blockPosition = blocks.back().get();
+		blockRemaining = blockSize;
+		padding = (alignof(Type) - (reinterpret_cast<uintptr_t>(blockPosition) % alignof(Type))) % alignof(Type);
+	}
+
+	auto allocation = reinterpret_cast<Type*>(blockPosition + padding);
+	blockPosition += padding + size;
+	blockRemaining -= padding + size;
+	return allocation;
+}
+
+
+std::string_view commonItems::objectTree::copyText(std::string_view text)
+{
+	auto copy = allocate<char>(text.size());
+	std::memcpy(copy, text.data(), text.size());
+	return std::string_view(copy, text.size());
+}
+
+
+uint32_t commonItems::objectTree::internKey(std::string_view key)
+{
+	if (auto existing = keyIDs.find(key); existing != keyIDs.end())
+	{
+		return existing->second;
+	}
+
+	const auto ID = static_cast<uint32_t>(keyNames.size());
+	keyNames.push_back(key);
+	keyIDs.insert(std::make_pair(key, ID));
+	return ID;
+}
+
+
+std::optional<uint32_t> commonItems::objectTree::findKey(std::string_view key) const
+{
+	if (auto existing = keyIDs.find(key); existing != keyIDs.end())
+	{
+		return existing->second;
+	}
+	return {};
+}
+
+
+std::string_view commonItems::objectNode::getKeyView() const
+{
+	return tree->keyNames[keyID];
+}
+
+
+std::string commonItems::objectNode::getLeaf() const
+{
+	if (leaf || (tokenCount == 0))
+	{
+		return std::string(value);
+	}
+
+	// lists read back as their quoted items, "a" "b" "c", as in Object
+	std::string list;
+	for (size_t i = 0; i < tokenCount; i++)
+	{
+		list += (i == 0) ? "\"" : "\" \"";
+		list += tokens[i];
+	}
+	list += "\"";
+	return list;
+}
+
+
+std::vector<std::string> commonItems::objectNode::getTokens() const
+{
+	return std::vector<std::string>(tokens, tokens + tokenCount);
+}
+
+
+std::optional<std::string> commonItems::objectNode::getLeaf(const std::string& leaf) const
+{
+	auto leaves = getValue(leaf);
+	if (leaves.empty())
+	{
+		LOG(LogLevel::Warning) << "Error: Cannot find leaf " << leaf << " in object\n" << *this;
+		return {};
+	}
+	return leaves[0]->getLeaf();
+}
+
+
+std::vector<std::string> commonItems::objectNode::getKeys() const
+{
+	std::vector<std::string> keys;
+	std::vector<uint32_t> seen;
+	for (size_t i = 0; i < childCount; i++)
+	{
+		if (std::find(seen.begin(), seen.end(), children[i]->keyID) == seen.end())
+		{
+			seen.push_back(children[i]->keyID);
+			keys.push_back(children[i]->getKey());
+		}
+	}
+	return keys;
+}
+
+
+std::vector<const commonItems::objectNode*> commonItems::objectNode::getValue(const std::string& key) const
+{
+	std::vector<const objectNode*> matches;
+
+	auto ID = tree->findKey(key);
+	if (!ID)
+	{
+		return matches;
+	}
+
+	for (size_t i = 0; i < childCount; i++)
+	{
+		if (children[i]->keyID == *ID)
+		{
+			matches.push_back(children[i]);
+		}
+	}
+	return matches;
+}
+
+
+std::optional<std::string> commonItems::objectNode::getToken(int index) const
+{
+	if (!isObjList || (index < 0) || (index >= static_cast<int>(tokenCount)))
+	{
+		return {};
+	}
+	return std::string(tokens[index]);
+}
+
+
+int commonItems::objectNode::numTokens() const
+{
+	if (!isObjList)
+	{
+		return 0;
+	}
+	return static_cast<int>(tokenCount);
+}
+
+
+double commonItems::objectNode::safeGetFloat(const std::string& k, double def) const
+{
+	auto matches = getValue(k);
+	if (matches.empty())
+	{
+		return def;
+	}
+	return std::stof(matches[0]->getLeaf());
+}
+
+
+std::string commonItems::objectNode::safeGetString(const std::string& k, std::string def) const
+{
+	auto matches = getValue(k);
+	if (matches.empty())
+	{
+		return def;
+	}
+	return matches[0]->getLeaf();
+}
+
+
+int commonItems::objectNode::safeGetInt(const std::string& k, int def) const
+{
+	auto matches = getValue(k);
+	if (matches.empty())
+	{
+		return def;
+	}
+	return std::stoi(matches[0]->getLeaf());
+}
+
+
+const commonItems::objectNode* commonItems::objectNode::safeGetObject(const std::string& k, const objectNode* def) const
+{
+	auto matches = getValue(k);
+	if (matches.empty())
+	{
+		return def;
+	}
+	return matches[0];
+}
+
+
+std::vector<std::string> commonItems::objectNode::safeGetTokens(const std::string& k) const
+{
+	if (auto node = safeGetObject(k))
+	{
+		return node->getTokens();
+	}
+	return {};
+}
+
+
+std::string commonItems::objectNode::toString() const
+{
+	std::ostringstream output;
+	output << *this;
+	return output.str();
+}
+
+
+void commonItems::objectNode::write(std::ostream& output, int indent) const
+{
+	const std::string indentation(indent, '\t');
+	output << indentation;
+	if (leaf)
+	{
+		output << getKeyView() << " = \"" << value << "\"\n";
+		return;
+	}
+	if (isObjList)
+	{
+		output << getKeyView() << " = { " << getLeaf() << " }\n";
+		return;
+	}
+
+	const bool isTopLevel = (getKeyView() == "topLevel");
+	if (!isTopLevel)
+	{
+		output << getKeyView() << " =\n";
+		output << indentation << "{\n";
+	}
+	for (size_t i = 0; i < childCount; i++)
+	{
+		children[i]->write(output, isTopLevel ? indent : indent + 1);
+	}
+	if (!isTopLevel)
+	{
+		output << indentation << "}\n";
+	}
+}
+
+
+std::ostream& commonItems::operator<<(std::ostream& output, const objectNode& node)
+{
+	node.write(output, 0);
+	return output;
+}
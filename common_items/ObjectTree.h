@@ -0,0 +1,136 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+
+
+#ifndef OBJECT_TREE_H
+#define OBJECT_TREE_H
+
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+
+namespace commonItems
+{
+
+class objectTree;
+
+
+// A read-only node of an objectTree, with the same read access as Object. Nodes are owned by their
+// tree and handed out as plain pointers, which stay valid for as long as the tree.
+class objectNode
+{
+	public:
+		std::string getKey() const { return std::string(getKeyView()); }
+		std::string getLeaf() const;
+		std::vector<const objectNode*> getLeaves() const { return std::vector<const objectNode*>(children, children + childCount); }
+		std::vector<std::string> getTokens() const;
+		bool isLeaf() const { return leaf; }
+
+		std::optional<std::string> getLeaf(const std::string& leaf) const;
+		std::vector<std::string> getKeys() const;
+		std::vector<const objectNode*> getValue(const std::string& key) const;
+		std::optional<std::string> getToken(int index) const;
+		int numTokens() const;
+		double safeGetFloat(const std::string& k, double def = 0.0) const;
+		std::string safeGetString(const std::string& k, std::string def = "") const;
+		int safeGetInt(const std::string& k, int def = 0) const;
+		const objectNode* safeGetObject(const std::string& k, const objectNode* def = nullptr) const;
+		std::vector<std::string> safeGetTokens(const std::string& k) const;
+		std::string toString() const;
+
+		// as getKey() and getLeaf(), but without copying out of the tree
+		std::string_view getKeyView() const;
+		std::string_view getLeafView() const { return value; }
+
+	private:
+		friend class objectTree;
+		friend std::ostream& operator<<(std::ostream& output, const objectNode& node);
+
+		objectNode(const objectTree& theTree, uint32_t theKeyID): tree(&theTree), keyID(theKeyID) {}
+
+		void write(std::ostream& output, int indent) const;
+
+		const objectTree* tree;
+		std::string_view value;								// the value of a leaf
+		const objectNode* const* children = nullptr;
+		size_t childCount = 0;
+		const std::string_view* tokens = nullptr;		// the items of a list, key = { a b c }
+		size_t tokenCount = 0;
+		uint32_t keyID;
+		bool leaf = false;
+		bool isObjList = false;
+};
+
+
+// The Object tree for one block of a file, such as diplomacy = { ... }, built straight from the new
+// lexer. Nodes, their children and any copied text are allocated from an arena that is released all
+// at once with the tree, and keys are stored once per tree. Values are views into the text being
+// parsed: when reading from a bufferStream the tree must not outlive its buffer. As with the old
+// ISO 8859-15 parser, text is converted to UTF-8 and quotes are removed.
+class objectTree
+{
+	public:
+		// Reads key = value from the stream, as commonItems::convert8859Object does
+		objectTree(const std::string& top, std::istream& theStream);
+		objectTree(const objectTree&) = delete;
+		objectTree& operator=(const objectTree&) = delete;
+
+		// a node keyed "topLevel" holding the one that was read
+		const objectNode* getTopLevel() const { return topLevel; }
+
+	private:
+		friend class objectNode;
+		class builder;
+
+		template<typename Type> Type* allocate(size_t count);
+		std::string_view copyText(std::string_view text);
+		uint32_t internKey(std::string_view key);
+		std::optional<uint32_t> findKey(std::string_view key) const;
+
+		std::vector<std::unique_ptr<char[]>> blocks;
+		char* blockPosition = nullptr;
+		size_t blockRemaining = 0;
+
+		std::vector<std::string_view> keyNames;
+		std::unordered_map<std::string_view, uint32_t> keyIDs;
+
+		const objectNode* topLevel = nullptr;
+};
+
+
+std::ostream& operator<<(std::ostream& output, const objectNode& node);
+
+}
+
+
+
+#endif // OBJECT_TREE_H
@@ -0,0 +1,102 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+
+
+#ifndef PARALLEL_FOR_H
+#define PARALLEL_FOR_H
+
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+
+namespace commonItems
+{
+
+// Calls work(index) for every index in [0, count), spread over a worker per core, and returns once
+// every call has finished. Indexes are handed out one at a time, so uneven work still balances.
+// If any call throws, the first exception is rethrown here after the workers have stopped.
+template<typename Work> void parallelFor(size_t count, const Work& work)
+{
+	const size_t workerCount = std::min(count, static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)));
+	if (workerCount <= 1)
+	{
+		for (size_t index = 0; index < count; index++)
+		{
+			work(index);
+		}
+		return;
+	}
+
+	std::atomic<size_t> nextIndex{0};
+	std::exception_ptr firstException;
+	std::mutex exceptionMutex;
+	auto runWorker = [&]()
+	{
+		for (size_t index = nextIndex++; index < count; index = nextIndex++)
+		{
+			try
+			{
+				work(index);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(exceptionMutex);
+				if (!firstException)
+				{
+					firstException = std::current_exception();
+				}
+				nextIndex = count;
+			}
+		}
+	};
+
+	std::vector<std::thread> workers;
+	for (size_t i = 1; i < workerCount; i++)
+	{
+		workers.emplace_back(runWorker);
+	}
+	runWorker();
+	for (auto& worker: workers)
+	{
+		worker.join();
+	}
+
+	if (firstException)
+	{
+		std::rethrow_exception(firstException);
+	}
+}
+
+}
+
+
+
+#endif // PARALLEL_FOR_H
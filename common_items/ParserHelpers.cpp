@@ -22,121 +22,292 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 #include "ParserHelpers.h"
+#include "ParserProfiling.h"
 #include "Log.h"
 #include <cctype>
+#include <charconv>
 #include <sstream>
 
 
-namespace commonItems
+
+namespace
+{
+
+// a lenient unquote for single values, where "123 (closing quote lost to a newline) still reads as 123
+std::string_view trimQuotes(std::string_view token)
+{
+	if (!token.empty() && (token.front() == '"'))
+	{
+		token.remove_prefix(1);
+		if (!token.empty() && (token.back() == '"'))
+		{
+			token.remove_suffix(1);
+		}
+	}
+	return token;
+}
+
+
+size_t countDigits(std::string_view token)
+{
+	size_t digits = 0;
+	while ((digits < token.size()) && isdigit(static_cast<unsigned char>(token[digits])))
+	{
+		digits++;
+	}
+	return digits;
+}
+
+
+// matches \d+
+bool isInteger(std::string_view token)
+{
+	return !token.empty() && (countDigits(token) == token.size());
+}
+
+
+// matches \d+(.\d+)?
+bool isDecimal(std::string_view token)
 {
-std::string getNextLexeme(std::istream& theStream);
+	auto integerDigits = countDigits(token);
+	if (integerDigits == 0)
+	{
+		return false;
+	}
+	else if (integerDigits == token.size())
+	{
+		return true;
+	}
+
+	auto fraction = token.substr(integerDigits + 1);
+	return isInteger(fraction);
+}
+
+
+// The value of key = value, quotes included. Empty if the stream ran out first.
+std::string_view getAssignedValue(std::istream& theStream, std::string& storage)
+{
+	theStream >> std::noskipws;
+
+	if (theStream.eof())
+	{
+		return {};
+	}
+	commonItems::getNextLexemeView(theStream, storage); // equals
+
+	if (theStream.eof())
+	{
+		return {};
+	}
+	return commonItems::getNextLexemeView(theStream, storage);
+}
+
+
+// Reads the number at the start of text, as std::stoi and std::stof would, but without
+// allocating or throwing. Trailing characters are ignored.
+template<typename Number> std::optional<Number> readLeadingNumber(std::string_view text)
+{
+	if (!text.empty() && (text.front() == '+'))
+	{
+		text.remove_prefix(1);
+	}
+
+	Number value{};
+	auto result = std::from_chars(text.data(), text.data() + text.size(), value);
+	if (result.ec != std::errc())
+	{
+		return {};
+	}
+	return value;
+}
+
+}
+
+
+std::string_view commonItems::unquote(std::string_view token)
+{
+	if ((token.size() >= 2) && (token.front() == '"') && (token.back() == '"'))
+	{
+		return token.substr(1, token.size() - 2);
+	}
+	return token;
+}
+
+
+namespace
+{
+
+void skipItem(std::istream& theStream)
+{
+	std::string storage;
+	commonItems::getNextLexemeView(theStream, storage); // equals
+	if (commonItems::getNextLexemeView(theStream, storage) == "{")
+	{
+		commonItems::skipBlock(theStream, 1);
+	}
+}
+
+const std::string_view ignoredContent = "(ignored)";
+
 }
 
 
 void commonItems::ignoreItem(const std::string& unused, std::istream& theStream)
 {
-	std::string next = getNextLexeme(theStream); // equals
-	next = getNextLexeme(theStream);
-	if (next == "{")
+	std::optional<keywordProfiler> profiler;
+	if (isParserProfilingEnabled())
 	{
-		int braceDepth = 1;
-		while (true)
+		profiler.emplace(ignoredContent, theStream);
+	}
+	skipItem(theStream);
+}
+
+
+void commonItems::ignoreObject(const std::string& unused, std::istream& theStream)
+{
+	std::optional<keywordProfiler> profiler;
+	if (isParserProfilingEnabled())
+	{
+		profiler.emplace(ignoredContent, theStream);
+	}
+	skipBlock(theStream, 0);
+}
+
+
+void commonItems::ignoreString(const std::string& unused, std::istream& theStream)
+{
+	std::optional<keywordProfiler> profiler;
+	if (isParserProfilingEnabled())
+	{
+		profiler.emplace(ignoredContent, theStream);
+	}
+	commonItems::singleString ignore(theStream);
+}
+
+
+std::optional<std::string_view> commonItems::getItemText(std::istream& theStream)
+{
+	auto buffer = dynamic_cast<bufferStreamBuffer*>(theStream.rdbuf());
+	if (buffer == nullptr)
+	{
+		return {};
+	}
+
+	auto before = buffer->getRemaining();
+	skipItem(theStream);
+	auto after = buffer->getRemaining();
+	return before.substr(0, before.size() - after.size());
+}
+
+
+void commonItems::readInts(std::istream& theStream, std::vector<int>& ints)
+{
+	std::string storage;
+	parseTokens(theStream, storage, [&ints](std::string_view token)
+	{
+		auto digits = unquote(token);
+		if (!isInteger(digits))
 		{
-			if (theStream.eof())
-			{
-				return;
-			}
+			return false;
+		}
 
-			std::string token = getNextLexeme(theStream);
-			if (token == "{")
-			{
-				braceDepth++;
-			}
-			else if (token == "}")
-			{
-				braceDepth--;
-				if (braceDepth == 0)
-				{
-					return;
-				}
-			}
+		if (auto theInt = readLeadingNumber<int>(digits))
+		{
+			ints.push_back(*theInt);
 		}
-	}
+		else
+		{
+			LOG(LogLevel::Warning) << "Expected an int, but instead got " << digits;
+		}
+		return true;
+	});
 }
 
 
-void commonItems::ignoreObject(const std::string& unused, std::istream& theStream)
+void commonItems::readDoubles(std::istream& theStream, std::vector<double>& doubles)
 {
-	int braceDepth = 0;
-	while (true)
+	std::string storage;
+	parseTokens(theStream, storage, [&doubles](std::string_view token)
 	{
-		if (theStream.eof())
+		auto digits = unquote(token);
+		if (!isDecimal(digits))
 		{
-			return;
+			return false;
 		}
 
-		std::string token = getNextLexeme(theStream);
-		if (token == "{")
+		// parsed at float precision, as std::stof always did, so converted values stay the same
+		if (auto theDouble = readLeadingNumber<float>(digits))
 		{
-			braceDepth++;
+			doubles.push_back(*theDouble);
 		}
-		else if (token == "}")
+		else
 		{
-			braceDepth--;
-			if (braceDepth == 0)
-			{
-				return;
-			}
+			LOG(LogLevel::Warning) << "Expected a double, but instead got " << digits;
 		}
-	}
+		return true;
+	});
 }
 
 
-void commonItems::ignoreString(const std::string& unused, std::istream& theStream)
+int commonItems::readInt(std::istream& theStream)
 {
-	commonItems::singleString ignore(theStream);
+	std::string storage;
+	return readInt(getAssignedValue(theStream, storage));
 }
 
 
-commonItems::intList::intList(std::istream& theStream):
-	ints()
+int commonItems::readInt(std::string_view token)
 {
-	registerKeyword(std::regex("\\d+"), [this](const std::string& theInt, std::istream& theStream)
+	token = trimQuotes(token);
+
+	if (auto theInt = readLeadingNumber<int>(token))
 	{
-		ints.push_back(std::stoi(theInt));
+		return *theInt;
 	}
-	);
-	registerKeyword(std::regex("\\\"\\d+\\\""), [this](const std::string& theInt, std::istream& theStream)
+	else
 	{
-		ints.push_back(std::stoi(theInt));
+		LOG(LogLevel::Warning) << "Expected an int, but instead got " << token;
+		return 0;
 	}
-	);
+}
 
-	parseStream(theStream);
+
+double commonItems::readDouble(std::istream& theStream)
+{
+	std::string storage;
+	return readDouble(getAssignedValue(theStream, storage));
 }
 
 
-commonItems::singleInt::singleInt(std::istream& theStream):
-	theInt()
+double commonItems::readDouble(std::string_view token)
 {
-	auto equals = getNextTokenWithoutMatching(theStream);
-	auto token = *getNextTokenWithoutMatching(theStream);
-	if (token.substr(0,1) == "\"")
-	{
-		token = token.substr(1, token.length() - 2);
-	}
-	try
+	token = trimQuotes(token);
+
+	if (auto theDouble = readLeadingNumber<float>(token))
 	{
-		theInt = stoi(token);
+		return *theDouble;
 	}
-	catch (std::exception&)
+	else
 	{
-		LOG(LogLevel::Warning) << "Expected an int, but instead got " << token;
-		theInt = 0;
+		LOG(LogLevel::Warning) << "Expected a double, but instead got " << token;
+		return 0.0;
 	}
 }
 
 
+commonItems::intList::intList(std::istream& theStream):
+	ints()
+{
+	readInts(theStream, ints);
+}
+
+
+commonItems::singleInt::singleInt(std::istream& theStream):
+	theInt(readInt(theStream))
+{
+}
+
+
 commonItems::simpleObject::simpleObject(std::istream& theStream) : values()
 {
         auto equals = getNextTokenWithoutMatching(theStream);
@@ -204,65 +375,49 @@ int commonItems::simpleObject::getValueAsInt(const std::string& key) const
 commonItems::doubleList::doubleList(std::istream& theStream):
 	doubles()
 {
-	registerKeyword(std::regex("\\d+(.\\d+)?"), [this](const std::string& theDouble, std::istream& theStream)
-	{
-		doubles.push_back(std::stof(theDouble));
-	}
-	);
-	registerKeyword(std::regex("\\\"\\d+(.\\d+)?\\\""), [this](const std::string& theDouble, std::istream& theStream)
-	{
-		auto newDouble = theDouble.substr(1, theDouble.size() - 2);
-		doubles.push_back(std::stof(newDouble));
-	}
-	);
-
-	parseStream(theStream);
+	readDoubles(theStream, doubles);
 }
 
 
 commonItems::singleDouble::singleDouble(std::istream& theStream):
-	theDouble()
+	theDouble(readDouble(theStream))
 {
-	auto equals = getNextTokenWithoutMatching(theStream);
-	auto token = *getNextTokenWithoutMatching(theStream);
-	if (token.substr(0,1) == "\"")
-	{
-		token = token.substr(1, token.length() - 2);
-	}
-	try
-	{
-		theDouble = stof(token);
-	}
-	catch (std::exception&)
-	{
-		LOG(LogLevel::Warning) << "Expected a double, but instead got " << token;
-		theDouble = 0.0;
-	}
 }
 
 
 commonItems::stringList::stringList(std::istream& theStream):
 	strings()
 {
-	registerKeyword(std::regex("[^[:s:]^=^\\{^\\}^\\\"]+"), [this](const std::string& theString, std::istream& theStream)
-	{
-		strings.push_back(theString);
-	}
-	);
-	registerKeyword(std::regex("\\\"[^\n^=^\\{^\\}^\\\"]+\\\""), [this](const std::string& theString, std::istream& theStream)
+	getSchema().parseStream(*this, theStream);
+}
+
+
+const commonItems::parserSchema<commonItems::stringList>& commonItems::stringList::getSchema()
+{
+	static const auto theSchema = []()
 	{
-		if (theString.substr(0,1) == "\"")
+		parserSchema<stringList> schema;
+		schema.registerRegex("[^[:s:]^=^\\{^\\}^\\\"]+", [](stringList& list, const std::string& theString, std::istream& theStream)
 		{
-			strings.push_back(theString.substr(1, theString.size() - 2));
+			list.strings.push_back(theString);
 		}
-		else
+		);
+		schema.registerRegex("\\\"[^\n^=^\\{^\\}^\\\"]+\\\"", [](stringList& list, const std::string& theString, std::istream& theStream)
 		{
-			strings.push_back(theString);
+			if (theString.substr(0,1) == "\"")
+			{
+				list.strings.push_back(theString.substr(1, theString.size() - 2));
+			}
+			else
+			{
+				list.strings.push_back(theString);
+			}
 		}
-	}
-	);
+		);
+		return schema;
+	}();
 
-	parseStream(theStream);
+	return theSchema;
 }
 
 
@@ -349,7 +504,7 @@ commonItems::stringOfItem::stringOfItem(std::istream& theStream)
 
 commonItems::stringsOfItems::stringsOfItems(std::istream& theStream)
 {
-	registerKeyword(std::regex("[a-zA-Z0-9_]+"), [this](const std::string& itemName, std::istream& theStream){
+	registerRegex("[a-zA-Z0-9_]+", [this](const std::string& itemName, std::istream& theStream){
 		stringOfItem theItem(theStream);
 		theStrings.push_back(itemName + theItem.getString() + "\n");
 	});
@@ -360,7 +515,7 @@ commonItems::stringsOfItems::stringsOfItems(std::istream& theStream)
 
 commonItems::stringsOfItemNames::stringsOfItemNames(std::istream& theStream)
 {
-	registerKeyword(std::regex("[a-zA-Z0-9_]+"), [this](const std::string& itemName, std::istream& theStream){
+	registerRegex("[a-zA-Z0-9_]+", [this](const std::string& itemName, std::istream& theStream){
 		ignoreItem(itemName, theStream);
 		theStrings.push_back(itemName);
 	});
@@ -26,6 +26,9 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 #include <map>
+#include <optional>
+#include <string_view>
+#include <vector>
 
 
 #include "newParser.h"
@@ -39,9 +42,29 @@ void ignoreItem(const std::string& unused, std::istream& theStream);
 void ignoreObject(const std::string& unused, std::istream& theStream);
 void ignoreString(const std::string& unused, std::istream& theStream);
 
+// Skips key = value as ignoreItem does, but returns the skipped text so it can be parsed later, for
+// instance on another thread. The text stays valid for as long as the buffer behind the stream.
+// Only a bufferStream can give out its text; any other stream is left untouched and nothing is returned.
+std::optional<std::string_view> getItemText(std::istream& theStream);
 
+// Numeric readers that work straight from the lexer, without a parser. The list readers take
+// { 1 2 "3" } and append to the caller's vector; the single readers take = 5 or = "5" and log a
+// warning and return 0 when the value is not a number.
+void readInts(std::istream& theStream, std::vector<int>& ints);
+void readDoubles(std::istream& theStream, std::vector<double>& doubles);
+int readInt(std::istream& theStream);
+double readDouble(std::istream& theStream);
 
-class intList: commonItems::parser
+// As above, for a value that has already been read, such as a scalar from parseEvents.
+int readInt(std::string_view token);
+double readDouble(std::string_view token);
+
+// "abc" -> abc, while anything not wrapped in quotes is left as is
+std::string_view unquote(std::string_view token);
+
+
+
+class intList
 {
 	public:
 		explicit intList(std::istream& theStream);
@@ -53,7 +76,7 @@ class intList: commonItems::parser
 };
 
 
-class singleInt: commonItems::parser
+class singleInt
 {
 	public:
 		explicit singleInt(std::istream& theStream);
@@ -78,7 +101,7 @@ class simpleObject : commonItems::parser
                 std::map<std::string, std::string> values;
 };
 
-class doubleList: commonItems::parser
+class doubleList
 {
 	public:
 		explicit doubleList(std::istream& theStream);
@@ -86,11 +109,12 @@ class doubleList: commonItems::parser
 		std::vector<double> getDoubles() const { return doubles; }
 
 	private:
+
 		std::vector<double> doubles;
 };
 
 
-class singleDouble: commonItems::parser
+class singleDouble
 {
 	public:
 		explicit singleDouble(std::istream& theStream);
@@ -102,7 +126,7 @@ class singleDouble: commonItems::parser
 };
 
 
-class stringList: commonItems::parser
+class stringList
 {
 	public:
 		explicit stringList(std::istream& theStream);
@@ -110,6 +134,8 @@ class stringList: commonItems::parser
 		std::vector<std::string> getStrings() const { return strings; }
 
 	private:
+		static const parserSchema<stringList>& getSchema();
+
 		std::vector<std::string> strings;
 };
 
@@ -0,0 +1,176 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+#include "ParserProfiling.h"
+#include "Log.h"
+#include <algorithm>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+
+
+namespace
+{
+
+struct keywordCounters
+{
+	uint64_t matches = 0;
+	uint64_t bytes = 0;
+	uint64_t totalNanoseconds = 0;
+	uint64_t selfNanoseconds = 0;	// excluding keywords matched within this one
+};
+
+typedef std::unordered_map<std::string, keywordCounters> counterTable;
+
+
+void addCounters(counterTable& destination, const counterTable& source)
+{
+	for (const auto& [keyword, counters]: source)
+	{
+		auto& destinationCounters = destination[keyword];
+		destinationCounters.matches += counters.matches;
+		destinationCounters.bytes += counters.bytes;
+		destinationCounters.totalNanoseconds += counters.totalNanoseconds;
+		destinationCounters.selfNanoseconds += counters.selfNanoseconds;
+	}
+}
+
+
+std::mutex sharedCountersMutex;
+counterTable sharedCounters;
+
+
+// Each thread counts on its own, and hands its counts over when it exits
+struct threadCounters
+{
+	~threadCounters()
+	{
+		std::lock_guard<std::mutex> lock(sharedCountersMutex);
+		addCounters(sharedCounters, counters);
+	}
+
+	counterTable counters;
+};
+
+thread_local threadCounters localCounters;
+
+// time spent in keywords matched within the innermost keyword being profiled on this thread
+thread_local uint64_t nestedNanoseconds = 0;
+
+}
+
+
+
+void commonItems::enableParserProfiling(bool enable)
+{
+	detail::parserProfilingEnabled.store(enable, std::memory_order_relaxed);
+}
+
+
+commonItems::keywordProfiler::keywordProfiler(std::string_view keyword, std::istream& theStream):
+	keyword(keyword),
+	buffer(theStream.rdbuf()),
+	startPosition(buffer->pubseekoff(0, std::ios_base::cur, std::ios_base::in)),	// not tellg(), which fails at the end of a stream
+	startTime(std::chrono::steady_clock::now()),
+	outerNestedNanoseconds(nestedNanoseconds)
+{
+	nestedNanoseconds = 0;
+}
+
+
+commonItems::keywordProfiler::~keywordProfiler()
+{
+	const uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+	const std::streamoff endPosition = buffer->pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+
+	auto& counters = localCounters.counters[std::string(keyword)];
+	counters.matches++;
+	if ((startPosition >= 0) && (endPosition >= startPosition))
+	{
+		counters.bytes += endPosition - startPosition;
+	}
+	counters.totalNanoseconds += elapsed;
+	counters.selfNanoseconds += elapsed - std::min(elapsed, nestedNanoseconds);
+
+	nestedNanoseconds = outerNestedNanoseconds + elapsed;
+}
+
+
+void commonItems::countUnknownToken()
+{
+	if (isParserProfilingEnabled())
+	{
+		localCounters.counters["(unknown tokens)"].matches++;
+	}
+}
+
+
+void commonItems::logParserProfile(const std::string& title)
+{
+	if (!isParserProfilingEnabled())
+	{
+		return;
+	}
+
+	counterTable allCounters;
+	{
+		std::lock_guard<std::mutex> lock(sharedCountersMutex);
+		addCounters(sharedCounters, localCounters.counters);
+		localCounters.counters.clear();
+		allCounters.swap(sharedCounters);
+	}
+
+	std::vector<std::pair<std::string, keywordCounters>> sortedCounters(allCounters.begin(), allCounters.end());
+	std::sort(sortedCounters.begin(), sortedCounters.end(), [](const auto& a, const auto& b) {
+		if (a.second.selfNanoseconds != b.second.selfNanoseconds)
+		{
+			return a.second.selfNanoseconds > b.second.selfNanoseconds;
+		}
+		return a.first < b.first;
+	});
+
+	size_t keywordWidth = 7;
+	uint64_t totalSelfNanoseconds = 0;
+	for (const auto& [keyword, counters]: sortedCounters)
+	{
+		keywordWidth = std::max(keywordWidth, keyword.size());
+		totalSelfNanoseconds += counters.selfNanoseconds;
+	}
+
+	LOG(LogLevel::Info) << "Parser profile for " << title << ", " << std::fixed << std::setprecision(3) << totalSelfNanoseconds / 1e9 << "s in keyword functions:";
+	std::ostringstream header;
+	header << std::left << std::setw(keywordWidth) << "Keyword" << std::right << std::setw(12) << "Matches" << std::setw(14) << "KB" << std::setw(12) << "Total (s)" << std::setw(12) << "Self (s)";
+	LOG(LogLevel::Info) << "\t" << header.str();
+	for (const auto& [keyword, counters]: sortedCounters)
+	{
+		std::ostringstream line;
+		line << std::left << std::setw(keywordWidth) << keyword << std::right;
+		line << std::setw(12) << counters.matches;
+		line << std::setw(14) << counters.bytes / 1024;
+		line << std::fixed << std::setprecision(3);
+		line << std::setw(12) << counters.totalNanoseconds / 1e9;
+		line << std::setw(12) << counters.selfNanoseconds / 1e9;
+		LOG(LogLevel::Info) << "\t" << line.str();
+	}
+}
@@ -0,0 +1,87 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+#ifndef PARSER_PROFILING_H
+#define PARSER_PROFILING_H
+
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <string_view>
+
+
+
+namespace commonItems
+{
+
+namespace detail
+{
+inline std::atomic<bool> parserProfilingEnabled{ false };
+}
+
+
+// Optional counters of where parsing spends its effort. While enabled, each keyword matched by a
+// parser or parserSchema records how often it matched, how many bytes its function consumed and
+// how long that took, both in total and excluding keywords matched inside it. Content skipped by
+// the ignore functions and unknown tokens are counted on their own rows. Every parser on every
+// thread adds to the same counters, so nested parsers are aggregated. Disabled by default, when
+// the only cost is one check per matched keyword.
+void enableParserProfiling(bool enable);
+inline bool isParserProfilingEnabled()
+{
+	return detail::parserProfilingEnabled.load(std::memory_order_relaxed);
+}
+
+// Logs the counters gathered since profiling was enabled or last logged, most expensive first, and
+// then clears them. Call it once any threads that parsed have finished.
+void logParserProfile(const std::string& title);
+
+
+// Adds one match of keyword to the counters, timing it from construction to destruction.
+// The keyword must stay valid for the profiler's lifetime.
+class keywordProfiler
+{
+	public:
+		keywordProfiler(std::string_view keyword, std::istream& theStream);
+		~keywordProfiler();
+		keywordProfiler(const keywordProfiler&) = delete;
+		keywordProfiler& operator=(const keywordProfiler&) = delete;
+		keywordProfiler(keywordProfiler&&) = delete;
+		keywordProfiler& operator=(keywordProfiler&&) = delete;
+
+	private:
+		std::string_view keyword;
+		std::streambuf* buffer;
+		std::streamoff startPosition;
+		std::chrono::steady_clock::time_point startTime;
+		uint64_t outerNestedNanoseconds;
+};
+
+void countUnknownToken();
+
+}
+
+
+
+#endif // PARSER_PROFILING_H
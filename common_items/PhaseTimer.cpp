@@ -0,0 +1,235 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+#include "PhaseTimer.h"
+#include "Log.h"
+#include "OSCompatibilityLayer.h"
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+
+
+namespace
+{
+
+struct phaseRecord
+{
+	std::string name;
+	int depth;
+	int thread;
+	uint64_t startMicroseconds;	// since the first phase started
+	uint64_t wallMicroseconds;
+	uint64_t cpuMicroseconds;
+	uint64_t peakResidentBytes;
+};
+
+std::mutex recordsMutex;
+std::vector<phaseRecord> records;
+
+thread_local int currentDepth = 0;
+
+
+std::chrono::steady_clock::time_point getEpoch()
+{
+	static const auto epoch = std::chrono::steady_clock::now();
+	return epoch;
+}
+
+
+int getThreadNumber()
+{
+	static std::atomic<int> nextThreadNumber{ 1 };
+	thread_local const int threadNumber = nextThreadNumber++;
+	return threadNumber;
+}
+
+
+uint64_t microsecondsBetween(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+}
+
+
+// records are added as phases finish, so a sub-phase comes before its parent until sorted
+std::vector<phaseRecord> getRecordsInStartOrder()
+{
+	std::vector<phaseRecord> sortedRecords;
+	{
+		std::lock_guard<std::mutex> lock(recordsMutex);
+		sortedRecords = records;
+	}
+	std::stable_sort(sortedRecords.begin(), sortedRecords.end(), [](const phaseRecord& a, const phaseRecord& b) {
+		if (a.startMicroseconds != b.startMicroseconds)
+		{
+			return a.startMicroseconds < b.startMicroseconds;
+		}
+		return a.depth < b.depth;
+	});
+	return sortedRecords;
+}
+
+
+void writeJSONString(std::ostream& out, const std::string& text)
+{
+	out << '"';
+	for (char character: text)
+	{
+		switch (character)
+		{
+			case '"':
+				out << "\\\"";
+				break;
+			case '\\':
+				out << "\\\\";
+				break;
+			default:
+				if (static_cast<unsigned char>(character) < 0x20)
+				{
+					out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(character) << std::dec << std::setfill(' ');
+				}
+				else
+				{
+					out << character;
+				}
+		}
+	}
+	out << '"';
+}
+
+}
+
+
+
+commonItems::phaseTimer::phaseTimer(std::string name):
+	name(std::move(name))
+{
+	start();
+}
+
+
+commonItems::phaseTimer::~phaseTimer()
+{
+	finish();
+}
+
+
+void commonItems::phaseTimer::next(std::string nextName)
+{
+	finish();
+	name = std::move(nextName);
+	start();
+}
+
+
+void commonItems::phaseTimer::start()
+{
+	getEpoch();
+	depth = currentDepth++;
+	startCPUMicroseconds = Utils::getProcessCPUMicroseconds();
+	startTime = std::chrono::steady_clock::now();
+}
+
+
+void commonItems::phaseTimer::finish()
+{
+	const auto endTime = std::chrono::steady_clock::now();
+	const uint64_t endCPUMicroseconds = Utils::getProcessCPUMicroseconds();
+	currentDepth--;
+
+	phaseRecord record{
+		name,
+		depth,
+		getThreadNumber(),
+		microsecondsBetween(getEpoch(), startTime),
+		microsecondsBetween(startTime, endTime),
+		endCPUMicroseconds - startCPUMicroseconds,
+		Utils::getPeakResidentBytes()
+	};
+
+	std::lock_guard<std::mutex> lock(recordsMutex);
+	records.push_back(std::move(record));
+}
+
+
+void commonItems::logPhaseSummary()
+{
+	const auto sortedRecords = getRecordsInStartOrder();
+	if (sortedRecords.empty())
+	{
+		return;
+	}
+
+	size_t nameWidth = 5;
+	for (const auto& record: sortedRecords)
+	{
+		nameWidth = std::max(nameWidth, record.name.size() + 2 * record.depth);
+	}
+
+	std::ostringstream header;
+	header << std::left << std::setw(nameWidth) << "Phase" << std::right << std::setw(12) << "Wall (s)" << std::setw(12) << "CPU (s)" << std::setw(16) << "Peak RSS (MB)";
+	LOG(LogLevel::Info) << "Phase timings:";
+	LOG(LogLevel::Info) << "\t" << header.str();
+
+	for (const auto& record: sortedRecords)
+	{
+		std::ostringstream line;
+		line << std::string(2 * record.depth, ' ') << std::left << std::setw(nameWidth - 2 * record.depth) << record.name;
+		line << std::right << std::fixed << std::setprecision(3);
+		line << std::setw(12) << record.wallMicroseconds / 1e6;
+		line << std::setw(12) << record.cpuMicroseconds / 1e6;
+		line << std::setw(16) << std::setprecision(1) << record.peakResidentBytes / (1024.0 * 1024.0);
+		LOG(LogLevel::Info) << "\t" << line.str();
+	}
+}
+
+
+bool commonItems::writePhaseTrace(const std::string& filename)
+{
+	std::ofstream traceFile(filename);
+	if (!traceFile.is_open())
+	{
+		LOG(LogLevel::Warning) << "Could not write phase trace to " << filename;
+		return false;
+	}
+
+	traceFile << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+	bool first = true;
+	for (const auto& record: getRecordsInStartOrder())
+	{
+		traceFile << (first ? "\n" : ",\n");
+		first = false;
+
+		traceFile << "{\"name\":";
+		writeJSONString(traceFile, record.name);
+		traceFile << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << record.thread;
+		traceFile << ",\"ts\":" << record.startMicroseconds << ",\"dur\":" << record.wallMicroseconds;
+		traceFile << ",\"args\":{\"cpu_ms\":" << record.cpuMicroseconds / 1000;
+		traceFile << ",\"peak_rss_mb\":" << record.peakResidentBytes / (1024 * 1024) << "}}";
+	}
+	traceFile << "\n]}\n";
+
+	return traceFile.good();
+}
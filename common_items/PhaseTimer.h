@@ -0,0 +1,74 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+#ifndef PHASE_TIMER_H
+#define PHASE_TIMER_H
+
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+
+
+namespace commonItems
+{
+
+// Times a named phase of a conversion, from construction until destruction or the next call to
+// next(). Each phase records its wall time, the CPU time the whole process used meanwhile (so
+// parallel work shows as CPU time above wall time) and the peak resident memory when it ended.
+// A phase started while another is running on the same thread is recorded as its sub-phase.
+class phaseTimer
+{
+	public:
+		explicit phaseTimer(std::string name);
+		~phaseTimer();
+		phaseTimer(const phaseTimer&) = delete;
+		phaseTimer& operator=(const phaseTimer&) = delete;
+		phaseTimer(phaseTimer&&) = delete;
+		phaseTimer& operator=(phaseTimer&&) = delete;
+
+		// ends the current phase and starts its successor at the same depth
+		void next(std::string nextName);
+
+	private:
+		void start();
+		void finish();
+
+		std::string name;
+		std::chrono::steady_clock::time_point startTime;
+		uint64_t startCPUMicroseconds = 0;
+		int depth = 0;
+};
+
+
+// Logs a table of every phase finished so far, in the order they started
+void logPhaseSummary();
+
+// Writes every phase finished so far as a Chrome trace, which chrome://tracing or ui.perfetto.dev
+// can display. Returns false if the file could not be written.
+bool writePhaseTrace(const std::string& filename);
+
+}
+
+
+
+#endif // PHASE_TIMER_H
@@ -0,0 +1,177 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+#include "SingleByteTranscoder.h"
+#include "Log.h"
+#include <array>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define TRANSCODER_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+
+
+namespace
+{
+
+// The UTF-8 for one of the bytes from 0x80 up. A length of zero marks a byte with no character.
+struct utf8Sequence
+{
+	unsigned char length = 0;
+	char bytes[3] = { 0, 0, 0 };
+};
+
+typedef std::array<utf8Sequence, 128> transcodingTable;
+
+
+// Windows-1252 0x80 - 0x9F. Above that it matches ISO-8859-1, and so Unicode.
+constexpr char32_t win1252Controls[32] = {
+	0x20AC, 0,      0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021,
+	0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0,      0x017D, 0,
+	0,      0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+	0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0,      0x017E, 0x0178
+};
+
+// The eight places ISO-8859-15 differs from ISO-8859-1.
+constexpr std::pair<unsigned char, char32_t> iso8859_15Replacements[8] = {
+	{ 0xA4, 0x20AC }, { 0xA6, 0x0160 }, { 0xA8, 0x0161 }, { 0xB4, 0x017D },
+	{ 0xB8, 0x017E }, { 0xBC, 0x0152 }, { 0xBD, 0x0153 }, { 0xBE, 0x0178 }
+};
+
+
+utf8Sequence encode(char32_t codePoint)
+{
+	utf8Sequence sequence;
+	if (codePoint == 0)
+	{
+		return sequence;
+	}
+	else if (codePoint < 0x800)
+	{
+		sequence.length = 2;
+		sequence.bytes[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+		sequence.bytes[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+	}
+	else
+	{
+		sequence.length = 3;
+		sequence.bytes[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+		sequence.bytes[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+		sequence.bytes[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+	}
+	return sequence;
+}
+
+
+const transcodingTable& getTable(commonItems::singleByteEncoding encoding)
+{
+	static const transcodingTable win1252Table = []()
+	{
+		transcodingTable table;
+		for (char32_t byte = 0x80; byte < 0x100; byte++)
+		{
+			table[byte - 0x80] = encode((byte < 0xA0) ? win1252Controls[byte - 0x80] : byte);
+		}
+		return table;
+	}();
+
+	static const transcodingTable iso8859_15Table = []()
+	{
+		transcodingTable table;
+		for (char32_t byte = 0x80; byte < 0x100; byte++)
+		{
+			table[byte - 0x80] = encode(byte);
+		}
+		for (auto [byte, codePoint]: iso8859_15Replacements)
+		{
+			table[byte - 0x80] = encode(codePoint);
+		}
+		return table;
+	}();
+
+	return (encoding == commonItems::singleByteEncoding::Win1252) ? win1252Table : iso8859_15Table;
+}
+
+
+const char* getEncodingName(commonItems::singleByteEncoding encoding)
+{
+	return (encoding == commonItems::singleByteEncoding::Win1252) ? "CP1252" : "ISO-8859-15";
+}
+
+
+const char* skipASCII(const char* position, const char* end)
+{
+#ifdef TRANSCODER_USE_SSE2
+	while (end - position >= 16)
+	{
+		const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+		if (_mm_movemask_epi8(block) != 0)
+		{
+			break;
+		}
+		position += 16;
+	}
+#endif
+
+	while ((position < end) && (static_cast<unsigned char>(*position) < 0x80))
+	{
+		position++;
+	}
+	return position;
+}
+
+}
+
+
+
+bool commonItems::appendAsUTF8(std::string_view input, singleByteEncoding encoding, std::string& output)
+{
+	const auto& table = getTable(encoding);
+	const size_t originalLength = output.size();
+	output.reserve(originalLength + input.size() + input.size() / 8);
+
+	const char* position = input.data();
+	const char* end = position + input.size();
+	while (position < end)
+	{
+		const char* runEnd = skipASCII(position, end);
+		output.append(position, runEnd - position);
+		position = runEnd;
+
+		while ((position < end) && (static_cast<unsigned char>(*position) >= 0x80))
+		{
+			const auto& sequence = table[static_cast<unsigned char>(*position) - 0x80];
+			if (sequence.length == 0)
+			{
+				LOG(LogLevel::Error) << "invalid input sequence encountered during conversion from " << getEncodingName(encoding) << " to UTF-8";
+				output.resize(originalLength);
+				return false;
+			}
+			output.append(sequence.bytes, sequence.length);
+			position++;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,55 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+
+
+#ifndef SINGLE_BYTE_TRANSCODER_H
+#define SINGLE_BYTE_TRANSCODER_H
+
+
+
+#include <string>
+#include <string_view>
+
+
+
+namespace commonItems
+{
+
+// The single byte code pages Paradox games write their text in.
+enum class singleByteEncoding
+{
+	Win1252,
+	ISO8859_15
+};
+
+
+// Appends input to output as UTF-8, byte for byte as iconv would convert it. Input of any size is
+// handled in one pass, with runs of ASCII copied across in blocks. A byte with no character in the
+// encoding (0x81, 0x8D, 0x8F, 0x90 or 0x9D in Windows-1252) fails the whole conversion, as it does
+// in iconv: an error is logged, output is left as it was and false is returned.
+bool appendAsUTF8(std::string_view input, singleByteEncoding encoding, std::string& output);
+
+}
+
+
+
+#endif // SINGLE_BYTE_TRANSCODER_H
@@ -0,0 +1,138 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+#include "Symbol.h"
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+
+
+
+namespace
+{
+
+// Texts live in fixed size chunks that are never moved or freed, so a handle is looked up without
+// locking, and the table's string_views into them stay valid
+constexpr uint32_t chunkBits = 12;
+constexpr uint32_t chunkSize = 1 << chunkBits;
+constexpr uint32_t maximumChunks = 1 << 12;	// room for 16 million symbols
+
+// Interning locks only one of several shards, so threads parsing in parallel rarely wait on each other
+constexpr size_t shardCount = 16;
+
+
+class symbolTable
+{
+	public:
+		static symbolTable& get()
+		{
+			static symbolTable* table = new symbolTable;	// never destroyed, so symbols work in static destructors
+			return *table;
+		}
+
+		uint32_t intern(std::string_view text);
+
+		const std::string& getText(uint32_t handle) const noexcept
+		{
+			return chunks[handle >> chunkBits].load(std::memory_order_acquire)[handle & (chunkSize - 1)];
+		}
+
+	private:
+		symbolTable()
+		{
+			chunks[0].store(new std::string[chunkSize], std::memory_order_release);	// handle 0 is the empty string
+		}
+
+		std::string* getChunk(uint32_t handle);
+
+		struct shard
+		{
+			std::mutex mutex;
+			std::unordered_map<std::string_view, uint32_t> handles;
+		};
+
+		std::array<std::atomic<std::string*>, maximumChunks> chunks{};
+		std::mutex chunkMutex;
+		std::atomic<uint32_t> nextHandle{ 1 };
+		std::array<shard, shardCount> shards;
+};
+
+
+uint32_t symbolTable::intern(std::string_view text)
+{
+	if (text.empty())
+	{
+		return 0;
+	}
+
+	auto& theShard = shards[std::hash<std::string_view>()(text) % shardCount];
+	std::lock_guard<std::mutex> lock(theShard.mutex);
+	if (auto existing = theShard.handles.find(text); existing != theShard.handles.end())
+	{
+		return existing->second;
+	}
+
+	const uint32_t handle = nextHandle++;
+	if ((handle >> chunkBits) >= maximumChunks)
+	{
+		throw std::runtime_error("Too many distinct symbols");
+	}
+	std::string& storedText = getChunk(handle)[handle & (chunkSize - 1)];
+	storedText = text;
+	theShard.handles.emplace(storedText, handle);
+	return handle;
+}
+
+
+std::string* symbolTable::getChunk(uint32_t handle)
+{
+	auto& theChunk = chunks[handle >> chunkBits];
+	if (auto chunk = theChunk.load(std::memory_order_acquire))
+	{
+		return chunk;
+	}
+
+	std::lock_guard<std::mutex> lock(chunkMutex);
+	auto chunk = theChunk.load(std::memory_order_relaxed);
+	if (chunk == nullptr)
+	{
+		chunk = new std::string[chunkSize];
+		theChunk.store(chunk, std::memory_order_release);
+	}
+	return chunk;
+}
+
+}
+
+
+
+commonItems::symbol::symbol(std::string_view text):
+	handle(symbolTable::get().intern(text))
+{
+}
+
+
+const std::string& commonItems::symbol::str() const noexcept
+{
+	return symbolTable::get().getText(handle);
+}
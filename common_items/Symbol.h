@@ -0,0 +1,73 @@
+/*Copyright (c) 2018 The Paradox Game Converters Project
+
+Permission is hereby granted, free of charge, to any person obtaining
+a copy of this software and associated documentation files (the
+"Software"), to deal in the Software without restriction, including
+without limitation the rights to use, copy, modify, merge, publish,
+distribute, sublicense, and/or sell copies of the Software, and to
+permit persons to whom the Software is furnished to do so, subject to
+the following conditions:
+
+The above copyright notice and this permission notice shall be included
+in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
+
+#ifndef SYMBOL_H
+#define SYMBOL_H
+
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+
+
+namespace commonItems
+{
+
+// A short string that recurs throughout a conversion, such as a culture, religion, pop type or issue
+// name, stored once in a table shared by the whole process. A symbol is a 32 bit handle to its entry,
+// so symbols copy, compare for equality and hash as integers. Interning is safe from any thread, and
+// a symbol's text stays valid for the rest of the run.
+class symbol
+{
+	public:
+		constexpr symbol() noexcept = default;	// the empty string
+		explicit symbol(std::string_view text);
+
+		const std::string& str() const noexcept;
+		bool empty() const noexcept { return handle == 0; }
+		uint32_t getHandle() const noexcept { return handle; }
+
+		bool operator==(symbol other) const noexcept { return handle == other.handle; }
+		bool operator!=(symbol other) const noexcept { return handle != other.handle; }
+		// Orders by text rather than handle, so ordered containers of symbols iterate exactly as they
+		// would for the strings, whatever order the symbols were interned in
+		bool operator<(symbol other) const noexcept { return (handle != other.handle) && (str() < other.str()); }
+
+	private:
+		uint32_t handle = 0;
+};
+
+}
+
+
+namespace std
+{
+template<> struct hash<commonItems::symbol>
+{
+	size_t operator()(commonItems::symbol theSymbol) const noexcept { return theSymbol.getHandle(); }
+};
+}
+
+
+
+#endif // SYMBOL_H
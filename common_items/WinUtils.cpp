@@ -23,12 +23,14 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 #include "OSCompatibilityLayer.h"
 #include <Windows.h>
+#include <Psapi.h>
 #include <iostream>
 #include <io.h>
 #include <Shellapi.h>
 #include <list>
 #include <algorithm>
 #include "Log.h"
+#include "SingleByteTranscoder.h"
 
 
 
@@ -274,6 +276,104 @@ bool deleteFolder(const std::string& folder)
 }
 
 
+mappedFile::mappedFile(const std::string& filename)
+{
+	HANDLE file = CreateFileW(convertUTF8ToUTF16(filename).c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize))
+	{
+		CloseHandle(file);
+		return;
+	}
+
+	if (fileSize.QuadPart > 0)
+	{
+		HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (mapping == NULL)
+		{
+			CloseHandle(file);
+			return;
+		}
+
+		const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+		if (view == NULL)
+		{
+			CloseHandle(file);
+			return;
+		}
+		data = static_cast<const char*>(view);
+		size = static_cast<size_t>(fileSize.QuadPart);
+	}
+
+	CloseHandle(file);
+	open = true;
+}
+
+
+mappedFile::~mappedFile()
+{
+	if (data != nullptr)
+	{
+		UnmapViewOfFile(data);
+	}
+}
+
+
+std::optional<fileStamp> getFileStamp(const std::string& path)
+{
+	WIN32_FILE_ATTRIBUTE_DATA attributes;
+	if (!GetFileAttributesExW(convertUTF8ToUTF16(path).c_str(), GetFileExInfoStandard, &attributes) || (attributes.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+	{
+		return std::nullopt;
+	}
+
+	fileStamp stamp;
+	stamp.size = (static_cast<uint64_t>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+	stamp.lastWriteTime = (static_cast<uint64_t>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+	return stamp;
+}
+
+
+uint64_t getCurrentProcessID()
+{
+	return GetCurrentProcessId();
+}
+
+
+uint64_t getProcessCPUMicroseconds()
+{
+	FILETIME creationTime, exitTime, kernelTime, userTime;
+	if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+	{
+		return 0;
+	}
+	auto toMicroseconds = [](const FILETIME& time) {
+		ULARGE_INTEGER ticks;
+		ticks.LowPart = time.dwLowDateTime;
+		ticks.HighPart = time.dwHighDateTime;
+		return ticks.QuadPart / 10;	// FILETIMEs count 100ns ticks
+	};
+	return toMicroseconds(kernelTime) + toMicroseconds(userTime);
+}
+
+
+uint64_t getPeakResidentBytes()
+{
+	PROCESS_MEMORY_COUNTERS counters;
+	if (!K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+	{
+		return 0;
+	}
+	return counters.PeakWorkingSetSize;
+}
+
+
 std::string convertUTF8ToASCII(const std::string& UTF8)
 {
 	int requiredSize = WideCharToMultiByte(20127 /*US-ASCII (7-bit)*/, 0, convertUTF8ToUTF16(UTF8).c_str(), -1, NULL, 0, "0", NULL);
@@ -350,7 +450,9 @@ std::string convert8859_15ToASCII(const std::string& input)
 
 std::string convert8859_15ToUTF8(const std::string& input)
 {
-	return convertUTF16ToUTF8(convert8859_15ToUTF16(input));
+	std::string UTF8;
+	commonItems::appendAsUTF8(input, commonItems::singleByteEncoding::ISO8859_15, UTF8);
+	return UTF8;
 }
 
 
@@ -379,7 +481,9 @@ std::string convertWin1252ToASCII(const std::string& input)
 
 std::string convertWin1252ToUTF8(const std::string& input)
 {
-	return convertUTF16ToUTF8(convertWin1252ToUTF16(input));
+	std::string UTF8;
+	commonItems::appendAsUTF8(input, commonItems::singleByteEncoding::Win1252, UTF8);
+	return UTF8;
 }
 
 
@@ -427,6 +531,50 @@ std::string convertToUTF8(const std::wstring& input)
 }
 
 
+static bool isASCII(std::string_view text)
+{
+	return std::all_of(text.begin(), text.end(), [](char character) { return static_cast<unsigned char>(character) < 0x80; });
+}
+
+
+void appendUTF8To8859_15(std::string_view UTF8, std::string& output)
+{
+	if (isASCII(UTF8))
+	{
+		output.append(UTF8);
+	}
+	else
+	{
+		output += convertUTF8To8859_15(std::string(UTF8));
+	}
+}
+
+
+void appendUTF8ToWin1252(std::string_view UTF8, std::string& output)
+{
+	if (isASCII(UTF8))
+	{
+		output.append(UTF8);
+	}
+	else
+	{
+		output += convertUTF8ToWin1252(std::string(UTF8));
+	}
+}
+
+
+void append8859_15ToUTF8(std::string_view input, std::string& output)
+{
+	commonItems::appendAsUTF8(input, commonItems::singleByteEncoding::ISO8859_15, output);
+}
+
+
+void appendWin1252ToUTF8(std::string_view Win1252, std::string& output)
+{
+	commonItems::appendAsUTF8(Win1252, commonItems::singleByteEncoding::Win1252, output);
+}
+
+
 std::string normalizeUTF8Path(const std::string& utf_8_path)
 {
 	std::string asciiPath = convertUTF8ToASCII(utf_8_path);
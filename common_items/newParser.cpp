@@ -23,127 +23,710 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 #include "newParser.h"
 #include "Log.h"
+#include "OSCompatibilityLayer.h"
+#include <algorithm>
 #include <cctype>
-#include <fstream>
+#include <cstring>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define PARSER_USE_SSE2
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
 
 
-namespace commonItems
+
+namespace
+{
+
+bool isLexemeSpace(const char inputChar)
 {
+	return std::isspace(static_cast<unsigned char>(inputChar)) != 0;
+}
 
-std::string getNextLexeme(std::istream& theStream);
 
+const char* skipComment(const char* position, const char* end)
+{
+	auto endOfLine = static_cast<const char*>(std::memchr(position, '\n', end - position));
+	if (endOfLine == nullptr)
+	{
+		return end;
+	}
+	return endOfLine + 1;
 }
-			
 
-void commonItems::parser::registerKeyword(std::regex keyword, parsingFunction function)
+
+#ifdef PARSER_USE_SSE2
+unsigned int countTrailingZeros(unsigned int mask)
 {
-	registeredKeywords.push_back(make_pair(keyword, function));
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return index;
+#else
+	return __builtin_ctz(mask);
+#endif
 }
+#endif
 
 
-void commonItems::parser::parseStream(std::istream& theStream)
+// Finds the first of the four characters in [position, end), or end if there is none. Where SSE2
+// is available this compares sixteen bytes at a time.
+const char* findFirstOf(const char* position, const char* end, char first, char second, char third, char fourth)
 {
-	int braceDepth = 0;
+#ifdef PARSER_USE_SSE2
+	const __m128i firsts = _mm_set1_epi8(first);
+	const __m128i seconds = _mm_set1_epi8(second);
+	const __m128i thirds = _mm_set1_epi8(third);
+	const __m128i fourths = _mm_set1_epi8(fourth);
+	while (end - position >= 16)
+	{
+		const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+		const __m128i matches = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(block, firsts), _mm_cmpeq_epi8(block, seconds)),
+			_mm_or_si128(_mm_cmpeq_epi8(block, thirds), _mm_cmpeq_epi8(block, fourths))
+		);
+		const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(matches));
+		if (mask != 0)
+		{
+			return position + countTrailingZeros(mask);
+		}
+		position += 16;
+	}
+#endif
 
+	for (; position != end; position++)
+	{
+		const char inputChar = *position;
+		if ((inputChar == first) || (inputChar == second) || (inputChar == third) || (inputChar == fourth))
+		{
+			return position;
+		}
+	}
+	return end;
+}
+
+
+// Whether a quote following this character opens a quoted string. Inside an unquoted lexeme
+// quotes are just part of the lexeme.
+bool endsLexeme(const char inputChar)
+{
+	return isLexemeSpace(inputChar) || (inputChar == '{') || (inputChar == '}') || (inputChar == '=');
+}
+
+
+// The buffer equivalent of lexing until the braces close. Only braces, quotes and comments can
+// change the depth, so everything between them is passed over without being split into lexemes.
+// Returns the position just past the closing brace. Sets reachedEnd if the block never closes.
+const char* skipBlockInBuffer(const char* position, const char* end, int braceDepth, bool& reachedEnd)
+{
+	reachedEnd = false;
+
+	// lexemes start here and after every quoted string, as well as after the characters endsLexeme() knows
+	const char* lexemeStart = position;
 	while (true)
 	{
-		auto token = getNextToken(theStream);
-		if (token)
+		position = findFirstOf(position, end, '{', '}', '\"', '#');
+		if (position == end)
 		{
-			if (*token == "=")
+			reachedEnd = true;
+			return end;
+		}
+
+		switch (*position)
+		{
+			case '{':
+				braceDepth++;
+				position++;
+				break;
+			case '}':
+				braceDepth--;
+				position++;
+				if (braceDepth == 0)
+				{
+					return position;
+				}
+				break;
+			case '#':
+				position = skipComment(position + 1, end);
+				break;
+			default:
+				if ((position == lexemeStart) || endsLexeme(*(position - 1)))
+				{
+					// as in the lexer, a newline also ends a quoted string
+					position = findFirstOf(position + 1, end, '\"', '\n', '\"', '\n');
+					if (position == end)
+					{
+						reachedEnd = true;
+						return end;
+					}
+					lexemeStart = position + 1;
+				}
+				position++;
+				break;
+		}
+	}
+}
+
+
+// Finds the next lexeme in [position, end), following the same rules as the stream lexer below.
+// Advances position past everything consumed. Sets reachedEnd if the lexer needed to read beyond
+// the end of the buffer, which is where the stream lexer would have hit end of file.
+std::string_view lexBuffer(const char*& position, const char* end, bool& reachedEnd)
+{
+	reachedEnd = false;
+
+	while (true)
+	{
+		if (position == end)
+		{
+			reachedEnd = true;
+			return {};
+		}
+		else if (*position == '#')
+		{
+			position = skipComment(position + 1, end);
+		}
+		else if (isLexemeSpace(*position))
+		{
+			position++;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	const char* lexemeStart = position;
+	if ((*position == '{') || (*position == '}') || (*position == '='))
+	{
+		position++;
+		return std::string_view(lexemeStart, 1);
+	}
+
+	if (*position == '\"')
+	{
+		position++;
+		while (position != end)
+		{
+			if (*position == '\n')
+			{
+				position++;
+				return std::string_view(lexemeStart, position - 1 - lexemeStart);
+			}
+			else if (*position == '\"')
 			{
-				continue;
+				position++;
+				return std::string_view(lexemeStart, position - lexemeStart);
 			}
+			position++;
+		}
+		reachedEnd = true;
+		return std::string_view(lexemeStart, position - lexemeStart);
+	}
+
+	position++;
+	while (position != end)
+	{
+		const char inputChar = *position;
+		if (inputChar == '#')
+		{
+			std::string_view lexeme(lexemeStart, position - lexemeStart);
+			position = skipComment(position + 1, end);
+			reachedEnd = (position == end) && (*(end - 1) != '\n');
+			return lexeme;
+		}
+		else if (isLexemeSpace(inputChar))
+		{
+			position++;
+			return std::string_view(lexemeStart, position - 1 - lexemeStart);
+		}
+		else if ((inputChar == '{') || (inputChar == '}') || (inputChar == '='))
+		{
+			return std::string_view(lexemeStart, position - lexemeStart);
+		}
+		position++;
+	}
+	reachedEnd = true;
+	return std::string_view(lexemeStart, position - lexemeStart);
+}
+
+}
+
+
+commonItems::bufferStreamBuffer::bufferStreamBuffer(std::string_view buffer)
+{
+	char* begin = const_cast<char*>(buffer.data());
+	setg(begin, begin, begin + buffer.size());
+}
+
 
-			else if (*token == "{")
+void commonItems::bufferStreamBuffer::consume(size_t count)
+{
+	setg(eback(), gptr() + count, egptr());
+}
+
+
+std::streambuf::pos_type commonItems::bufferStreamBuffer::seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode)
+{
+	if ((mode & std::ios_base::in) == 0)
+	{
+		return pos_type(off_type(-1));
+	}
+
+	char* base = gptr();
+	if (direction == std::ios_base::beg)
+	{
+		base = eback();
+	}
+	else if (direction == std::ios_base::end)
+	{
+		base = egptr();
+	}
+
+	const off_type newPosition = (base - eback()) + offset;
+	if ((newPosition < 0) || (newPosition > egptr() - eback()))
+	{
+		return pos_type(off_type(-1));
+	}
+
+	setg(eback(), eback() + newPosition, egptr());
+	return pos_type(newPosition);
+}
+
+
+std::streambuf::pos_type commonItems::bufferStreamBuffer::seekpos(pos_type position, std::ios_base::openmode mode)
+{
+	return seekoff(off_type(position), std::ios_base::beg, mode);
+}
+
+
+commonItems::bufferStream::bufferStream(std::string_view buffer):
+	std::istream(&streamBuffer),
+	streamBuffer(buffer)
+{
+}
+
+
+namespace
+{
+
+std::bitset<256> characterRange(const unsigned char first, const unsigned char last)
+{
+	std::bitset<256> characters;
+	for (unsigned int character = first; character <= last; character++)
+	{
+		characters.set(character);
+	}
+	return characters;
+}
+
+
+std::bitset<256> digitCharacters()
+{
+	return characterRange('0', '9');
+}
+
+
+std::bitset<256> wordCharacters()
+{
+	auto characters = characterRange('0', '9') | characterRange('A', 'Z') | characterRange('a', 'z');
+	characters.set('_');
+	return characters;
+}
+
+
+std::bitset<256> spaceCharacters()
+{
+	std::bitset<256> characters;
+	for (auto character: { ' ', '\t', '\n', '\v', '\f', '\r' })
+	{
+		characters.set(static_cast<unsigned char>(character));
+	}
+	return characters;
+}
+
+
+// Reads an escape sequence (the part after the backslash) into a set of characters.
+// Returns false for escapes that are not simple characters or classes, such as \b or \1.
+bool readEscape(const char escaped, std::bitset<256>& characters)
+{
+	switch (escaped)
+	{
+		case 'd':
+			characters = digitCharacters();
+			return true;
+		case 'D':
+			characters = ~digitCharacters();
+			return true;
+		case 'w':
+			characters = wordCharacters();
+			return true;
+		case 'W':
+			characters = ~wordCharacters();
+			return true;
+		case 's':
+			characters = spaceCharacters();
+			return true;
+		case 'S':
+			characters = ~spaceCharacters();
+			return true;
+		case 'n':
+			characters.reset().set('\n');
+			return true;
+		case 'r':
+			characters.reset().set('\r');
+			return true;
+		case 't':
+			characters.reset().set('\t');
+			return true;
+		case 'f':
+			characters.reset().set('\f');
+			return true;
+		case 'v':
+			characters.reset().set('\v');
+			return true;
+		default:
+			if (std::isalnum(static_cast<unsigned char>(escaped)))
 			{
-				braceDepth++;
+				return false;
+			}
+			characters.reset().set(static_cast<unsigned char>(escaped));
+			return true;
+	}
+}
+
+}
+
+
+commonItems::keywordMatcher::keywordMatcher(const std::string& pattern)
+{
+	if (!compile(pattern))
+	{
+		elements.clear();
+		regex = std::regex(pattern);
+	}
+}
+
+
+commonItems::keywordMatcher::keywordMatcher(std::regex pattern):
+	regex(std::move(pattern))
+{
+}
+
+
+bool commonItems::keywordMatcher::compile(const std::string& pattern)
+{
+	size_t position = 0;
+	while (position < pattern.size())
+	{
+		element newElement;
+		const char current = pattern[position];
+		if (current == '\\')
+		{
+			if ((position + 1 == pattern.size()) || !readEscape(pattern[position + 1], newElement.characters))
+			{
+				return false;
+			}
+			position += 2;
+		}
+		else if (current == '.')
+		{
+			newElement.characters.set();
+			newElement.characters.reset('\n');
+			newElement.characters.reset('\r');
+			position++;
+		}
+		else if (current == '[')
+		{
+			position++;
+			bool negated = false;
+			if ((position < pattern.size()) && (pattern[position] == '^'))
+			{
+				negated = true;
+				position++;
 			}
 
-			else if (*token == "}")
+			bool closed = false;
+			bool empty = true;
+			while (position < pattern.size())
 			{
-				braceDepth--;
-				if (braceDepth == 0)
+				std::bitset<256> itemCharacters;
+				const char item = pattern[position];
+				if (item == ']')
 				{
+					closed = true;
+					position++;
 					break;
 				}
-			}
+				else if (item == '[')
+				{
+					return false;
+				}
+				else if (item == '\\')
+				{
+					if ((position + 1 == pattern.size()) || !readEscape(pattern[position + 1], itemCharacters))
+					{
+						return false;
+					}
+					position += 2;
+				}
+				else
+				{
+					itemCharacters.set(static_cast<unsigned char>(item));
+					position++;
+				}
 
-			else
+				if (
+					(item != '\\') &&
+					(position + 1 < pattern.size()) &&
+					(pattern[position] == '-') &&
+					(pattern[position + 1] != ']')
+				)
+				{
+					const char last = pattern[position + 1];
+					if ((last == '\\') || (last == '[') || (static_cast<unsigned char>(last) < static_cast<unsigned char>(item)))
+					{
+						return false;
+					}
+					itemCharacters = characterRange(static_cast<unsigned char>(item), static_cast<unsigned char>(last));
+					position += 2;
+				}
+
+				newElement.characters |= itemCharacters;
+				empty = false;
+			}
+			if (!closed || empty)
+			{
+				return false;
+			}
+			if (negated)
 			{
-				int streamPos = theStream.tellg();
-				LOG(LogLevel::Warning)
-					<< "Unknown token while parsing stream: " << *token
-					<< " (Position: " << streamPos << ")";
+				newElement.characters.flip();
 			}
 		}
+		else if (std::strchr("*+?{}()|^$]", current) != nullptr)
+		{
+			return false;
+		}
 		else
 		{
-			break;
+			newElement.characters.set(static_cast<unsigned char>(current));
+			position++;
 		}
+
+		if (position < pattern.size())
+		{
+			const char quantifier = pattern[position];
+			if (quantifier == '+')
+			{
+				newElement.maximum = std::string::npos;
+				position++;
+			}
+			else if (quantifier == '*')
+			{
+				newElement.minimum = 0;
+				newElement.maximum = std::string::npos;
+				position++;
+			}
+			else if (quantifier == '?')
+			{
+				newElement.minimum = 0;
+				position++;
+			}
+			else if (quantifier == '{')
+			{
+				const auto closingBrace = pattern.find('}', position);
+				if (closingBrace == std::string::npos)
+				{
+					return false;
+				}
+				const auto bounds = pattern.substr(position + 1, closingBrace - position - 1);
+				if (bounds.empty() || (bounds.find_first_not_of("0123456789,") != std::string::npos))
+				{
+					return false;
+				}
+				const auto comma = bounds.find(',');
+				if ((comma == 0) || ((comma != std::string::npos) && (bounds.find(',', comma + 1) != std::string::npos)))
+				{
+					return false;
+				}
+				newElement.minimum = std::stoul(bounds.substr(0, comma));
+				if (comma == std::string::npos)
+				{
+					newElement.maximum = newElement.minimum;
+				}
+				else if (comma + 1 == bounds.size())
+				{
+					newElement.maximum = std::string::npos;
+				}
+				else
+				{
+					newElement.maximum = std::stoul(bounds.substr(comma + 1));
+				}
+				if (newElement.maximum < newElement.minimum)
+				{
+					return false;
+				}
+				position = closingBrace + 1;
+			}
+
+			if ((position < pattern.size()) && (std::strchr("*+?{", pattern[position]) != nullptr))
+			{
+				return false;
+			}
+		}
+
+		elements.push_back(newElement);
 	}
+
+	// Elements are matched greedily, without backtracking. That is only correct if a repeated
+	// element can never give up characters to the elements that follow it.
+	for (size_t i = 0; i < elements.size(); i++)
+	{
+		if (elements[i].minimum == elements[i].maximum)
+		{
+			continue;
+		}
+		for (size_t j = i + 1; j < elements.size(); j++)
+		{
+			if ((elements[i].characters & elements[j].characters).any())
+			{
+				return false;
+			}
+			if (elements[j].minimum > 0)
+			{
+				break;
+			}
+		}
+	}
+
+	return true;
 }
 
 
-void commonItems::parser::parseFile(const std::string& filename)
+bool commonItems::keywordMatcher::matches(std::string_view token) const
 {
-	std::ifstream theFile(filename);
-	if (!theFile.is_open())
+	if (regex)
 	{
-		LOG(LogLevel::Error) << "Could not open " << filename << " for parsing.";
-		return;
+		return std::regex_match(token.begin(), token.end(), *regex);
 	}
 
-	const char firstChar = theFile.peek();
-	if (firstChar == '\xEF')
+	size_t position = 0;
+	for (const auto& theElement: elements)
 	{
-		char bitBucket[3];
-		theFile.read(bitBucket, 3);
+		size_t count = 0;
+		while (
+			(count < theElement.maximum) &&
+			(position < token.size()) &&
+			theElement.characters.test(static_cast<unsigned char>(token[position]))
+		)
+		{
+			position++;
+			count++;
+		}
+		if (count < theElement.minimum)
+		{
+			return false;
+		}
 	}
 
-	parseStream(theFile);
-	theFile.close();
+	return position == token.size();
 }
 
 
-std::optional<std::string> commonItems::parser::getNextToken(std::istream& theStream)
+std::optional<std::string> commonItems::keywordMatcher::getLiteral() const
 {
-	theStream >> std::noskipws;
-
-	std::string toReturn;
+	if (regex)
+	{
+		return {};
+	}
 
-	bool gotToken = false;
-	while (!gotToken)
+	std::string literal;
+	for (const auto& theElement: elements)
 	{
-		if (theStream.eof())
+		if ((theElement.minimum != 1) || (theElement.maximum != 1) || (theElement.characters.count() != 1))
 		{
 			return {};
 		}
-
-		toReturn = getNextLexeme(theStream);
-
-		bool matched = false;
-		for (auto registration: registeredKeywords)
+		for (unsigned int character = 0; character < 256; character++)
 		{
-			std::smatch match;
-			if (std::regex_match(toReturn, match, registration.first))
+			if (theElement.characters.test(character))
 			{
-				registration.second(toReturn, theStream);
-				matched = true;
+				literal += static_cast<char>(character);
 				break;
 			}
 		}
+	}
+	return literal;
+}
 
-		if (!matched)
-		{
-			gotToken = true;
-		}
+
+void commonItems::parser::registerKeyword(const std::string& keyword, parsingFunction function)
+{
+	registeredKeywords.registerLiteral(keyword, function);
+}
+
+
+void commonItems::parser::registerRegex(const std::string& keyword, parsingFunction function)
+{
+	registeredKeywords.registerPattern(keywordMatcher(keyword), function, keyword);
+}
+
+
+void commonItems::parser::registerKeyword(std::regex keyword, parsingFunction function)
+{
+	registeredKeywords.registerPattern(keywordMatcher(std::move(keyword)), function, "(regex)");
+}
+
+
+void commonItems::warnUnknownToken(std::string_view token, std::istream& theStream)
+{
+	countUnknownToken();
+	int streamPos = theStream.tellg();
+	LOG(LogLevel::Warning)
+		<< "Unknown token while parsing stream: " << token
+		<< " (Position: " << streamPos << ")";
+}
+
+
+void commonItems::parser::parseStream(std::istream& theStream)
+{
+	parseTokens(theStream, nextToken, [&theStream, this](std::string_view token)
+	{
+		return dispatch(token, theStream);
+	});
+}
+
+
+void commonItems::parser::parseBuffer(std::string_view buffer)
+{
+	bufferStream theStream(buffer);
+	parseStream(theStream);
+}
+
+
+void commonItems::parser::parseFile(const std::string& filename)
+{
+	Utils::mappedFile theFile(filename);
+	if (!theFile.isOpen())
+	{
+		LOG(LogLevel::Error) << "Could not open " << filename << " for parsing.";
+		return;
 	}
 
-	if (toReturn.size() > 0)
+	parseBuffer(removeByteOrderMark(theFile.getContents()));
+}
+
+
+std::optional<std::string> commonItems::parser::getNextToken(std::istream& theStream)
+{
+	auto token = getNextTokenView(theStream);
+	if (token)
 	{
-		return toReturn;
+		return std::string(*token);
 	}
 	else
 	{
@@ -152,6 +735,32 @@ std::optional<std::string> commonItems::parser::getNextToken(std::istream& theSt
 }
 
 
+std::optional<std::string_view> commonItems::parser::getNextTokenView(std::istream& theStream)
+{
+	return getNextUnhandledToken(theStream, nextToken, [&theStream, this](std::string_view token)
+	{
+		return dispatch(token, theStream);
+	});
+}
+
+
+bool commonItems::parser::dispatch(std::string_view token, std::istream& theStream)
+{
+	std::string_view keyword;
+	if (auto match = registeredKeywords.find(token, &keyword))
+	{
+		std::optional<keywordProfiler> profiler;
+		if (isParserProfilingEnabled())
+		{
+			profiler.emplace(keyword, theStream);
+		}
+		(*match)(std::string(token), theStream);
+		return true;
+	}
+	return false;
+}
+
+
 std::optional<std::string> commonItems::parser::getNextTokenWithoutMatching(std::istream& theStream)
 {
 	theStream >> std::noskipws;
@@ -183,7 +792,99 @@ std::optional<std::string> commonItems::parser::getNextTokenWithoutMatching(std:
 
 std::string commonItems::getNextLexeme(std::istream& theStream)
 {
-	std::string toReturn;
+	std::string storage;
+	auto lexeme = getNextLexemeView(theStream, storage);
+	if (lexeme.data() == storage.data())
+	{
+		return storage;
+	}
+	return std::string(lexeme);
+}
+
+
+void commonItems::skipBlock(std::istream& theStream, int braceDepth)
+{
+	theStream >> std::noskipws;
+	if (theStream.eof())
+	{
+		return;
+	}
+
+	if (auto buffer = dynamic_cast<bufferStreamBuffer*>(theStream.rdbuf()))
+	{
+		if (!theStream.good())
+		{
+			theStream.setstate(std::ios_base::failbit);
+			return;
+		}
+
+		auto remaining = buffer->getRemaining();
+		const char* end = remaining.data() + remaining.size();
+
+		bool reachedEnd = false;
+		const char* position = skipBlockInBuffer(remaining.data(), end, braceDepth, reachedEnd);
+		buffer->consume(position - remaining.data());
+		if (reachedEnd)
+		{
+			theStream.setstate(std::ios_base::eofbit | std::ios_base::failbit);
+		}
+		return;
+	}
+
+	std::string storage;
+	do
+	{
+		auto token = getNextLexemeView(theStream, storage);
+		if (token == "{")
+		{
+			braceDepth++;
+		}
+		else if (token == "}")
+		{
+			braceDepth--;
+			if (braceDepth == 0)
+			{
+				return;
+			}
+		}
+	} while (!theStream.eof());
+}
+
+
+std::string_view commonItems::removeByteOrderMark(std::string_view contents)
+{
+	if (!contents.empty() && (contents[0] == '\xEF'))
+	{
+		contents.remove_prefix(std::min(contents.size(), static_cast<size_t>(3)));
+	}
+	return contents;
+}
+
+
+std::string_view commonItems::getNextLexemeView(std::istream& theStream, std::string& storage)
+{
+	if (auto buffer = dynamic_cast<bufferStreamBuffer*>(theStream.rdbuf()))
+	{
+		if (!theStream.good())
+		{
+			theStream.setstate(std::ios_base::failbit);
+			return {};
+		}
+
+		auto remaining = buffer->getRemaining();
+		const char* position = remaining.data();
+		bool reachedEnd = false;
+		auto lexeme = lexBuffer(position, remaining.data() + remaining.size(), reachedEnd);
+		buffer->consume(position - remaining.data());
+		if (reachedEnd)
+		{
+			theStream.setstate(std::ios_base::eofbit | std::ios_base::failbit);
+		}
+		return lexeme;
+	}
+
+	std::string& toReturn = storage;
+	toReturn.clear();
 
 	bool inString = false;
 	while (true)
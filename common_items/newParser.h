@@ -26,13 +26,21 @@ SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.*/
 
 
 
+#include "ParserProfiling.h"
+#include <algorithm>
+#include <bitset>
 #include <istream>
 #include <functional>
 #include <list>
 #include <optional>
 #include <regex>
+#include <set>
+#include <streambuf>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 
 
@@ -41,6 +49,485 @@ namespace commonItems
 
 typedef std::function<void(const std::string&, std::istream&)> parsingFunction;
 
+
+// A stream buffer over a contiguous block of memory, such as a mapped file. Parsing functions
+// still receive it as an ordinary std::istream, but the lexer recognizes it and reads tokens
+// straight out of the underlying memory instead of one character at a time.
+class bufferStreamBuffer: public std::streambuf
+{
+	public:
+		explicit bufferStreamBuffer(std::string_view buffer);
+
+		std::string_view getRemaining() const { return std::string_view(gptr(), egptr() - gptr()); }
+		void consume(size_t count);
+
+	protected:
+		pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode) override;
+		pos_type seekpos(pos_type position, std::ios_base::openmode mode) override;
+};
+
+
+class bufferStream: public std::istream
+{
+	public:
+		explicit bufferStream(std::string_view buffer);
+
+	private:
+		bufferStreamBuffer streamBuffer;
+};
+
+
+std::string getNextLexeme(std::istream& theStream);
+
+// As getNextLexeme, but avoids copying the lexeme when the stream is a bufferStream. For other
+// streams the lexeme is stored in the provided string. The result is only valid until the next read.
+std::string_view getNextLexemeView(std::istream& theStream, std::string& storage);
+
+// Skips ahead to just past the } that closes braceDepth already open braces. From a depth of zero,
+// skips past the first complete block. Quoted strings and comments are respected as the lexer
+// would, but a bufferStream is scanned for braces directly rather than lexed token by token.
+void skipBlock(std::istream& theStream, int braceDepth);
+
+// defined in ParserHelpers.cpp, and used here to pass over repeated keys
+void ignoreItem(const std::string& unused, std::istream& theStream);
+
+// The contents of a file with any UTF-8 byte order mark removed.
+std::string_view removeByteOrderMark(std::string_view contents);
+
+
+// A keyword pattern compiled once, when it is registered. Patterns built only from single
+// characters and character classes with simple repetition (\d+, [A-Z]{3}, [a-z_]+, ...) are
+// matched with character tables; anything else falls back to std::regex.
+class keywordMatcher
+{
+	public:
+		explicit keywordMatcher(const std::string& pattern);
+		explicit keywordMatcher(std::regex pattern);
+
+		bool matches(std::string_view token) const;
+
+		// the exact text this pattern matches, if it only matches one string
+		std::optional<std::string> getLiteral() const;
+
+	private:
+		struct element
+		{
+			std::bitset<256> characters;
+			size_t minimum = 1;
+			size_t maximum = 1;
+		};
+
+		bool compile(const std::string& pattern);
+
+		std::vector<element> elements;
+		std::optional<std::regex> regex;
+};
+
+
+// Registered keywords and their handlers. Plain keywords are found with a single hash lookup,
+// patterns are tried in registration order. As with a plain list of registrations, the earliest
+// registration that matches a token wins.
+template<typename Handler> class keywordTable
+{
+	public:
+		keywordTable() = default;
+		~keywordTable() = default;
+		keywordTable(const keywordTable& other): registrations(other.registrations) { index(); }
+		keywordTable(keywordTable&&) = default;
+		keywordTable& operator=(const keywordTable& other)
+		{
+			if (this != &other)
+			{
+				registrations = other.registrations;
+				index();
+			}
+			return *this;
+		}
+		keywordTable& operator=(keywordTable&&) = default;
+
+		void registerLiteral(const std::string& keyword, Handler handler)
+		{
+			registrations.push_back({ registrations.size(), keyword, std::nullopt, std::move(handler) });
+			literals.emplace(registrations.back().keyword, &registrations.back());
+		}
+
+		// the pattern's text is only kept to name it when profiling
+		void registerPattern(keywordMatcher matcher, Handler handler, std::string patternText = "")
+		{
+			if (auto literal = matcher.getLiteral())
+			{
+				registerLiteral(*literal, std::move(handler));
+				return;
+			}
+			registrations.push_back({ registrations.size(), std::move(patternText), std::move(matcher), std::move(handler) });
+			patterns.push_back(&registrations.back());
+		}
+
+		// If matchedKeyword is given, it is pointed at the keyword or pattern text that matched
+		const Handler* find(std::string_view token, std::string_view* matchedKeyword = nullptr) const
+		{
+			const registration* literalMatch = nullptr;
+			if (!literals.empty())
+			{
+				if (auto literal = literals.find(token); literal != literals.end())
+				{
+					literalMatch = literal->second;
+				}
+			}
+
+			for (auto pattern: patterns)
+			{
+				if ((literalMatch != nullptr) && (pattern->order > literalMatch->order))
+				{
+					break;
+				}
+				if (pattern->matcher->matches(token))
+				{
+					if (matchedKeyword != nullptr)
+					{
+						*matchedKeyword = pattern->keyword;
+					}
+					return &pattern->handler;
+				}
+			}
+
+			if (literalMatch != nullptr)
+			{
+				if (matchedKeyword != nullptr)
+				{
+					*matchedKeyword = literalMatch->keyword;
+				}
+				return &literalMatch->handler;
+			}
+			return nullptr;
+		}
+
+		void clear() noexcept
+		{
+			literals.clear();
+			patterns.clear();
+			registrations.clear();
+		}
+
+	private:
+		struct registration
+		{
+			size_t order;
+			std::string keyword;
+			std::optional<keywordMatcher> matcher;
+			Handler handler;
+		};
+
+		void index()
+		{
+			literals.clear();
+			patterns.clear();
+			for (const auto& theRegistration: registrations)
+			{
+				if (theRegistration.matcher)
+				{
+					patterns.push_back(&theRegistration);
+				}
+				else
+				{
+					literals.emplace(theRegistration.keyword, &theRegistration);
+				}
+			}
+		}
+
+		std::list<registration> registrations;
+		std::unordered_map<std::string_view, const registration*> literals; // keyed by the registrations' own keywords, which never move
+		std::vector<const registration*> patterns;
+};
+
+
+void warnUnknownToken(std::string_view token, std::istream& theStream);
+
+
+// Reads tokens, handing each to dispatch until one is not handled, which is returned.
+// Returns nothing at the end of the stream.
+template<typename Dispatch> std::optional<std::string_view> getNextUnhandledToken(
+	std::istream& theStream,
+	std::string& storage,
+	const Dispatch& dispatch
+)
+{
+	theStream >> std::noskipws;
+
+	while (true)
+	{
+		if (theStream.eof())
+		{
+			return {};
+		}
+
+		auto token = getNextLexemeView(theStream, storage);
+		if (!dispatch(token))
+		{
+			if (token.empty())
+			{
+				return {};
+			}
+			return token;
+		}
+	}
+}
+
+
+// Parses one object, key = { ... }, or the rest of a file, handing tokens to dispatch. Pass a
+// braceDepth of 1 if the object's opening brace has already been read.
+template<typename Dispatch> void parseTokens(
+	std::istream& theStream,
+	std::string& storage,
+	const Dispatch& dispatch,
+	int braceDepth = 0
+)
+{
+	while (true)
+	{
+		auto token = getNextUnhandledToken(theStream, storage, dispatch);
+		if (!token)
+		{
+			break;
+		}
+		else if (*token == "=")
+		{
+			continue;
+		}
+		else if (*token == "{")
+		{
+			braceDepth++;
+		}
+		else if (*token == "}")
+		{
+			braceDepth--;
+			if (braceDepth == 0)
+			{
+				break;
+			}
+		}
+		else
+		{
+			warnUnknownToken(*token, theStream);
+		}
+	}
+}
+
+
+// Receives the structure of a script as it is read, for consumers that want to handle a large
+// block as a flat state machine rather than have an object built for every item. Derive from this
+// and declare only the events needed; the rest do nothing. Text is passed as lexed, quotes and all,
+// and is only valid during the call. Keys, scalars and list items report the depth of the block
+// holding them (0 outside any block); block events report the depth of the block itself.
+class scriptEventHandler
+{
+	public:
+		void onKey(std::string_view /*key*/, int /*depth*/) {}
+		void onScalar(std::string_view /*value*/, int /*depth*/) {}
+		void onBeginBlock(int /*depth*/) {}
+		void onEndBlock(int /*depth*/) {}
+		void onListItem(std::string_view /*item*/, int /*depth*/) {}
+};
+
+
+// Reports the rest of the stream, or everything up to an unmatched }, as events to handler.
+template<typename Handler> void parseEvents(std::istream& theStream, Handler& handler);
+
+// Reports one value, = scalar or = { ... }, as events to handler. For use from a keyword's
+// parsing function, where the key has already been read.
+template<typename Handler> void parseItemEvents(std::istream& theStream, Handler& handler);
+
+
+namespace detail
+{
+
+// Two alternating lexeme buffers, so a token stays valid while the one after it is looked at.
+class lexemeReader
+{
+	public:
+		explicit lexemeReader(std::istream& theStream): theStream(theStream) { theStream >> std::noskipws; }
+
+		std::optional<std::string_view> next()
+		{
+			current ^= 1;
+			if (theStream.eof())
+			{
+				return {};
+			}
+			auto lexeme = getNextLexemeView(theStream, storage[current]);
+			if (lexeme.empty())
+			{
+				return {};
+			}
+			return lexeme;
+		}
+
+	private:
+		std::istream& theStream;
+		std::string storage[2];
+		int current = 0;
+};
+
+
+template<typename Handler> void readEvents(lexemeReader& reader, Handler& handler, std::optional<std::string_view> token, bool singleBlock)
+{
+	int depth = 0;
+	while (token)
+	{
+		if (*token == "{")
+		{
+			handler.onBeginBlock(++depth);
+		}
+		else if (*token == "}")
+		{
+			if (depth == 0)
+			{
+				return;
+			}
+			handler.onEndBlock(depth--);
+			if (singleBlock && (depth == 0))
+			{
+				return;
+			}
+		}
+		else if (*token != "=")
+		{
+			auto following = reader.next();
+			if (!following || (*following != "="))
+			{
+				handler.onListItem(*token, depth);
+				token = following;
+				continue;
+			}
+
+			handler.onKey(*token, depth);
+			auto value = reader.next();
+			if (value && (*value != "{") && (*value != "}"))
+			{
+				handler.onScalar(*value, depth);
+			}
+			else
+			{
+				token = value;
+				continue;
+			}
+		}
+		token = reader.next();
+	}
+}
+
+}
+
+
+template<typename Handler> void parseEvents(std::istream& theStream, Handler& handler)
+{
+	detail::lexemeReader reader(theStream);
+	detail::readEvents(reader, handler, reader.next(), false);
+}
+
+
+template<typename Handler> void parseItemEvents(std::istream& theStream, Handler& handler)
+{
+	detail::lexemeReader reader(theStream);
+	auto token = reader.next();
+	if (token && (*token == "="))
+	{
+		token = reader.next();
+	}
+
+	if (token && (*token == "{"))
+	{
+		detail::readEvents(reader, handler, token, true);
+	}
+	else if (token)
+	{
+		handler.onScalar(*token, 0);
+	}
+}
+
+
+// Keywords for a type that is parsed many times, such as pops or provinces. Rather than every
+// object registering its own keywords as a parser does, the type builds one schema (typically a
+// function-local static, so it is built once and thread-safely) and every object parses with it.
+template<typename Parsed> class parserSchema
+{
+	public:
+		typedef std::function<void(Parsed&, const std::string&, std::istream&)> schemaFunction;
+
+		void registerKeyword(const std::string& keyword, schemaFunction function)
+		{
+			keywords.registerLiteral(keyword, std::move(function));
+		}
+
+		void registerRegex(const std::string& keyword, schemaFunction function)
+		{
+			keywords.registerPattern(keywordMatcher(keyword), std::move(function), keyword);
+		}
+
+		// Only the first occurrence of the keyword in each parsed object is handled, later ones are
+		// skipped. This matches code that read Object::getValue(keyword)[0].
+		void registerFirstKeyword(const std::string& keyword, schemaFunction function)
+		{
+			firstOnlyKeywords.insert(keyword);
+			registerKeyword(keyword, std::move(function));
+		}
+
+		// for functions that do not need the object, such as commonItems::ignoreItem
+		void registerKeyword(const std::string& keyword, parsingFunction function)
+		{
+			registerKeyword(keyword, ignoringObject(std::move(function)));
+		}
+
+		void registerRegex(const std::string& keyword, parsingFunction function)
+		{
+			registerRegex(keyword, ignoringObject(std::move(function)));
+		}
+
+		void parseStream(Parsed& object, std::istream& theStream) const
+		{
+			std::string storage;
+			std::vector<std::string_view> firstKeywordsRead;
+			parseTokens(theStream, storage, [&object, &theStream, &firstKeywordsRead, this](std::string_view token)
+			{
+				std::string_view keyword;
+				if (auto match = keywords.find(token, &keyword))
+				{
+					if (!firstOnlyKeywords.empty() && (firstOnlyKeywords.count(keyword) > 0))
+					{
+						if (std::find(firstKeywordsRead.begin(), firstKeywordsRead.end(), keyword) != firstKeywordsRead.end())
+						{
+							ignoreItem(std::string(token), theStream);
+							return true;
+						}
+						firstKeywordsRead.push_back(keyword);
+					}
+
+					std::optional<keywordProfiler> profiler;
+					if (isParserProfilingEnabled())
+					{
+						profiler.emplace(keyword, theStream);
+					}
+					(*match)(object, std::string(token), theStream);
+					return true;
+				}
+				return false;
+			});
+		}
+
+	private:
+		static schemaFunction ignoringObject(parsingFunction function)
+		{
+			return [function](Parsed& /*object*/, const std::string& keyword, std::istream& theStream)
+			{
+				function(keyword, theStream);
+			};
+		}
+
+		keywordTable<schemaFunction> keywords;
+		std::set<std::string, std::less<>> firstOnlyKeywords;
+};
+
+
 class parser
 {
 	public:
@@ -51,8 +538,11 @@ class parser
 		parser& operator=(const parser&) = default;
 		parser& operator=(parser&&) = default;
 
+		void registerKeyword(const std::string& keyword, parsingFunction);
+		void registerRegex(const std::string& keyword, parsingFunction);
 		void registerKeyword(std::regex keyword, parsingFunction);
 		void parseStream(std::istream& theStream);
+		void parseBuffer(std::string_view buffer);
 		void parseFile(const std::string& filename);
 
 		void clearRegisteredKeywords() noexcept { registeredKeywords.clear(); }
@@ -61,7 +551,11 @@ class parser
 		std::optional<std::string> getNextTokenWithoutMatching(std::istream& theStream);
 
 	private:
-		std::list<std::pair<std::regex, parsingFunction>> registeredKeywords;
+		std::optional<std::string_view> getNextTokenView(std::istream& theStream);
+
+		bool dispatch(std::string_view token, std::istream& theStream);
+
+		keywordTable<parsingFunction> registeredKeywords;
 		std::string nextToken;
 		int braceDepth = 0;
 };